@@ -0,0 +1,187 @@
+/*
+ * File:   AtomBasedTreeDecompositionAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ATOMBASEDTREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_ATOMBASEDTREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ITreeDecompositionAlgorithm interface which decomposes the input graph into its atoms,
+     *  i.e., into the maximal connected subgraphs which do not have a clique separator, computes a decomposition of
+     *  each atom using a base decomposition algorithm and glues the decompositions of the atoms along the clique
+     *  minimal separators.
+     *
+     *  Because the treewidth of a graph equals the maximum treewidth of its atoms, decomposing the atoms separately
+     *  does not increase the width of the resulting decomposition compared to an optimal decomposition of the whole
+     *  graph, but it allows the base algorithm to operate on (considerably) smaller graphs which can be decomposed
+     *  independently of each other.
+     *
+     *  @note The atoms are always determined based on the input graph, i.e., preprocessed graphs provided to the
+     *  algorithm are ignored and the base decomposition algorithm applies its own preprocessing to each atom.
+     */
+    class AtomBasedTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a tree decomposition algorithm based on the atoms of the input graph.
+             *
+             *  @param[in] manager  The management instance to which the new algorithm belongs.
+             */
+            HTD_API AtomBasedTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Constructor for a tree decomposition algorithm based on the atoms of the input graph.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @param[in] manager                  The management instance to which the new algorithm belongs.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
+             */
+            HTD_API AtomBasedTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations);
+
+            /**
+             *  Copy constructor for a htd::AtomBasedTreeDecompositionAlgorithm object.
+             *
+             *  @param[in] original The original htd::AtomBasedTreeDecompositionAlgorithm object.
+             */
+            HTD_API AtomBasedTreeDecompositionAlgorithm(const htd::AtomBasedTreeDecompositionAlgorithm & original);
+
+            HTD_API virtual ~AtomBasedTreeDecompositionAlgorithm();
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] preprocessedGraph            The input graph in preprocessed format.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const;
+
+            /**
+             *  Set the base decomposition algorithm which shall be used to decompose the atoms of the input graph.
+             *
+             *  If no base decomposition algorithm is set, the atoms are decomposed by an instance of the default tree decomposition
+             *  algorithm of the management instance. The manipulation operations of the base decomposition algorithm are applied to
+             *  the decompositions of the atoms, those of the current algorithm are applied to the glued decomposition.
+             *
+             *  @param[in] algorithm    The base decomposition algorithm which shall be used.
+             *
+             *  @note When calling this method the control over the memory region of the base decomposition algorithm is transferred to the decomposition
+             *  algorithm. Deleting the base decomposition algorithm provided to this method outside the decomposition algorithm or assigning the same
+             *  base decomposition algorithm multiple times will lead to undefined behavior.
+             */
+            HTD_API void setDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm);
+
+            /**
+             *  Getter for the number of threads which are used to decompose the atoms of the input graph.
+             *
+             *  @return The number of threads which are used to decompose the atoms of the input graph.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to decompose the atoms of the input graph.
+             *
+             *  Each worker thread decomposes the atoms with its own clone of the base decomposition algorithm and the random number
+             *  generator is seeded before each atom with a seed depending only on the index of the atom and the first pseudo-random
+             *  number drawn from htd::randomNumber() by the calling thread. The decompositions of the atoms are glued strictly in the
+             *  order of the atoms, i.e., for a fixed seed, the result does not depend on the number of threads or on their scheduling.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to decompose the atoms of the input graph.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            HTD_API void setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API bool isSafelyInterruptible(void) const HTD_OVERRIDE;
+
+            HTD_API bool isComputeInducedEdgesEnabled(void) const HTD_OVERRIDE;
+
+            HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API AtomBasedTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a tree decomposition algorithm based on the atoms of the input graph.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            AtomBasedTreeDecompositionAlgorithm & operator=(const AtomBasedTreeDecompositionAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_ATOMBASEDTREEDECOMPOSITIONALGORITHM_HPP */
@@ -0,0 +1,404 @@
+/*
+ * File:   BagStorage.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BAGSTORAGE_HPP
+#define HTD_HTD_BAGSTORAGE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ConstSpan.hpp>
+#include <htd/FilteredHyperedgeCollection.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Storage for the bag contents and the induced hyperedges of the nodes of a graph decomposition.
+     *
+     *  The entries are kept in one contiguous sequence of slots which is indexed directly by the vertex
+     *  identifier, i.e., no hash nodes or other per-node bookkeeping structures are allocated. Unused slots
+     *  at both ends of the sequence are discarded, so the sequence shrinks automatically when nodes are
+     *  removed in the order of their creation or in reverse order of their creation.
+     *
+     *  The bag contents of all nodes are packed into one shared arena and the indices of their induced
+     *  hyperedges into another one, each slot only records the offset and the length of its ranges. Ranges
+     *  which are no longer referenced are reclaimed by compacting the arenas as soon as they make up more
+     *  than half of an arena. The methods size(), bagSize() and bagSpan() read the arena directly.
+     *
+     *  The interfaces htd::IGraphDecomposition and htd::IMutableGraphDecomposition (and their tree and path
+     *  counterparts) hand out references to a std::vector and to a htd::FilteredHyperedgeCollection, which
+     *  must stay valid until the node is removed. Because the arenas are moved by a compaction, a node whose
+     *  bag content or whose induced hyperedges are accessed via such a reference is detached from the arena,
+     *  i.e., the respective entry is moved into an object of its own, and it stays detached until the node is
+     *  removed or its entries are replaced. This holds for the const accessors as well, so the arena only
+     *  pays off for nodes which are never accessed via bagContent() or inducedHyperedges(). Copies of the
+     *  storage pack all entries, including the detached ones, into the arenas again.
+     *
+     *  @note Concurrent calls of the const member functions are safe, detaching a node is synchronized internally.
+     */
+    class BagStorage
+    {
+        public:
+            /**
+             *  Constructor for a new, empty bag storage.
+             */
+            HTD_API BagStorage(void);
+
+            /**
+             *  Copy constructor for a bag storage.
+             *
+             *  @param[in] original  The original bag storage.
+             */
+            HTD_API BagStorage(const BagStorage & original);
+
+            /**
+             *  Move constructor for a bag storage.
+             *
+             *  @param[in] original  The original bag storage.
+             */
+            HTD_API BagStorage(BagStorage && original);
+
+            HTD_API virtual ~BagStorage();
+
+            /**
+             *  Getter for the number of nodes in the storage.
+             *
+             *  @return The number of nodes in the storage.
+             */
+            HTD_API std::size_t size(void) const;
+
+            /**
+             *  Check whether the storage contains an entry for a given node.
+             *
+             *  @param[in] vertex   The node.
+             *
+             *  @return True if the storage contains an entry for the given node, false otherwise.
+             */
+            HTD_API bool contains(htd::vertex_t vertex) const;
+
+            /**
+             *  Insert an empty bag for a given node. If the node is already part of the storage, its bag content and its induced hyperedges are cleared.
+             *
+             *  @param[in] vertex   The node.
+             */
+            HTD_API void insert(htd::vertex_t vertex);
+
+            /**
+             *  Insert the bag content and the induced hyperedges of a given node. If the node is already part of the storage, its entries are replaced.
+             *
+             *  @param[in] vertex       The node.
+             *  @param[in] bagContent   The bag content of the node.
+             *  @param[in] inducedEdges The collection of hyperedges induced by the bag content of the node.
+             */
+            HTD_API void insert(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges);
+
+            /**
+             *  Insert the bag content and the induced hyperedges of a given node. If the node is already part of the storage, its entries are replaced.
+             *
+             *  @param[in] vertex       The node.
+             *  @param[in] bagContent   The bag content of the node.
+             *  @param[in] inducedEdges The collection of hyperedges induced by the bag content of the node.
+             */
+            HTD_API void insert(htd::vertex_t vertex, std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges);
+
+            /**
+             *  Remove the entries of a given node from the storage.
+             *
+             *  @param[in] vertex   The node.
+             */
+            HTD_API void erase(htd::vertex_t vertex);
+
+            /**
+             *  Remove all entries from the storage.
+             */
+            HTD_API void clear(void);
+
+            /**
+             *  Getter for the size of the bag of a given node.
+             *
+             *  @param[in] vertex   The node. It must be part of the storage.
+             *
+             *  @return The size of the bag of the node.
+             */
+            HTD_API std::size_t bagSize(htd::vertex_t vertex) const;
+
+            /**
+             *  Access the bag content of a given node without detaching it from the arena.
+             *
+             *  @param[in] vertex   The node. It must be part of the storage.
+             *
+             *  @return A view of the bag content of the node. It stays valid until the next call of a non-const member function.
+             */
+            HTD_API htd::ConstSpan<htd::vertex_t> bagSpan(htd::vertex_t vertex) const;
+
+            /**
+             *  Access the bag content of a given node.
+             *
+             *  @param[in] vertex   The node. It must be part of the storage.
+             *
+             *  @return The bag content of the node.
+             *
+             *  @note The bag content is detached from the arena, see the description of the class.
+             */
+            HTD_API std::vector<htd::vertex_t> & bagContent(htd::vertex_t vertex);
+
+            /**
+             *  Access the bag content of a given node.
+             *
+             *  @param[in] vertex   The node. It must be part of the storage.
+             *
+             *  @return The bag content of the node.
+             *
+             *  @note The bag content is detached from the arena, see the description of the class.
+             */
+            HTD_API const std::vector<htd::vertex_t> & bagContent(htd::vertex_t vertex) const;
+
+            /**
+             *  Access the collection of hyperedges induced by the bag content of a given node.
+             *
+             *  @param[in] vertex   The node. It must be part of the storage.
+             *
+             *  @return The collection of hyperedges induced by the bag content of the node.
+             *
+             *  @note The induced hyperedges are detached from the arena, see the description of the class.
+             */
+            HTD_API htd::FilteredHyperedgeCollection & inducedHyperedges(htd::vertex_t vertex);
+
+            /**
+             *  Access the collection of hyperedges induced by the bag content of a given node.
+             *
+             *  @param[in] vertex   The node. It must be part of the storage.
+             *
+             *  @return The collection of hyperedges induced by the bag content of the node.
+             *
+             *  @note The induced hyperedges are detached from the arena, see the description of the class.
+             */
+            HTD_API const htd::FilteredHyperedgeCollection & inducedHyperedges(htd::vertex_t vertex) const;
+
+            /**
+             *  Copy assignment operator for a bag storage.
+             *
+             *  @param[in] original  The original bag storage.
+             */
+            HTD_API BagStorage & operator=(const BagStorage & original);
+
+            /**
+             *  Move assignment operator for a bag storage.
+             *
+             *  @param[in] original  The original bag storage.
+             */
+            HTD_API BagStorage & operator=(BagStorage && original);
+
+        private:
+            /**
+             *  Structure representing the slot of a single node.
+             */
+            struct Slot
+            {
+                /**
+                 *  Constructor for an unused slot.
+                 */
+                Slot(void) : used(false), bagOffset(0), bagLength(0), edgeOffset(0), edgeLength(0), baseCollection(), bagContent(nullptr), inducedEdges(nullptr)
+                {
+
+                }
+
+                ~Slot()
+                {
+                    delete bagContent.load();
+
+                    delete inducedEdges.load();
+                }
+
+                /**
+                 *  A boolean flag indicating whether the slot belongs to a node.
+                 */
+                bool used;
+
+                /**
+                 *  The position of the bag content of the node within the vertex arena.
+                 */
+                std::size_t bagOffset;
+
+                /**
+                 *  The size of the bag content of the node within the vertex arena.
+                 */
+                std::size_t bagLength;
+
+                /**
+                 *  The position of the indices of the induced hyperedges of the node within the index arena.
+                 */
+                std::size_t edgeOffset;
+
+                /**
+                 *  The number of indices of the induced hyperedges of the node within the index arena.
+                 */
+                std::size_t edgeLength;
+
+                /**
+                 *  The hyperedge collection to which the indices of the induced hyperedges refer.
+                 */
+                std::shared_ptr<htd::IHyperedgeCollection> baseCollection;
+
+                /**
+                 *  The detached bag content of the node or nullptr if the bag content is stored in the vertex arena.
+                 */
+                mutable std::atomic<std::vector<htd::vertex_t> *> bagContent;
+
+                /**
+                 *  The detached induced hyperedges of the node or nullptr if they are stored in the index arena.
+                 */
+                mutable std::atomic<htd::FilteredHyperedgeCollection *> inducedEdges;
+            };
+
+            /**
+             *  The slots of the nodes. The slot at position i belongs to the node with identifier offset_ + i.
+             */
+            std::deque<Slot> slots_;
+
+            /**
+             *  The identifier of the node belonging to the first slot.
+             */
+            htd::vertex_t offset_;
+
+            /**
+             *  The number of used slots.
+             */
+            std::size_t size_;
+
+            /**
+             *  The arena holding the bag contents of the nodes which are not detached.
+             */
+            std::vector<htd::vertex_t> vertexArena_;
+
+            /**
+             *  The arena holding the indices of the induced hyperedges of the nodes which are not detached.
+             */
+            std::vector<htd::index_t> indexArena_;
+
+            /**
+             *  The number of entries of the vertex arena which do not belong to any node.
+             */
+            mutable std::size_t vertexGarbage_;
+
+            /**
+             *  The number of entries of the index arena which do not belong to any node.
+             */
+            mutable std::size_t indexGarbage_;
+
+            /**
+             *  The mutex synchronizing the detachment of entries via the const member functions.
+             */
+            mutable std::mutex mutex_;
+
+            /**
+             *  Access the slot of a given node and create it if it does not exist yet.
+             *
+             *  @param[in] vertex   The node.
+             *
+             *  @return The slot of the given node.
+             */
+            Slot & acquireSlot(htd::vertex_t vertex);
+
+            /**
+             *  Release the entries of a given slot, i.e., its ranges of the arenas become garbage and its detached entries are deleted.
+             *
+             *  @param[in] slot The slot.
+             */
+            void release(Slot & slot);
+
+            /**
+             *  Store the bag content and the induced hyperedges of a node in the arenas, i.e., record their ranges in the given slot and release its previous entries.
+             *
+             *  @param[in] slot             The slot of the node.
+             *  @param[in] bagContent       The bag content of the node.
+             *  @param[in] baseCollection   The hyperedge collection to which the indices of the induced hyperedges refer.
+             *  @param[in] relevantIndices  The indices of the induced hyperedges.
+             */
+            void store(Slot & slot, htd::ConstSpan<htd::vertex_t> bagContent, const std::shared_ptr<htd::IHyperedgeCollection> & baseCollection, htd::ConstSpan<htd::index_t> relevantIndices);
+
+            /**
+             *  Copy the entries of all nodes of another bag storage into the (empty) storage.
+             *
+             *  @param[in] original  The original bag storage.
+             */
+            void assign(const BagStorage & original);
+
+            /**
+             *  Pack the ranges of the nodes which are not detached into new arenas and release the old ones if the arenas contain too much garbage.
+             */
+            void compact(void);
+
+            /**
+             *  Access the bag content of a node, regardless of whether it is detached.
+             *
+             *  @param[in] slot The slot of the node.
+             *
+             *  @return A view of the bag content of the node.
+             */
+            htd::ConstSpan<htd::vertex_t> bagRange(const Slot & slot) const;
+
+            /**
+             *  Access the indices of the induced hyperedges of a node, regardless of whether they are detached.
+             *
+             *  @param[in] slot The slot of the node.
+             *
+             *  @return A view of the indices of the induced hyperedges of the node.
+             */
+            htd::ConstSpan<htd::index_t> edgeRange(const Slot & slot) const;
+
+            /**
+             *  Access the hyperedge collection to which the indices of the induced hyperedges of a node refer, regardless of whether they are detached.
+             *
+             *  @param[in] slot The slot of the node.
+             *
+             *  @return The hyperedge collection to which the indices of the induced hyperedges of the node refer.
+             */
+            const std::shared_ptr<htd::IHyperedgeCollection> & baseCollection(const Slot & slot) const;
+
+            /**
+             *  Detach the bag content of a node from the vertex arena unless it is detached already.
+             *
+             *  @param[in] slot The slot of the node.
+             *
+             *  @return The detached bag content of the node.
+             */
+            std::vector<htd::vertex_t> & detachBagContent(const Slot & slot) const;
+
+            /**
+             *  Detach the induced hyperedges of a node from the index arena unless they are detached already.
+             *
+             *  @param[in] slot The slot of the node.
+             *
+             *  @return The detached induced hyperedges of the node.
+             */
+            htd::FilteredHyperedgeCollection & detachInducedEdges(const Slot & slot) const;
+    };
+}
+
+#endif /* HTD_HTD_BAGSTORAGE_HPP */
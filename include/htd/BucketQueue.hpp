@@ -0,0 +1,371 @@
+/* 
+ * File:   BucketQueue.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BUCKETQUEUE_HPP
+#define HTD_HTD_BUCKETQUEUE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Bucket-based priority queue for elements which are identified by consecutive indices and
+     *  whose priorities are small, non-negative integers such as vertex degrees.
+     *
+     *  The queue stores one bucket per priority value. All operations except for locating the next
+     *  non-empty bucket after the top collection became empty run in constant time.
+     *
+     *  The comparison operator determines the top priority in the same way as for htd::PriorityQueue,
+     *  i.e., std::less<std::size_t> leads to a queue with the maximum priority on top and
+     *  std::greater<std::size_t> leads to a queue with the minimum priority on top.
+     *
+     *  @note The order of the elements within topCollection() is unspecified.
+     */
+    template < typename ValueType, typename Compare = std::less<std::size_t> >
+    class BucketQueue
+    {
+        public:
+            /**
+             *  Constructor of a new bucket queue.
+             *
+             *  @param[in] capacity     The initial capacity of the bucket queue. Elements must be smaller than the capacity. If a larger element is inserted, the capacity is increased automatically.
+             *  @param[in] maxPriority  The expected maximum priority. If a larger priority is used, the number of buckets is increased automatically.
+             */
+            BucketQueue(std::size_t capacity = 0, std::size_t maxPriority = 0) : buckets_(maxPriority + 1), priorityOf_(capacity, UNUSED), positionOf_(capacity, 0), top_(0), size_(0), maximumOnTop_(Compare()(0, 1))
+            {
+
+            }
+
+            /**
+             *  Destructor of a bucket queue.
+             */
+            ~BucketQueue(void)
+            {
+
+            }
+
+            /**
+             *  Check whether the bucket queue is emtpy.
+             *
+             *  @return True if the bucket queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements in the bucket queue.
+             *
+             *  @return The number of elements in the bucket queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the bucket queue contains a specific element.
+             *
+             *  @param[in] value    The element.
+             *
+             *  @return True if the bucket queue contains the element, false otherwise.
+             */
+            bool contains(const ValueType & value) const
+            {
+                return static_cast<std::size_t>(value) < priorityOf_.size() && priorityOf_[value] != UNUSED;
+            }
+
+            /**
+             *  Access the priority of a specific element.
+             *
+             *  @param[in] value    The element. It must be contained in the bucket queue.
+             *
+             *  @return The priority of the element.
+             */
+            std::size_t priority(const ValueType & value) const
+            {
+                HTD_ASSERT(contains(value))
+
+                return priorityOf_[value];
+            }
+
+            /**
+             *  Access the top element.
+             *
+             *  @return The top element.
+             */
+            const ValueType & top(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[top_][0];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            std::size_t topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return top_;
+            }
+
+            /**
+             *  Access the collection of elements with top priority.
+             *
+             *  @return The collection of elements with top priority.
+             */
+            const std::vector<ValueType> & topCollection(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[top_];
+            }
+
+            /**
+             *  Insert a new element with the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted. It must not be contained in the bucket queue.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void push(const ValueType & value, std::size_t priority)
+            {
+                if (static_cast<std::size_t>(value) >= priorityOf_.size())
+                {
+                    priorityOf_.resize(static_cast<std::size_t>(value) + 1, UNUSED);
+                    positionOf_.resize(static_cast<std::size_t>(value) + 1, 0);
+                }
+
+                HTD_ASSERT(!contains(value))
+
+                insert(value, priority);
+
+                ++size_;
+            }
+
+            /**
+             *  Remove an arbitrary element of top priority.
+             */
+            void pop(void)
+            {
+                HTD_ASSERT(size_ > 0)
+
+                erase(top());
+            }
+
+            /**
+             *  Erase the specific element.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased, false otherwise.
+             */
+            bool erase(const ValueType & value)
+            {
+                bool ret = contains(value);
+
+                if (ret)
+                {
+                    remove(value);
+
+                    --size_;
+
+                    updateTop();
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the top collection.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the top collection, false otherwise.
+             */
+            bool eraseFromTopCollection(const ValueType & value)
+            {
+                bool ret = size_ > 0 && contains(value) && priorityOf_[value] == top_;
+
+                if (ret)
+                {
+                    remove(value);
+
+                    --size_;
+
+                    updateTop();
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Update the priority of a specific, existing element.
+             *
+             *  @param[in] value        The element which shall be updated.
+             *  @param[in] newPriority  The new priority of the element which shall be updated.
+             */
+            void updatePriority(const ValueType & value, std::size_t newPriority)
+            {
+                HTD_ASSERT(contains(value))
+
+                std::size_t oldPriority = priorityOf_[value];
+
+                if (oldPriority != newPriority)
+                {
+                    remove(value);
+
+                    insert(value, newPriority);
+
+                    /* If the element was the last one of top priority, the next non-empty bucket is located in the direction of the new priority. */
+                    if (oldPriority == top_)
+                    {
+                        updateTop();
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  Marker for elements which are not contained in the bucket queue.
+             */
+            static const std::size_t UNUSED = (std::size_t)-1;
+
+            /**
+             *  The buckets of elements, indexed by their priority.
+             */
+            std::vector<std::vector<ValueType>> buckets_;
+
+            /**
+             *  The priority of each element.
+             */
+            std::vector<std::size_t> priorityOf_;
+
+            /**
+             *  The position of each element within its bucket.
+             */
+            std::vector<htd::index_t> positionOf_;
+
+            /**
+             *  The top priority. If the bucket queue is empty, the value is meaningless.
+             */
+            std::size_t top_;
+
+            /**
+             *  The number of elements stored in the bucket queue.
+             */
+            std::size_t size_;
+
+            /**
+             *  A boolean flag indicating whether the maximum priority is on top.
+             */
+            bool maximumOnTop_;
+
+            /**
+             *  Insert an element into the bucket of the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void insert(const ValueType & value, std::size_t priority)
+            {
+                HTD_ASSERT(priority != UNUSED)
+
+                if (priority >= buckets_.size())
+                {
+                    buckets_.resize(priority + 1);
+                }
+
+                std::vector<ValueType> & bucket = buckets_[priority];
+
+                priorityOf_[value] = priority;
+                positionOf_[value] = bucket.size();
+
+                bucket.push_back(value);
+
+                if (size_ == 0 || (maximumOnTop_ ? priority > top_ : priority < top_))
+                {
+                    top_ = priority;
+                }
+            }
+
+            /**
+             *  Remove an element from its bucket.
+             *
+             *  @param[in] value    The element which shall be removed.
+             */
+            void remove(const ValueType & value)
+            {
+                std::vector<ValueType> & bucket = buckets_[priorityOf_[value]];
+
+                htd::index_t position = positionOf_[value];
+
+                ValueType lastValue = bucket.back();
+
+                bucket[position] = lastValue;
+
+                positionOf_[lastValue] = position;
+
+                bucket.pop_back();
+
+                priorityOf_[value] = UNUSED;
+            }
+
+            /**
+             *  Move the top priority to the next non-empty bucket if the current top bucket became empty.
+             */
+            void updateTop(void)
+            {
+                if (size_ > 0 && buckets_[top_].empty())
+                {
+                    if (maximumOnTop_)
+                    {
+                        while (buckets_[top_].empty())
+                        {
+                            --top_;
+                        }
+                    }
+                    else
+                    {
+                        while (buckets_[top_].empty())
+                        {
+                            ++top_;
+                        }
+                    }
+                }
+            }
+    };
+
+    template < typename ValueType, typename Compare >
+    const std::size_t BucketQueue<ValueType, Compare>::UNUSED;
+}
+
+#endif /* HTD_HTD_BUCKETQUEUE_HPP */
@@ -0,0 +1,82 @@
+/*
+ * File:   CancellationScope.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CANCELLATIONSCOPE_HPP
+#define HTD_HTD_CANCELLATIONSCOPE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/CancellationToken.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  RAII helper which attaches a cancellation token to the calling thread for the lifetime of the scope.
+     *
+     *  All computations which are started by the calling thread while the scope is alive observe the cancellation
+     *  of the token via htd::LibraryInstance::isTerminated(). When the scope is destroyed, the previously attached
+     *  token (if any) is attached to the calling thread again.
+     *
+     *  @note Scopes must be destroyed in the reverse order of their construction and on the thread which created them.
+     *  To keep an outer token effective within a nested scope, the token of the nested scope should be a child of the
+     *  outer token.
+     */
+    class CancellationScope
+    {
+        public:
+            /**
+             *  Constructor for a new cancellation scope.
+             *
+             *  @param[in] token    The token which shall be attached to the calling thread.
+             */
+            HTD_API CancellationScope(const std::shared_ptr<htd::CancellationToken> & token);
+
+            /**
+             *  Constructor for a new cancellation scope which limits the wall-clock time of the enclosed computation.
+             *
+             *  The scope attaches a new child of the token which is currently attached to the calling thread and sets its
+             *  deadline to the current time plus the given time limit. Hence, the deadlines and cancellations of all outer
+             *  tokens remain effective within the scope.
+             *
+             *  @param[in] timeLimit    The wall-clock time limit of the enclosed computation. If it is 0, the currently attached token stays attached.
+             */
+            HTD_API explicit CancellationScope(std::chrono::milliseconds timeLimit);
+
+            CancellationScope(const CancellationScope & original) = delete;
+
+            CancellationScope & operator=(const CancellationScope & original) = delete;
+
+            HTD_API virtual ~CancellationScope();
+
+        private:
+            /**
+             *  The token which was attached to the calling thread before the scope was created.
+             */
+            std::shared_ptr<htd::CancellationToken> previousToken_;
+    };
+}
+
+#endif /* HTD_HTD_CANCELLATIONSCOPE_HPP */
@@ -0,0 +1,153 @@
+/*
+ * File:   CancellationToken.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CANCELLATIONTOKEN_HPP
+#define HTD_HTD_CANCELLATIONTOKEN_HPP
+
+#include <htd/Globals.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Thread-safe token which allows to cancel a single computation independently of all other computations
+     *  sharing the same htd::LibraryInstance.
+     *
+     *  A token is cancelled if cancel() was called, if its deadline has passed or if its parent token is cancelled.
+     *  Tokens are attached to a thread via htd::CancellationScope. While a token is attached to the calling thread,
+     *  htd::LibraryInstance::isTerminated() reports the cancellation of the token, hence all algorithms of the library
+     *  can be cancelled via a token without any further changes.
+     */
+    class CancellationToken
+    {
+        public:
+            /**
+             *  The clock used for the deadlines of cancellation tokens.
+             */
+            typedef std::chrono::steady_clock clock;
+
+            /**
+             *  Constructor for a new cancellation token without parent.
+             */
+            HTD_API CancellationToken(void);
+
+            /**
+             *  Constructor for a new cancellation token which is cancelled together with the given parent token.
+             *
+             *  @param[in] parent   The parent token. If it is nullptr, the new token has no parent.
+             */
+            HTD_API CancellationToken(const std::shared_ptr<CancellationToken> & parent);
+
+            CancellationToken(const CancellationToken & original) = delete;
+
+            CancellationToken & operator=(const CancellationToken & original) = delete;
+
+            HTD_API virtual ~CancellationToken();
+
+            /**
+             *  Check whether the token is cancelled.
+             *
+             *  @note This method is cheap to call, it only reads the clock if a deadline is set for the token or one of its ancestors.
+             *
+             *  @return True if cancel() was called, if the deadline of the token has passed or if the parent token is cancelled, false otherwise.
+             */
+            HTD_API bool isCancelled(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Cancel the token and thereby all of its descendants.
+             *
+             *  @note This method is lock-free and may therefore be called from a signal handler.
+             */
+            HTD_API void cancel(void) HTD_NOEXCEPT;
+
+            /**
+             *  Check whether a deadline is set for the token.
+             *
+             *  @return True if a deadline is set for the token, false otherwise.
+             */
+            HTD_API bool hasDeadline(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the deadline of the token.
+             *
+             *  @return The deadline of the token or clock::time_point::max() if no deadline is set.
+             */
+            HTD_API clock::time_point deadline(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Set the deadline after which the token is considered as cancelled.
+             *
+             *  @param[in] deadline The deadline after which the token is considered as cancelled.
+             */
+            HTD_API void setDeadline(const clock::time_point & deadline) HTD_NOEXCEPT;
+
+            /**
+             *  Set the deadline of the token to the current time plus the given duration.
+             *
+             *  @param[in] duration The duration after which the token is considered as cancelled.
+             */
+            HTD_API void setTimeout(const clock::duration & duration) HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the parent token.
+             *
+             *  @return The parent token or nullptr if the token has no parent.
+             */
+            HTD_API const std::shared_ptr<CancellationToken> & parent(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the token which is attached to the calling thread.
+             *
+             *  @return The token which is attached to the calling thread or nullptr if no token is attached to the calling thread.
+             */
+            HTD_API static std::shared_ptr<CancellationToken> current(void);
+
+            /**
+             *  Check whether the token which is attached to the calling thread is cancelled.
+             *
+             *  @return True if a token is attached to the calling thread and if this token is cancelled, false otherwise.
+             */
+            HTD_API static bool isCurrentCancelled(void) HTD_NOEXCEPT;
+
+        private:
+            friend class CancellationScope;
+
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+
+            /**
+             *  Attach a token to the calling thread.
+             *
+             *  @param[in] token    The token which shall be attached to the calling thread. If it is nullptr, no token is attached to the calling thread afterwards.
+             *
+             *  @return The token which was attached to the calling thread before.
+             */
+            static std::shared_ptr<CancellationToken> attach(const std::shared_ptr<CancellationToken> & token);
+    };
+}
+
+#endif /* HTD_HTD_CANCELLATIONTOKEN_HPP */
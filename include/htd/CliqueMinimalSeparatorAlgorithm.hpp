@@ -49,6 +49,21 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> * computeSeparator(const htd::IGraphStructure & graph) const HTD_OVERRIDE;
 
+            /**
+             *  Decompose the given graph into its atoms, i.e., into the maximal connected subgraphs which do not have a clique separator.
+             *
+             *  The atoms are determined in the order in which they are split off from the graph. Each atom except the last one
+             *  contains a clique minimal separator (given by the entry of the vector separators at the same position) which
+             *  separates the remainder of the atom from all subsequent atoms. Each of these separators is fully contained in
+             *  one of the subsequent atoms. The separator of an atom is empty if the atom is not connected to the subsequent
+             *  atoms, i.e., the connected components of the graph are decomposed independently of each other.
+             *
+             *  @param[in] graph        The input graph.
+             *  @param[out] atoms       The vector to which the vertices of each atom shall be appended (each atom in ascending order).
+             *  @param[out] separators  The vector to which the clique minimal separator of each atom shall be appended (each separator in ascending order).
+             */
+            HTD_API void computeAtoms(const htd::IGraphStructure & graph, std::vector<std::vector<htd::vertex_t>> & atoms, std::vector<std::vector<htd::vertex_t>> & separators) const;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -33,6 +33,7 @@
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
 
+#include <chrono>
 #include <vector>
 #include <functional>
 
@@ -43,7 +44,9 @@ namespace htd
      *  tree decomposition of the same input graph with different base decomposition algorithms. After finishing the
      *  last iteration (or being interrupted by a call to htd::LibraryInstance::terminate()), the algorithm returns
      *  the decomposition with lowest width that was found so far. In case that this algorithm is interrupted before
-     *  the first iteration is finished, the return value of computeDecomposition() will be nullptr.
+     *  the first decomposition is found, the remaining base algorithms are invoked until one of them provides a
+     *  decomposition, hence safely interruptible base algorithms like htd::TrivialTreeDecompositionAlgorithm act as
+     *  a fallback. If no decomposition can be found, the return value of computeDecomposition() will be nullptr.
      *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithms and the given manipulations (or nullptr) also if it was interrupted
@@ -219,6 +222,22 @@ namespace htd
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the wall-clock time limit of the algorithm (0=unlimited).
+             *
+             *  @return The wall-clock time limit of the algorithm.
+             */
+            HTD_API std::chrono::milliseconds timeLimit(void) const;
+
+            /**
+             *  Set the wall-clock time limit of the algorithm (0=unlimited).
+             *
+             *  @note When the time limit is exceeded, the algorithm stops and returns the best decomposition found so far. The overshoot is bounded by the time between two consecutive termination checks of the underlying algorithms.
+             *
+             *  @param[in] timeLimit    The wall-clock time limit of the algorithm.
+             */
+            HTD_API void setTimeLimit(std::chrono::milliseconds timeLimit);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
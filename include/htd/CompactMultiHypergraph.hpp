@@ -0,0 +1,209 @@
+/*
+ * File:   CompactMultiHypergraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPACTMULTIHYPERGRAPH_HPP
+#define HTD_HTD_COMPACTMULTIHYPERGRAPH_HPP
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable implementation of the IMultiHypergraph interface.
+     *
+     *  The neighborhoods of the vertices as well as the endpoints of the hyperedges are stored in
+     *  compressed sparse row format, i.e., as one flat array of entries together with an array of
+     *  offsets. This makes the class considerably more memory-efficient and cache-friendly than
+     *  htd::MultiHypergraph for graphs which are only read after their construction.
+     *
+     *  @note The htd::Hyperedge objects returned by hyperedges(), hyperedge(htd::id_t) and
+     *  hyperedgeAtPosition(htd::index_t) are created on the first call of one of these methods.
+     */
+    class CompactMultiHypergraph : public virtual htd::IMultiHypergraph
+    {
+        public:
+            /**
+             *  Constructor for a compact multi-hypergraph.
+             *
+             *  @param[in] original  The original multi-hypergraph which shall be converted into a compact one.
+             */
+            HTD_API CompactMultiHypergraph(const htd::IMultiHypergraph & original);
+
+            /**
+             *  Constructor for a compact multi-hypergraph.
+             *
+             *  The vertices of the new graph are the vertices htd::Vertex::FIRST, ..., htd::Vertex::FIRST + vertexCount - 1
+             *  and the hyperedge with position i gets the ID htd::Id::FIRST + i. The endpoints of the hyperedge with position i
+             *  are stored at the positions edgeOffsets[i], ..., edgeOffsets[i + 1] - 1 of the vector edgeElements.
+             *
+             *  @param[in] manager      The management instance to which the new multi-hypergraph belongs.
+             *  @param[in] vertexCount  The number of vertices of the new multi-hypergraph.
+             *  @param[in] edgeOffsets  The offsets of the hyperedges within the vector of endpoints. The vector must contain one entry more than there are hyperedges.
+             *  @param[in] edgeElements The endpoints of all hyperedges in the order of their positions.
+             */
+            HTD_API CompactMultiHypergraph(const htd::LibraryInstance * const manager,
+                                           std::size_t vertexCount,
+                                           std::vector<htd::index_t> && edgeOffsets,
+                                           std::vector<htd::vertex_t> && edgeElements);
+
+            /**
+             *  Copy constructor for a compact multi-hypergraph.
+             *
+             *  @param[in] original  The original compact multi-hypergraph.
+             */
+            HTD_API CompactMultiHypergraph(const CompactMultiHypergraph & original);
+
+            HTD_API virtual ~CompactMultiHypergraph();
+
+            HTD_API std::size_t vertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
+
+            /**
+             *  Access the vector of all vertices in the graph.
+             *
+             *  @return The vector of all vertices in the graph sorted in ascending order.
+             */
+            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const;
+
+            HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(void) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE;
+
+            HTD_API std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API std::size_t isolatedVertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(std::vector<htd::index_t> && indices) const HTD_OVERRIDE;
+
+            /**
+             *  Getter for the number of endpoints of the hyperedge at the specific position.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *
+             *  @return The number of endpoints of the hyperedge at the specific position.
+             */
+            HTD_API std::size_t hyperedgeSizeAtPosition(htd::index_t index) const;
+
+            /**
+             *  Write the endpoints of the hyperedge at the specific position to the end of a given vector.
+             *
+             *  In contrast to hyperedgeAtPosition(htd::index_t), this method does not require the creation of htd::Hyperedge objects.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *  @param[out] target  The target vector to which the endpoints shall be appended.
+             */
+            HTD_API void copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API CompactMultiHypergraph * clone(void) const HTD_OVERRIDE;
+#else
+            /**
+             *  Create a deep copy of the current compact multi-hypergraph.
+             *
+             *  @return A new CompactMultiHypergraph object identical to the current compact multi-hypergraph.
+             */
+            HTD_API CompactMultiHypergraph * clone(void) const;
+
+            HTD_API htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IMultiHypergraph * cloneMultiHypergraph(void) const HTD_OVERRIDE;
+#endif
+
+            /**
+             *  Copy assignment operator for a compact multi-hypergraph.
+             *
+             *  @param[in] original  The original compact multi-hypergraph.
+             */
+            HTD_API CompactMultiHypergraph & operator=(const CompactMultiHypergraph & original);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_COMPACTMULTIHYPERGRAPH_HPP */
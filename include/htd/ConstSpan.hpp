@@ -0,0 +1,183 @@
+/*
+ * File:   ConstSpan.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONSTSPAN_HPP
+#define HTD_HTD_CONSTSPAN_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Read-only view of a contiguous sequence of elements.
+     *
+     *  In contrast to htd::ConstCollection, a span consists only of a pointer and a length.
+     *  Iterating over a span therefore requires neither virtual function calls nor heap
+     *  allocations for iterator objects.
+     *
+     *  @note A span does not own the referenced elements. It is invalidated by each operation
+     *  which invalidates pointers to the elements of the underlying storage.
+     */
+    template <typename T>
+    class ConstSpan
+    {
+        public:
+            /**
+             *  The value type of the span.
+             */
+            typedef T value_type;
+
+            /**
+             *  The iterator type of the span.
+             */
+            typedef const T * const_iterator;
+
+            /**
+             *  Constructor for an empty span.
+             */
+            ConstSpan(void) HTD_NOEXCEPT : data_(nullptr), size_(0)
+            {
+
+            }
+
+            /**
+             *  Constructor for a span.
+             *
+             *  @param[in] data The pointer to the first element of the span.
+             *  @param[in] size The number of elements of the span.
+             */
+            ConstSpan(const T * data, std::size_t size) HTD_NOEXCEPT : data_(data), size_(size)
+            {
+
+            }
+
+            /**
+             *  Constructor for a span covering all elements of a vector.
+             *
+             *  @param[in] collection   The vector which shall be covered by the span.
+             */
+            ConstSpan(const std::vector<T> & collection) HTD_NOEXCEPT : data_(collection.data()), size_(collection.size())
+            {
+
+            }
+
+            /**
+             *  Check whether the span contains no elements.
+             *
+             *  @return True if the span contains no elements, false otherwise.
+             */
+            bool empty(void) const HTD_NOEXCEPT
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements of the span.
+             *
+             *  @return The number of elements of the span.
+             */
+            std::size_t size(void) const HTD_NOEXCEPT
+            {
+                return size_;
+            }
+
+            /**
+             *  Getter for the pointer to the first element of the span.
+             *
+             *  @return The pointer to the first element of the span.
+             */
+            const T * data(void) const HTD_NOEXCEPT
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for an iterator pointing to the first element of the span.
+             *
+             *  @return An iterator pointing to the first element of the span.
+             */
+            const_iterator begin(void) const HTD_NOEXCEPT
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for an iterator pointing to the end of the elements of the span.
+             *
+             *  @return An iterator pointing to the end of the elements of the span.
+             */
+            const_iterator end(void) const HTD_NOEXCEPT
+            {
+                return data_ + size_;
+            }
+
+            /**
+             *  Access the element at the specific position within the span.
+             *
+             *  @param[in] index    The position of the element.
+             *
+             *  @return The element at the specific position.
+             */
+            const T & operator[](std::size_t index) const HTD_NOEXCEPT
+            {
+                return data_[index];
+            }
+
+            /**
+             *  Access the element at the specific position within the span.
+             *
+             *  @param[in] index    The position of the element.
+             *
+             *  @throw std::out_of_range If the position is not smaller than the size of the span.
+             *
+             *  @return The element at the specific position.
+             */
+            const T & at(std::size_t index) const
+            {
+                if (index >= size_)
+                {
+                    throw std::out_of_range("const T & htd::ConstSpan<T>::at(std::size_t) const");
+                }
+
+                return data_[index];
+            }
+
+        private:
+            /**
+             *  The pointer to the first element of the span.
+             */
+            const T * data_;
+
+            /**
+             *  The number of elements of the span.
+             */
+            std::size_t size_;
+    };
+}
+
+#endif /* HTD_HTD_CONSTSPAN_HPP */
@@ -0,0 +1,352 @@
+/*
+ * File:   DenseAdjacencyMatrix.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_DENSEADJACENCYMATRIX_HPP
+#define HTD_HTD_DENSEADJACENCYMATRIX_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#if HTD_COMPILER_IS_MSVC == 1
+    #include <intrin.h>
+#endif
+
+namespace htd
+{
+    /**
+     *  Dense adjacency matrix of a subset of the vertices of a preprocessed graph.
+     *
+     *  The neighborhood of each vertex is stored as a bitset consisting of wordCount() machine words
+     *  so that the intersection or union of two neighborhoods can be computed with word-wide AND and
+     *  OR operations and the size of the result can be obtained via population count. Within the matrix,
+     *  the vertices are identified by their position in the sorted vector returned by vertices().
+     *
+     *  @note The rows of the matrix do not contain the respective vertex itself.
+     */
+    class DenseAdjacencyMatrix
+    {
+        public:
+            /**
+             *  The data type of a single word of a row.
+             */
+            typedef std::uint64_t word_t;
+
+            /**
+             *  The number of bits of a single word of a row.
+             */
+            static const std::size_t WORD_SIZE = 64;
+
+            /**
+             *  Constructor for a dense adjacency matrix.
+             *
+             *  @param[in] neighborhood The neighborhoods of all vertices, given as sorted vectors of 0-based vertex identifiers.
+             *  @param[in] vertices     The sorted set of vertices which shall be represented by the matrix. Neighbors which are not contained in this set are ignored.
+             */
+            HTD_API DenseAdjacencyMatrix(const std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::vertex_t> & vertices);
+
+            /**
+             *  Copy constructor for a dense adjacency matrix.
+             *
+             *  @param[in] original  The original dense adjacency matrix.
+             */
+            HTD_API DenseAdjacencyMatrix(const DenseAdjacencyMatrix & original);
+
+            HTD_API virtual ~DenseAdjacencyMatrix();
+
+            /**
+             *  Getter for the number of vertices represented by the matrix.
+             *
+             *  @return The number of vertices represented by the matrix.
+             */
+            std::size_t vertexCount(void) const HTD_NOEXCEPT
+            {
+                return vertices_.size();
+            }
+
+            /**
+             *  Getter for the number of words of each row of the matrix.
+             *
+             *  @return The number of words of each row of the matrix.
+             */
+            std::size_t wordCount(void) const HTD_NOEXCEPT
+            {
+                return wordCount_;
+            }
+
+            /**
+             *  Getter for the sorted set of vertices represented by the matrix.
+             *
+             *  @return The sorted set of vertices represented by the matrix.
+             */
+            const std::vector<htd::vertex_t> & vertices(void) const HTD_NOEXCEPT
+            {
+                return vertices_;
+            }
+
+            /**
+             *  Getter for the vertex at a specific position of the matrix.
+             *
+             *  @param[in] index    The position of the vertex.
+             *
+             *  @return The vertex at the specific position of the matrix.
+             */
+            htd::vertex_t vertexAtPosition(htd::index_t index) const
+            {
+                HTD_ASSERT(index < vertices_.size())
+
+                return vertices_[index];
+            }
+
+            /**
+             *  Getter for the words of all rows of the matrix.
+             *
+             *  The row of the vertex at position i occupies the words i * wordCount(), ..., (i + 1) * wordCount() - 1.
+             *
+             *  @return The words of all rows of the matrix.
+             */
+            const std::vector<word_t> & words(void) const HTD_NOEXCEPT
+            {
+                return words_;
+            }
+
+            /**
+             *  Access the row of the vertex at a specific position of the matrix.
+             *
+             *  @param[in] index    The position of the vertex.
+             *
+             *  @return A pointer to the first word of the row of the vertex at the specific position of the matrix.
+             */
+            const word_t * row(htd::index_t index) const
+            {
+                HTD_ASSERT(index < vertices_.size())
+
+                return words_.data() + index * wordCount_;
+            }
+
+            /**
+             *  Check whether the vertices at two specific positions of the matrix are adjacent.
+             *
+             *  @param[in] index1   The position of the first vertex.
+             *  @param[in] index2   The position of the second vertex.
+             *
+             *  @return True if the vertices at the given positions are adjacent, false otherwise.
+             */
+            bool isNeighbor(htd::index_t index1, htd::index_t index2) const
+            {
+                HTD_ASSERT(index1 < vertices_.size() && index2 < vertices_.size())
+
+                return isSet(row(index1), index2);
+            }
+
+            /**
+             *  Check whether the dense representation is recommended for a graph of the given size.
+             *
+             *  The dense representation is recommended if the matrix is small or if the average degree
+             *  of the vertices is at least as large as the number of words of a row, i.e., if operations
+             *  on entire rows are not more expensive than operations on the sorted neighborhoods.
+             *
+             *  @param[in] vertexCount  The number of vertices of the graph.
+             *  @param[in] edgeCount    The number of edges of the graph.
+             *
+             *  @return True if the dense representation is recommended for a graph of the given size, false otherwise.
+             */
+            HTD_API static bool isRecommended(std::size_t vertexCount, std::size_t edgeCount) HTD_NOEXCEPT;
+
+            /**
+             *  Compute the number of words needed to store a row of a matrix for the given number of vertices.
+             *
+             *  @param[in] vertexCount  The number of vertices of the matrix.
+             *
+             *  @return The number of words needed to store a row of a matrix for the given number of vertices.
+             */
+            static std::size_t requiredWordCount(std::size_t vertexCount) HTD_NOEXCEPT
+            {
+                return (vertexCount + WORD_SIZE - 1) / WORD_SIZE;
+            }
+
+            /**
+             *  Check whether a specific bit of a row is set.
+             *
+             *  @param[in] row      A pointer to the first word of the row.
+             *  @param[in] index    The index of the bit.
+             *
+             *  @return True if the bit is set, false otherwise.
+             */
+            static bool isSet(const word_t * row, htd::index_t index) HTD_NOEXCEPT
+            {
+                return ((row[index / WORD_SIZE] >> (index % WORD_SIZE)) & 1) != 0;
+            }
+
+            /**
+             *  Set a specific bit of a row.
+             *
+             *  @param[in,out] row  A pointer to the first word of the row.
+             *  @param[in] index    The index of the bit.
+             */
+            static void set(word_t * row, htd::index_t index) HTD_NOEXCEPT
+            {
+                row[index / WORD_SIZE] |= ((word_t)1) << (index % WORD_SIZE);
+            }
+
+            /**
+             *  Clear a specific bit of a row.
+             *
+             *  @param[in,out] row  A pointer to the first word of the row.
+             *  @param[in] index    The index of the bit.
+             */
+            static void reset(word_t * row, htd::index_t index) HTD_NOEXCEPT
+            {
+                row[index / WORD_SIZE] &= ~(((word_t)1) << (index % WORD_SIZE));
+            }
+
+            /**
+             *  Compute the number of bits set in a word.
+             *
+             *  @param[in] word The word.
+             *
+             *  @return The number of bits set in the word.
+             */
+            static std::size_t popcount(word_t word) HTD_NOEXCEPT
+            {
+#if HTD_COMPILER_IS_GNU == 1 || HTD_COMPILER_IS_Clang == 1 || HTD_COMPILER_IS_AppleClang == 1
+                return static_cast<std::size_t>(__builtin_popcountll(word));
+#elif HTD_COMPILER_IS_MSVC == 1 && defined(_M_X64)
+                return static_cast<std::size_t>(__popcnt64(word));
+#else
+                word = word - ((word >> 1) & 0x5555555555555555ULL);
+                word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+                word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+                return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+            }
+
+            /**
+             *  Compute the index of the least significant bit set in a word.
+             *
+             *  @param[in] word The word. It must not be zero.
+             *
+             *  @return The index of the least significant bit set in the word.
+             */
+            static std::size_t trailingZeroCount(word_t word) HTD_NOEXCEPT
+            {
+                HTD_ASSERT(word != 0)
+
+#if HTD_COMPILER_IS_GNU == 1 || HTD_COMPILER_IS_Clang == 1 || HTD_COMPILER_IS_AppleClang == 1
+                return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+                return popcount((word & (~word + 1)) - 1);
+#endif
+            }
+
+            /**
+             *  Compute the number of bits set in a row.
+             *
+             *  @param[in] row          A pointer to the first word of the row.
+             *  @param[in] wordCount    The number of words of the row.
+             *
+             *  @return The number of bits set in the row.
+             */
+            static std::size_t count(const word_t * row, std::size_t wordCount) HTD_NOEXCEPT
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += popcount(row[index]);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Compute the number of bits set in both of two rows.
+             *
+             *  @param[in] row1         A pointer to the first word of the first row.
+             *  @param[in] row2         A pointer to the first word of the second row.
+             *  @param[in] wordCount    The number of words of the rows.
+             *
+             *  @return The number of bits set in both of the two rows.
+             */
+            static std::size_t intersectionCount(const word_t * row1, const word_t * row2, std::size_t wordCount) HTD_NOEXCEPT
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += popcount(row1[index] & row2[index]);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Compute the number of bits set in the first row but not in the second one.
+             *
+             *  @param[in] row1         A pointer to the first word of the first row.
+             *  @param[in] row2         A pointer to the first word of the second row.
+             *  @param[in] wordCount    The number of words of the rows.
+             *
+             *  @return The number of bits set in the first row but not in the second one.
+             */
+            static std::size_t differenceCount(const word_t * row1, const word_t * row2, std::size_t wordCount) HTD_NOEXCEPT
+            {
+                std::size_t ret = 0;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += popcount(row1[index] & ~row2[index]);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Copy assignment operator for a dense adjacency matrix.
+             *
+             *  @param[in] original  The original dense adjacency matrix.
+             */
+            HTD_API DenseAdjacencyMatrix & operator=(const DenseAdjacencyMatrix & original);
+
+        private:
+            /**
+             *  The sorted set of vertices represented by the matrix.
+             */
+            std::vector<htd::vertex_t> vertices_;
+
+            /**
+             *  The number of words of each row of the matrix.
+             */
+            std::size_t wordCount_;
+
+            /**
+             *  The words of all rows of the matrix.
+             */
+            std::vector<word_t> words_;
+    };
+}
+
+#endif /* HTD_HTD_DENSEADJACENCYMATRIX_HPP */
@@ -31,6 +31,9 @@ namespace htd
 {
     /**
      *  Implementation of the IMaxFlowAlgorithm interface based on Yefim Dinitz's algorithm.
+     *
+     *  The blocking flows are computed on the array-based residual network using current-arc pointers,
+     *  i.e., each arc is skipped at most once per phase.
      */
     class DinitzMaxFlowAlgorithm : public htd::IMaxFlowAlgorithm
     {
@@ -50,6 +53,8 @@ namespace htd
 
             HTD_API htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE;
 
+            HTD_API std::size_t determineMaximumFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const HTD_OVERRIDE;
+
             HTD_API DinitzMaxFlowAlgorithm * clone(void) const HTD_OVERRIDE;
 
         private:
@@ -28,10 +28,20 @@
 #include <htd/Globals.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface based on the MCS-M elimination ordering algorithm.
+     *
+     *  The elimination ordering corresponds to a minimal triangulation of the input graph. Each step of the
+     *  search numbers a vertex of maximum weight and performs a single graph search, bucketed by the weights
+     *  of the vertices, to determine all unnumbered vertices whose weight must be increased. The search does
+     *  not expand vertices whose weight is at least the maximum weight of the unnumbered vertices, because no
+     *  path through such a vertex can lead to an update. Optionally, the lexicographic labels of LEX M can be
+     *  used instead of the weights of MCS-M.
      */
     class EnhancedMaximumCardinalitySearchOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
     {
@@ -49,6 +59,35 @@ namespace htd
 
             HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Compute a minimal triangulation of the given graph.
+             *
+             *  In contrast to computeOrdering(), the graph is not preprocessed and the fill edges of the minimal triangulation
+             *  are reported by the search itself, i.e., they do not have to be recomputed from the elimination ordering.
+             *
+             *  @param[in] graph        The input graph.
+             *  @param[out] ordering    The vector to which the vertex elimination ordering of the minimal triangulation shall be appended.
+             *  @param[out] fillEdges   The vector to which the fill edges of the minimal triangulation shall be appended. The endpoints of each fill edge are given in ascending order.
+             */
+            HTD_API void computeMinimalTriangulation(const htd::IGraphStructure & graph, std::vector<htd::vertex_t> & ordering, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges) const;
+
+            /**
+             *  Check whether the lexicographic labels of LEX M are used instead of the weights of MCS-M.
+             *
+             *  @return True if the lexicographic labels of LEX M are used instead of the weights of MCS-M, false otherwise.
+             */
+            HTD_API bool isLexicographicSearchEnabled(void) const;
+
+            /**
+             *  Set whether the lexicographic labels of LEX M shall be used instead of the weights of MCS-M.
+             *
+             *  Both variants compute a minimal triangulation. LEX M ranks the labels of all unnumbered vertices after each step
+             *  and therefore needs additional time linear in the number of vertices per step.
+             *
+             *  @param[in] lexicographicSearchEnabled   A boolean flag indicating whether the lexicographic labels of LEX M shall be used instead of the weights of MCS-M.
+             */
+            HTD_API void setLexicographicSearchEnabled(bool lexicographicSearchEnabled);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -389,6 +389,8 @@ namespace htd
             HTD_API void swap(FilteredHyperedgeCollection & other);
 
         private:
+            friend class BagStorage;
+
             std::shared_ptr<htd::IHyperedgeCollection> baseCollection_;
 
             std::shared_ptr<std::vector<htd::index_t>> relevantIndices_;
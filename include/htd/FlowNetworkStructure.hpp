@@ -62,6 +62,8 @@ namespace htd
 
             HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
@@ -80,6 +82,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API std::size_t edgeCount(void) const HTD_OVERRIDE;
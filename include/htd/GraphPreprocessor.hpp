@@ -29,6 +29,8 @@
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 
+#include <chrono>
+
 namespace htd
 {
     /**
@@ -91,6 +93,43 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the wall-clock time limit of the preprocessing (0=unlimited).
+             *
+             *  @return The wall-clock time limit of the preprocessing.
+             */
+            HTD_API std::chrono::milliseconds timeLimit(void) const;
+
+            /**
+             *  Set the wall-clock time limit of the preprocessing (0=unlimited).
+             *
+             *  @note When the time limit is exceeded, the reduction rule which is currently applied is completed, all remaining reduction rules are skipped and the partially preprocessed graph is returned.
+             *
+             *  @param[in] timeLimit    The wall-clock time limit of the preprocessing.
+             */
+            HTD_API void setTimeLimit(std::chrono::milliseconds timeLimit);
+
+            /**
+             *  Getter for the number of threads which are used to eliminate the connected components of the remainder of the input graph.
+             *
+             *  @return The number of threads which are used to eliminate the connected components of the remainder of the input graph.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to eliminate the connected components of the remainder of the input graph.
+             *
+             *  The connected components are only processed separately if the preprocessing strategy retains only the largest
+             *  biconnected component (level 4 or more). Each worker thread uses its own clone of the ordering algorithm and the
+             *  random number generator is seeded before each component with a seed depending only on the index of the component
+             *  and the first pseudo-random number drawn from htd::randomNumber() by the calling thread. The partial elimination
+             *  orderings are merged strictly in the order of the components, i.e., for a fixed seed, the result does not depend on
+             *  the number of threads or on their scheduling.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to eliminate the connected components.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination
              *  ordering of the remainder of the input graph when only the largest biconnected
@@ -325,14 +325,36 @@ namespace htd
         }
     }
 
+    /**
+     *  Draw a pseudo-random number.
+     *
+     *  @note If a seed was set for the calling thread via htd::setThreadLocalRandomSeed(unsigned int), the number is drawn
+     *  from a random number generator which is local to the calling thread. Otherwise, the result of std::rand() is returned.
+     *
+     *  @return A non-negative pseudo-random number.
+     */
+    HTD_API std::size_t randomNumber(void);
+
+    /**
+     *  Seed the random number generator which is local to the calling thread and use it for all subsequent calls of
+     *  htd::randomNumber() issued by the calling thread.
+     *
+     *  @param[in] seed The new seed of the random number generator which is local to the calling thread.
+     */
+    HTD_API void setThreadLocalRandomSeed(unsigned int seed);
+
+    /**
+     *  Disable the random number generator which is local to the calling thread, i.e., all subsequent calls of htd::randomNumber()
+     *  issued by the calling thread are answered by std::rand() again.
+     */
+    HTD_API void resetThreadLocalRandomSeed(void);
+
     template < typename T, typename Collection >
     const T & selectRandomElement(const Collection & collection)
     {
         auto position = collection.begin();
 
-        /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-        // coverity[dont_call]
-        std::advance(position, std::rand() % collection.size());
+        std::advance(position, htd::randomNumber() % collection.size());
 
         return *position;
     }
@@ -374,6 +396,16 @@ namespace htd
                                   const std::vector<htd::vertex_t> & set2,
                                   std::vector<htd::vertex_t> & result);
 
+    /**
+     *  Compute the number of vertices which are found in both of the given sets.
+     *
+     *  @param[in] set1 The first set of vertices, sorted in ascending order.
+     *  @param[in] set2 The second set of vertices, sorted in ascending order.
+     *
+     *  @return The number of vertices which are found in both of the given sets.
+     */
+    HTD_API std::size_t set_intersection_size(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
+
     HTD_API std::tuple<std::size_t, std::size_t, std::size_t> analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
 
     /**
@@ -35,6 +35,10 @@ namespace htd
 {
     /**
      *  Class for the efficient storage of hyperedges.
+     *
+     *  The endpoints are stored directly within the hyperedge object. A second, sorted copy of
+     *  the endpoints is only allocated if the endpoints are not already sorted in ascending
+     *  order and free of duplicates.
      */
     class Hyperedge
     {
@@ -120,7 +124,7 @@ namespace htd
             /**
              *  Destructor for a Hyperedge object.
              */
-            HTD_API virtual ~Hyperedge() HTD_NOEXCEPT;
+            HTD_API ~Hyperedge() HTD_NOEXCEPT;
 
             /**
              *  Getter for the ID of the hyperedge.
@@ -313,15 +317,27 @@ namespace htd
              */
             HTD_API bool operator!=(const std::vector<htd::vertex_t> & rhs) const;
 
+        private:
             /**
-             *  Forward declaration of internal class for storing the element information of a hyperedge.
+             *  The ID of the hyperedge.
              */
-            class IElementInformation;
-
-        private:
             htd::id_t id_;
 
-            std::unique_ptr<IElementInformation> content_;
+            /**
+             *  The endpoints of the hyperedge in the order in which they were provided.
+             */
+            std::vector<htd::vertex_t> elements_;
+
+            /**
+             *  The endpoints of the hyperedge in ascending order without duplicates. The vector is
+             *  empty if the vector of endpoints is already sorted in ascending order and free of duplicates.
+             */
+            std::vector<htd::vertex_t> sortedElements_;
+
+            /**
+             *  Update the sorted endpoints of the hyperedge after the endpoints have changed.
+             */
+            void updateSortedElements(void) HTD_NOEXCEPT;
     };
 }
 
@@ -27,6 +27,7 @@
 
 #include <htd/Globals.hpp>
 #include <htd/ConstCollection.hpp>
+#include <htd/ConstSpan.hpp>
 
 #include <vector>
 
@@ -61,6 +62,17 @@ namespace htd
              */
             virtual void copyVerticesTo(std::vector<htd::vertex_t> & target) const = 0;
 
+            /**
+             *  Access the vertices of the graph as a contiguous view of the internal storage.
+             *
+             *  In contrast to vertices(), iterating over the result involves no virtual function calls.
+             *
+             *  @note The view is invalidated by each modification of the graph.
+             *
+             *  @return A view of all vertices of the graph in ascending order.
+             */
+            virtual htd::ConstSpan<htd::vertex_t> vertexSpan(void) const = 0;
+
             /**
              *  Access the vertex at the specific position.
              *
@@ -137,6 +149,22 @@ namespace htd
              */
             virtual void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const = 0;
 
+            /**
+             *  Access the neighbors of a given vertex as a contiguous view.
+             *
+             *  Graphs which store the neighborhood of the vertex contiguously return a view of their internal
+             *  storage and leave the buffer untouched. All other graphs replace the content of the buffer by
+             *  the neighbors of the vertex and return a view of the buffer.
+             *
+             *  @note The view is invalidated by each modification of the graph and of the buffer.
+             *
+             *  @param[in] vertex   The vertex for which the neighbors shall be returned.
+             *  @param[in] buffer   The buffer which is used if the neighborhood is not stored contiguously.
+             *
+             *  @return A view of all neighbors of the given vertex in ascending order.
+             */
+            virtual htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const = 0;
+
             /**
              *  Access the neighbor at the specific position.
              *
@@ -33,6 +33,11 @@
 
 namespace htd
 {
+    /**
+     *  Forward declaration of class htd::ResidualNetwork.
+     */
+    class ResidualNetwork;
+
     /**
      *  Interface for algorithms which compute the maximum flow within a flow network.
      */
@@ -64,15 +69,54 @@ namespace htd
              */
             virtual htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const = 0;
 
+            /**
+             *  Determine the maximum flow between the source and the target vertex in the given residual network.
+             *
+             *  The residual network is reset before the computation and it contains the maximum flow afterwards. Hence, the
+             *  vertices which are reachable from the source vertex via arcs with positive residual capacity form a minimum cut.
+             *
+             *  The computation stops as soon as the value of the flow reaches the given limit. In this case, the content of
+             *  the residual network is unspecified, i.e., it does not necessarily represent a valid flow.
+             *
+             *  The default implementation augments the flow along shortest paths found by breadth-first search. Algorithms
+             *  which operate directly on residual networks should override it.
+             *
+             *  @param[in] residualNetwork  The residual network.
+             *  @param[in] source           The source vertex.
+             *  @param[in] target           The target vertex.
+             *  @param[in] flowLimit        The limit for the value of the flow. Use (std::size_t)-1 to determine the maximum flow without any limit.
+             *
+             *  @return The value of the maximum flow if it is smaller than the given limit, otherwise a value which is at least the limit.
+             */
+            virtual std::size_t determineMaximumFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const;
+
             /**
              *  Create a deep copy of the current maximum flow algorithm.
              *
              *  @return A new IMaxFlowAlgorithm object identical to the current maximum flow algorithm.
              */
             virtual IMaxFlowAlgorithm * clone(void) const = 0;
+
+        protected:
+            /**
+             *  Determine the maximum flow between the source and the target vertex in the given residual network by augmenting the flow along shortest paths.
+             *
+             *  @param[in] residualNetwork  The residual network.
+             *  @param[in] source           The source vertex.
+             *  @param[in] target           The target vertex.
+             *  @param[in] flowLimit        The limit for the value of the flow. No further path is augmented once the limit is reached.
+             *
+             *  @return The value of the maximum flow if it is smaller than the given limit, otherwise the limit.
+             */
+            HTD_API std::size_t augmentAlongShortestPaths(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const;
     };
 
     inline htd::IMaxFlowAlgorithm::~IMaxFlowAlgorithm() { }
+
+    inline std::size_t htd::IMaxFlowAlgorithm::determineMaximumFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const
+    {
+        return augmentAlongShortestPaths(residualNetwork, source, target, flowLimit);
+    }
 }
 
 #endif /* HTD_HTD_IMAXFLOWALGORITHM_HPP */
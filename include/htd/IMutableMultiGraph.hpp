@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiGraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -90,6 +93,17 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) = 0;
 
+            /**
+             *  Add a collection of new edges to the multi-graph.
+             *
+             *  The new edges get consecutive IDs in the order in which they occur in the given vector. In contrast to
+             *  repeated calls of addEdge(htd::vertex_t, htd::vertex_t), the neighborhoods of the affected vertices
+             *  are updated only once, which makes this method considerably faster for large collections of edges.
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             */
+            virtual void addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) = 0;
+
             /**
              *  Remove an edge from the multi-graph.
              *
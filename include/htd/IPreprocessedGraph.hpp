@@ -27,6 +27,7 @@
 
 #include <htd/Globals.hpp>
 
+#include <htd/DenseAdjacencyMatrix.hpp>
 #include <htd/IGraphStructure.hpp>
 
 namespace htd
@@ -116,6 +117,17 @@ namespace htd
              *  @return The lower bound of the treewidth of the input graph.
              */
             virtual std::size_t minTreeWidth(void) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Getter for the dense adjacency matrix of the remaining vertices.
+             *
+             *  @note The dense adjacency matrix is only available if the remaining graph is small or dense
+             *  enough so that operations on bitsets are not more expensive than operations on the sorted
+             *  neighborhoods.
+             *
+             *  @return The dense adjacency matrix of the remaining vertices or a null pointer if no dense adjacency matrix is available.
+             */
+            virtual const htd::DenseAdjacencyMatrix * denseAdjacencyMatrix(void) const HTD_NOEXCEPT = 0;
     };
 
     inline htd::IPreprocessedGraph::~IPreprocessedGraph() { }
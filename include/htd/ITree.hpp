@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/IGraph.hpp>
 #include <htd/ConstCollection.hpp>
+#include <htd/ConstSpan.hpp>
 
 namespace htd
 {
@@ -150,6 +151,19 @@ namespace htd
              */
             virtual void copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const = 0;
 
+            /**
+             *  Access the children of a given vertex as a contiguous view of the internal storage.
+             *
+             *  In contrast to children(htd::vertex_t), iterating over the result involves no virtual function calls.
+             *
+             *  @note The view is invalidated by each modification of the tree.
+             *
+             *  @param[in] vertex   The vertex for which the children shall be returned.
+             *
+             *  @return A view of all children of the given vertex in ascending order.
+             */
+            virtual htd::ConstSpan<htd::vertex_t> childSpan(htd::vertex_t vertex) const = 0;
+
             /**
              *  Access the child at the specific position.
              *
@@ -0,0 +1,497 @@
+/* 
+ * File:   IndexedPriorityQueue.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_INDEXEDPRIORITYQUEUE_HPP
+#define HTD_HTD_INDEXEDPRIORITYQUEUE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Priority queue for elements which are identified by consecutive indices, allowing to efficiently
+     *  access the collection of all elements of top priority.
+     *
+     *  In contrast to htd::PriorityQueue, the queue keeps track of the priority and of the position of
+     *  each element. Hence, top() and topCollection() run in constant time while updatePriority() and
+     *  erase() run in time logarithmic in the number of distinct priorities.
+     *
+     *  @note The order of the elements within topCollection() is unspecified.
+     */
+    template < typename ValueType, typename PriorityType, typename Compare = std::less<PriorityType> >
+    class IndexedPriorityQueue
+    {
+        public:
+            /**
+             *  Constructor of a new priority queue.
+             *
+             *  @param[in] capacity The initial capacity of the priority queue. Elements must be smaller than the capacity. If a larger element is inserted, the capacity is increased automatically.
+             */
+            IndexedPriorityQueue(std::size_t capacity = 0) : compare_(), heap_(), buckets_(), freeBuckets_(), bucketIds_(), bucketOf_(capacity, UNUSED), positionOf_(capacity, 0), size_(0)
+            {
+
+            }
+
+            /**
+             *  Destructor of a priority queue.
+             */
+            ~IndexedPriorityQueue(void)
+            {
+
+            }
+
+            /**
+             *  Check whether the priority queue is emtpy.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements in the priority queue.
+             *
+             *  @return The number of elements in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the priority queue contains a specific element.
+             *
+             *  @param[in] value    The element.
+             *
+             *  @return True if the priority queue contains the element, false otherwise.
+             */
+            bool contains(const ValueType & value) const
+            {
+                return static_cast<std::size_t>(value) < bucketOf_.size() && bucketOf_[value] != UNUSED;
+            }
+
+            /**
+             *  Access the priority of a specific element.
+             *
+             *  @param[in] value    The element. It must be contained in the priority queue.
+             *
+             *  @return The priority of the element.
+             */
+            const PriorityType & priority(const ValueType & value) const
+            {
+                HTD_ASSERT(contains(value))
+
+                return buckets_[bucketOf_[value]].priority;
+            }
+
+            /**
+             *  Access the top element.
+             *
+             *  @return The top element.
+             */
+            const ValueType & top(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return topCollection()[0];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            const PriorityType & topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[heap_[0]].priority;
+            }
+
+            /**
+             *  Access the collection of elements with top priority.
+             *
+             *  @return The collection of elements with top priority.
+             */
+            const std::vector<ValueType> & topCollection(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[heap_[0]].values;
+            }
+
+            /**
+             *  Insert a new element with the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted. It must not be contained in the priority queue.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void push(const ValueType & value, const PriorityType & priority)
+            {
+                if (static_cast<std::size_t>(value) >= bucketOf_.size())
+                {
+                    bucketOf_.resize(static_cast<std::size_t>(value) + 1, UNUSED);
+                    positionOf_.resize(static_cast<std::size_t>(value) + 1, 0);
+                }
+
+                HTD_ASSERT(!contains(value))
+
+                insert(value, priority);
+
+                ++size_;
+            }
+
+            /**
+             *  Remove an arbitrary element of top priority.
+             */
+            void pop(void)
+            {
+                HTD_ASSERT(size_ > 0)
+
+                erase(top());
+            }
+
+            /**
+             *  Erase the specific element.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased, false otherwise.
+             */
+            bool erase(const ValueType & value)
+            {
+                bool ret = contains(value);
+
+                if (ret)
+                {
+                    remove(value);
+
+                    --size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the top collection.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the top collection, false otherwise.
+             */
+            bool eraseFromTopCollection(const ValueType & value)
+            {
+                bool ret = size_ > 0 && contains(value) && bucketOf_[value] == heap_[0];
+
+                if (ret)
+                {
+                    remove(value);
+
+                    --size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Update the priority of a specific, existing element.
+             *
+             *  @param[in] value        The element which shall be updated.
+             *  @param[in] newPriority  The new priority of the element which shall be updated.
+             */
+            void updatePriority(const ValueType & value, const PriorityType & newPriority)
+            {
+                HTD_ASSERT(contains(value))
+
+                const PriorityType & oldPriority = buckets_[bucketOf_[value]].priority;
+
+                if (compare_(oldPriority, newPriority) || compare_(newPriority, oldPriority))
+                {
+                    remove(value);
+
+                    insert(value, newPriority);
+                }
+            }
+
+        private:
+            /**
+             *  Marker for elements which are not contained in the priority queue.
+             */
+            static const htd::index_t UNUSED = (htd::index_t)-1;
+
+            /**
+             *  Structure representing the collection of elements sharing the same priority.
+             */
+            struct Bucket
+            {
+                /**
+                 *  The priority of the elements.
+                 */
+                PriorityType priority;
+
+                /**
+                 *  The elements of the given priority.
+                 */
+                std::vector<ValueType> values;
+
+                /**
+                 *  The position of the bucket within the heap.
+                 */
+                htd::index_t heapPosition;
+            };
+
+            /**
+             *  A comparison operator on which the heap is based.
+             */
+            Compare compare_;
+
+            /**
+             *  The heap of buckets, given as indices into the vector of buckets.
+             */
+            std::vector<htd::index_t> heap_;
+
+            /**
+             *  The pool of buckets.
+             */
+            std::vector<Bucket> buckets_;
+
+            /**
+             *  The indices of all unused buckets of the pool.
+             */
+            std::vector<htd::index_t> freeBuckets_;
+
+            /**
+             *  A map for fast lookup of the bucket of a given priority.
+             */
+            std::unordered_map<PriorityType, htd::index_t> bucketIds_;
+
+            /**
+             *  The index of the bucket of each element.
+             */
+            std::vector<htd::index_t> bucketOf_;
+
+            /**
+             *  The position of each element within its bucket.
+             */
+            std::vector<htd::index_t> positionOf_;
+
+            /**
+             *  The number of elements stored on the heap.
+             */
+            std::size_t size_;
+
+            /**
+             *  Insert an element into the bucket of the given priority, creating the bucket if necessary.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void insert(const ValueType & value, const PriorityType & priority)
+            {
+                htd::index_t bucketId = 0;
+
+                auto position = bucketIds_.find(priority);
+
+                if (position != bucketIds_.end())
+                {
+                    bucketId = position->second;
+                }
+                else
+                {
+                    if (freeBuckets_.empty())
+                    {
+                        bucketId = buckets_.size();
+
+                        buckets_.emplace_back();
+                    }
+                    else
+                    {
+                        bucketId = freeBuckets_.back();
+
+                        freeBuckets_.pop_back();
+                    }
+
+                    Bucket & bucket = buckets_[bucketId];
+
+                    bucket.priority = priority;
+                    bucket.heapPosition = heap_.size();
+
+                    heap_.push_back(bucketId);
+
+                    bucketIds_.emplace(priority, bucketId);
+
+                    siftUp(bucket.heapPosition);
+                }
+
+                std::vector<ValueType> & values = buckets_[bucketId].values;
+
+                bucketOf_[value] = bucketId;
+                positionOf_[value] = values.size();
+
+                values.push_back(value);
+            }
+
+            /**
+             *  Remove an element from its bucket and release the bucket if it becomes empty.
+             *
+             *  @param[in] value    The element which shall be removed.
+             */
+            void remove(const ValueType & value)
+            {
+                htd::index_t bucketId = bucketOf_[value];
+
+                Bucket & bucket = buckets_[bucketId];
+
+                std::vector<ValueType> & values = bucket.values;
+
+                htd::index_t position = positionOf_[value];
+
+                ValueType lastValue = values.back();
+
+                values[position] = lastValue;
+
+                positionOf_[lastValue] = position;
+
+                values.pop_back();
+
+                bucketOf_[value] = UNUSED;
+
+                if (values.empty())
+                {
+                    htd::index_t heapPosition = bucket.heapPosition;
+
+                    bucketIds_.erase(bucket.priority);
+
+                    freeBuckets_.push_back(bucketId);
+
+                    htd::index_t movedBucket = heap_.back();
+
+                    heap_.pop_back();
+
+                    if (heapPosition < heap_.size())
+                    {
+                        heap_[heapPosition] = movedBucket;
+
+                        buckets_[movedBucket].heapPosition = heapPosition;
+
+                        siftDown(siftUp(heapPosition));
+                    }
+                }
+            }
+
+            /**
+             *  Promote the bucket at the given heap position up the tree until the heap invariant is restored.
+             *
+             *  @param[in] position The heap position of the bucket.
+             *
+             *  @return The new heap position of the bucket.
+             */
+            htd::index_t siftUp(htd::index_t position)
+            {
+                htd::index_t bucketId = heap_[position];
+
+                const PriorityType & priority = buckets_[bucketId].priority;
+
+                while (position > 0)
+                {
+                    htd::index_t parent = (position - 1) >> 1;
+
+                    htd::index_t parentBucketId = heap_[parent];
+
+                    if (!compare_(buckets_[parentBucketId].priority, priority))
+                    {
+                        break;
+                    }
+
+                    heap_[position] = parentBucketId;
+
+                    buckets_[parentBucketId].heapPosition = position;
+
+                    position = parent;
+                }
+
+                heap_[position] = bucketId;
+
+                buckets_[bucketId].heapPosition = position;
+
+                return position;
+            }
+
+            /**
+             *  Demote the bucket at the given heap position down the tree until the heap invariant is restored.
+             *
+             *  @param[in] position The heap position of the bucket.
+             *
+             *  @return The new heap position of the bucket.
+             */
+            htd::index_t siftDown(htd::index_t position)
+            {
+                htd::index_t bucketId = heap_[position];
+
+                const PriorityType & priority = buckets_[bucketId].priority;
+
+                std::size_t heapSize = heap_.size();
+
+                while ((position << 1) + 1 < heapSize)
+                {
+                    htd::index_t child = (position << 1) + 1;
+
+                    if (child + 1 < heapSize && compare_(buckets_[heap_[child]].priority, buckets_[heap_[child + 1]].priority))
+                    {
+                        ++child;
+                    }
+
+                    htd::index_t childBucketId = heap_[child];
+
+                    if (!compare_(priority, buckets_[childBucketId].priority))
+                    {
+                        break;
+                    }
+
+                    heap_[position] = childBucketId;
+
+                    buckets_[childBucketId].heapPosition = position;
+
+                    position = child;
+                }
+
+                heap_[position] = bucketId;
+
+                buckets_[bucketId].heapPosition = position;
+
+                return position;
+            }
+    };
+
+    template < typename ValueType, typename PriorityType, typename Compare >
+    const htd::index_t IndexedPriorityQueue<ValueType, PriorityType, Compare>::UNUSED;
+}
+
+#endif /* HTD_HTD_INDEXEDPRIORITYQUEUE_HPP */
@@ -187,6 +187,53 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of threads which are used to perform the iterations of the algorithm.
+             *
+             *  @return The number of threads which are used to perform the iterations of the algorithm.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to perform the iterations of the algorithm.
+             *
+             *  The iterations are always performed on worker threads, even if only a single thread is requested. Each worker
+             *  thread uses its own clone of the base decomposition algorithm and its random number generator is seeded before
+             *  each iteration with a seed depending only on the index of the iteration and the first pseudo-random number drawn
+             *  from htd::randomNumber() by the calling thread. The results are evaluated strictly in the order of the iterations,
+             *  i.e., for a fixed seed, the result depends neither on the number of threads nor on their scheduling.
+             *
+             *  @note The base decomposition algorithm, the fitness function and the manipulation operations must not rely
+             *  on mutable state shared between their clones when more than one thread is used. The progress callback is
+             *  invoked on the worker threads, but never concurrently.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to perform the iterations of the algorithm.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            /**
+             *  Check whether the candidate decompositions are evaluated by their maximum bag size before they are post-processed.
+             *
+             *  @return True if the candidate decompositions are evaluated by their maximum bag size before they are post-processed, false otherwise.
+             */
+            HTD_API bool isWidthOnlyEvaluationEnabled(void) const;
+
+            /**
+             *  Set whether the candidate decompositions shall be evaluated by their maximum bag size before they are post-processed.
+             *
+             *  When this mode is enabled, only candidates whose maximum bag size (BEFORE the manipulation operations are applied)
+             *  is strictly smaller than the one of the best decomposition found so far are post-processed and passed to the fitness
+             *  function and the progress callback, all other candidates count as iterations without improvement. If the base
+             *  algorithm is a htd::BucketEliminationTreeDecompositionAlgorithm, the maximum bag size is determined by the width-limited
+             *  ordering algorithm and the non-improving candidates are not even materialized.
+             *
+             *  @note This mode is intended for fitness functions which prefer decompositions of smaller width. Candidates with the
+             *  same width as the best decomposition found so far are discarded even if the fitness function would rate them better.
+             *
+             *  @param[in] widthOnlyEvaluationEnabled   A boolean flag whether the candidate decompositions shall be evaluated by their maximum bag size before they are post-processed.
+             */
+            HTD_API void setWidthOnlyEvaluationEnabled(bool widthOnlyEvaluationEnabled);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -204,9 +204,10 @@ namespace htd
             HTD_API htd::id_t id(void) const;
 
             /**
-             *  Check whether the terminate(int) function was called.
+             *  Check whether the terminate(int) function was called or whether the cancellation token
+             *  attached to the calling thread via htd::CancellationScope is cancelled.
              *
-             *  @return True if the terminate(int) function was called, false otherwise.
+             *  @return True if the terminate(int) function was called or if the cancellation token attached to the calling thread is cancelled, false otherwise.
              */
             HTD_API bool isTerminated(void) const;
 
@@ -26,14 +26,18 @@
 #define HTD_HTD_MAXIMUMCARDINALITYSEARCHORDERINGALGORITHM_HPP
 
 #include <htd/Globals.hpp>
-#include <htd/IOrderingAlgorithm.hpp>
+#include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 
 namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface based on the maximum-cardinality search elimination ordering algorithm.
+     *
+     *  The unnumbered vertices are kept in an array partitioned into buckets of equal cardinality, so the search runs in
+     *  O(n + m) time. The maximum bag size of the resulting ordering is computed from the column counts of its elimination
+     *  tree in almost linear time, i.e., the fill edges are never constructed.
      */
-    class MaximumCardinalitySearchOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
+    class MaximumCardinalitySearchOrderingAlgorithm : public virtual htd::IWidthLimitableOrderingAlgorithm
     {
         public:
             /**
@@ -47,8 +51,30 @@ namespace htd
             
             HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
             HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Check whether ties between vertices of maximum cardinality are broken randomly.
+             *
+             *  @return True if ties between vertices of maximum cardinality are broken randomly, false otherwise.
+             */
+            HTD_API bool isRandomTieBreakingEnabled(void) const;
+
+            /**
+             *  Set whether ties between vertices of maximum cardinality shall be broken randomly.
+             *
+             *  When random tie-breaking is disabled (it is enabled by default), the vertex at the front of the bucket of maximum
+             *  cardinality is numbered next. Vertices enter a bucket at its front, so the search deterministically prefers the
+             *  vertices whose cardinality was increased last and thus stays close to the part of the graph it explored last.
+             *
+             *  @param[in] randomTieBreakingEnabled A boolean flag indicating whether ties between vertices of maximum cardinality shall be broken randomly.
+             */
+            HTD_API void setRandomTieBreakingEnabled(bool randomTieBreakingEnabled);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -59,6 +85,8 @@ namespace htd
             HTD_API MaximumCardinalitySearchOrderingAlgorithm * clone(void) const;
 
             HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitableOrderingAlgorithm * cloneWidthLimitableOrderingAlgorithm(void) const HTD_OVERRIDE;
 #endif
 
         protected:
@@ -26,6 +26,7 @@
 #define HTD_HTD_MINIMUMSEPARATORALGORITHM_HPP
 
 #include <htd/IGraphSeparatorAlgorithm.hpp>
+#include <htd/IMaxFlowAlgorithm.hpp>
 
 namespace htd
 {
@@ -49,6 +50,37 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> * computeSeparator(const htd::IGraphStructure & graph) const HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which are used to evaluate the pairs of vertices.
+             *
+             *  @return The number of threads which are used to evaluate the pairs of vertices.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to evaluate the pairs of vertices.
+             *
+             *  When more than one thread is used, the pairs sharing the same first vertex are evaluated concurrently, each thread
+             *  using its own residual network. Among all minimum separators found, the one computed for the smallest pair of
+             *  vertices is returned, i.e., the result does not depend on the number of threads or on their scheduling.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to evaluate the pairs of vertices.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            /**
+             *  Set the maximum flow algorithm which shall be used to separate the pairs of vertices.
+             *
+             *  By default, an instance of htd::DinitzMaxFlowAlgorithm is used.
+             *
+             *  @param[in] algorithm    The maximum flow algorithm which shall be used to separate the pairs of vertices.
+             *
+             *  @note When calling this method the control over the memory region of the maximum flow algorithm is transferred to the
+             *  separator algorithm. Deleting the maximum flow algorithm provided to this method outside the separator algorithm or
+             *  assigning the same maximum flow algorithm multiple times will lead to undefined behavior.
+             */
+            HTD_API void setMaxFlowAlgorithm(htd::IMaxFlowAlgorithm * algorithm);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -28,6 +28,7 @@
 #include <htd/IMutableMultiHypergraph.hpp>
 #include <htd/LibraryInstance.hpp>
 
+#include <utility>
 #include <vector>
 #include <unordered_set>
 
@@ -103,6 +104,8 @@ namespace htd
 
             HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
             
             HTD_API bool isConnected(void) const HTD_OVERRIDE;
@@ -117,6 +120,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API std::size_t isolatedVertexCount(void) const HTD_OVERRIDE;
@@ -153,6 +158,17 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_OVERRIDE;
 
+            /**
+             *  Add a collection of new edges with two endpoints each to the multi-hypergraph.
+             *
+             *  The new edges get consecutive IDs in the order in which they occur in the given vector. In contrast to
+             *  repeated calls of addEdge(htd::vertex_t, htd::vertex_t), the neighborhoods of the affected vertices
+             *  are sorted only once, which makes this method considerably faster for large collections of edges.
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             */
+            HTD_API void addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
             HTD_API htd::id_t addEdge(const std::vector<htd::vertex_t> & elements) HTD_OVERRIDE;
 
             HTD_API htd::id_t addEdge(std::vector<htd::vertex_t> && elements) HTD_OVERRIDE;
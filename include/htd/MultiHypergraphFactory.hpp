@@ -80,6 +80,15 @@ namespace htd
              *  @return A new IMutableMultiHypergraph object of the given size.
              */
             HTD_API htd::IMutableMultiHypergraph * createInstance(std::size_t initialSize) const;
+
+            /**
+             *  Create a new, immutable IMultiHypergraph object which stores its neighborhoods and hyperedges in compressed sparse row format.
+             *
+             *  @param[in] original The original graph acting as template for the created graph.
+             *
+             *  @return A new htd::CompactMultiHypergraph object identical to the given original graph.
+             */
+            HTD_API htd::IMultiHypergraph * createCompactInstance(const htd::IMultiHypergraph & original) const;
     };
 }
 
@@ -0,0 +1,77 @@
+/*
+ * File:   ParallelExecution.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_PARALLELEXECUTION_HPP
+#define HTD_HTD_PARALLELEXECUTION_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace htd
+{
+    /**
+     *  Run the given worker function on the given number of new threads and wait until all of them are finished.
+     *
+     *  Each worker thread observes the cancellation token which is attached to the calling thread (see htd::CancellationScope)
+     *  and the random number generator which is local to a worker thread is reset before the thread terminates.
+     *
+     *  @param[in] workerCount  The number of worker threads.
+     *  @param[in] worker       The function which is called on each worker thread with the index of the worker (0 to workerCount-1).
+     */
+    HTD_API void executeWorkers(std::size_t workerCount, const std::function<void(htd::index_t)> & worker);
+
+    /**
+     *  Execute the tasks 0 to taskCount-1 using the given number of threads and wait until all of them are finished.
+     *
+     *  The tasks are distributed via work-stealing: Each worker initially owns a contiguous range of the tasks and takes
+     *  them from the front of its range. An idle worker steals the last task of the range of another worker. If only a
+     *  single thread is requested, the tasks are executed in ascending order on the calling thread. No further tasks are
+     *  started once the cancellation token attached to the calling thread is cancelled.
+     *
+     *  @param[in] taskCount    The number of tasks.
+     *  @param[in] threadCount  The maximum number of threads.
+     *  @param[in] task         The function which is called for each task with the index of the executing worker and the index of the task.
+     */
+    HTD_API void parallelFor(std::size_t taskCount, std::size_t threadCount, const std::function<void(htd::index_t, htd::index_t)> & task);
+
+    /**
+     *  Execute the tasks 0 to taskCount-1 like htd::parallelFor(std::size_t, std::size_t, const std::function<void(htd::index_t, htd::index_t)> &),
+     *  but seed the random number generator which is local to the executing thread before each task.
+     *
+     *  The seed of a task is derived from its index and a single number which is drawn via htd::randomNumber() by the
+     *  calling thread. Hence, the results of randomized tasks are reproducible and independent of the number of threads
+     *  and the order in which the tasks are executed. The tasks are always executed on worker threads so that the random
+     *  number generator of the calling thread remains untouched.
+     *
+     *  @param[in] taskCount    The number of tasks.
+     *  @param[in] threadCount  The maximum number of threads.
+     *  @param[in] task         The function which is called for each task with the index of the executing worker and the index of the task.
+     */
+    HTD_API void seededParallelFor(std::size_t taskCount, std::size_t threadCount, const std::function<void(htd::index_t, htd::index_t)> & task);
+}
+
+#endif /* HTD_HTD_PARALLELEXECUTION_HPP */
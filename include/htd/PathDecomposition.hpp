@@ -26,11 +26,11 @@
 #define HTD_HTD_PATHDECOMPOSITION_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/BagStorage.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/IMutablePathDecomposition.hpp>
 #include <htd/LabeledPath.hpp>
 
-#include <unordered_map>
 
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
@@ -293,9 +293,7 @@ namespace htd
 #endif
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
-
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            htd::BagStorage bagStorage_;
     };
 }
 
@@ -91,6 +91,8 @@ namespace htd
 
             HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
@@ -109,6 +111,8 @@ namespace htd
 
             HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
 
+            HTD_API htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE;
+
             HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
             HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE;
@@ -191,6 +195,22 @@ namespace htd
 
             HTD_API std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            HTD_API const htd::DenseAdjacencyMatrix * denseAdjacencyMatrix(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Create the dense adjacency matrix of the remaining vertices if the dense representation
+             *  is recommended for the current graph and release the existing one otherwise.
+             *
+             *  @note Any modification of the preprocessed graph releases the dense adjacency matrix,
+             *  hence this method has to be called again after the last modification.
+             */
+            HTD_API void updateDenseAdjacencyMatrix(void);
+
+            /**
+             *  Release the dense adjacency matrix of the remaining vertices.
+             */
+            HTD_API void releaseDenseAdjacencyMatrix(void);
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API PreprocessedGraph * clone(void) const HTD_OVERRIDE;
 #else
@@ -0,0 +1,335 @@
+/*
+ * File:   ResidualNetwork.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_RESIDUALNETWORK_HPP
+#define HTD_HTD_RESIDUALNETWORK_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IFlow.hpp>
+#include <htd/IFlowNetworkStructure.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Array-based residual network of a flow network.
+     *
+     *  For each pair of vertices which is connected in at least one direction, the residual network contains one arc in
+     *  each direction and each arc knows the position of its opposite arc. The arcs leaving a vertex are stored consecutively
+     *  in ascending order of their targets (compressed sparse row format). The flow on an arc is the net flow, i.e., the flow
+     *  on an arc is the negated flow on its opposite arc.
+     *
+     *  Additionally, the residual network provides scratch buffers for maximum flow algorithms, hence repeated computations
+     *  on the same residual network do not need to allocate any memory.
+     *
+     *  @note The vertices of the flow network must be the consecutive integers 0, 1, ..., n - 1.
+     */
+    class ResidualNetwork
+    {
+        public:
+            /**
+             *  Constructor for a residual network.
+             *
+             *  @param[in] flowNetwork  The underlying flow network.
+             */
+            HTD_API ResidualNetwork(const htd::IFlowNetworkStructure & flowNetwork);
+
+            /**
+             *  Destructor of a residual network.
+             */
+            HTD_API ~ResidualNetwork();
+
+            /**
+             *  Getter for the number of vertices of the residual network.
+             *
+             *  @return The number of vertices of the residual network.
+             */
+            std::size_t vertexCount(void) const
+            {
+                return arcOffsets_.size() - 1;
+            }
+
+            /**
+             *  Getter for the number of arcs of the residual network.
+             *
+             *  @return The number of arcs of the residual network.
+             */
+            std::size_t arcCount(void) const
+            {
+                return arcTargets_.size();
+            }
+
+            /**
+             *  Getter for the position of the first arc leaving the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The position of the first arc leaving the given vertex.
+             */
+            htd::index_t firstArc(htd::vertex_t vertex) const
+            {
+                return arcOffsets_[vertex];
+            }
+
+            /**
+             *  Getter for the position after the last arc leaving the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The position after the last arc leaving the given vertex.
+             */
+            htd::index_t endArc(htd::vertex_t vertex) const
+            {
+                return arcOffsets_[vertex + 1];
+            }
+
+            /**
+             *  Getter for the target vertex of an arc.
+             *
+             *  @param[in] arc  The position of the arc.
+             *
+             *  @return The target vertex of the arc.
+             */
+            htd::vertex_t arcTarget(htd::index_t arc) const
+            {
+                return arcTargets_[arc];
+            }
+
+            /**
+             *  Getter for the position of the opposite arc of an arc.
+             *
+             *  @param[in] arc  The position of the arc.
+             *
+             *  @return The position of the opposite arc of the arc.
+             */
+            htd::index_t oppositeArc(htd::index_t arc) const
+            {
+                return oppositeArcs_[arc];
+            }
+
+            /**
+             *  Getter for the residual capacity of an arc.
+             *
+             *  @param[in] arc  The position of the arc.
+             *
+             *  @return The residual capacity of the arc.
+             */
+            std::size_t residualCapacity(htd::index_t arc) const
+            {
+                return residualCapacities_[arc];
+            }
+
+            /**
+             *  Getter for the (net) flow on an arc.
+             *
+             *  @param[in] arc  The position of the arc.
+             *
+             *  @return The (net) flow on the arc.
+             */
+            long long flow(htd::index_t arc) const
+            {
+                return static_cast<long long>(effectiveCapacities_[arc]) - static_cast<long long>(residualCapacities_[arc]);
+            }
+
+            /**
+             *  Push flow along an arc.
+             *
+             *  @param[in] arc      The position of the arc.
+             *  @param[in] amount   The amount of flow which shall be pushed. The amount must not exceed the residual capacity of the arc.
+             */
+            void push(htd::index_t arc, std::size_t amount)
+            {
+                HTD_ASSERT(amount <= residualCapacities_[arc])
+
+                residualCapacities_[arc] -= amount;
+                residualCapacities_[oppositeArcs_[arc]] += amount;
+            }
+
+            /**
+             *  Remove the flow from all arcs.
+             *
+             *  @param[in] capacityLimit    The value to which the capacities of the arcs shall be limited. Limiting the capacities to an upper bound for the value of the maximum flow does not change the value of the maximum flow, but it prevents overflows in case of huge capacities.
+             */
+            HTD_API void reset(std::size_t capacityLimit);
+
+            /**
+             *  Compute an upper bound for the value of the maximum flow between two vertices.
+             *
+             *  The bound is the minimum of the capacity leaving the source vertex, the capacity entering the target vertex and
+             *  the total capacity of all arcs whose capacity is not (std::size_t)-1.
+             *
+             *  @param[in] source   The source vertex.
+             *  @param[in] target   The target vertex.
+             *
+             *  @note The bound is only valid if the value of the maximum flow is finite, i.e., if each path from the source to the target vertex contains an arc whose capacity is not (std::size_t)-1.
+             *
+             *  @return An upper bound for the value of the maximum flow between the two vertices.
+             */
+            HTD_API std::size_t computeCapacityBound(htd::vertex_t source, htd::vertex_t target) const;
+
+            /**
+             *  Getter for the (net) flow entering a vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The (net) flow entering the vertex.
+             */
+            HTD_API long long inflow(htd::vertex_t vertex) const;
+
+            /**
+             *  Create a flow object representing the current flow of the residual network.
+             *
+             *  @param[in] source   The source vertex of the flow.
+             *  @param[in] target   The target vertex of the flow.
+             *
+             *  @return A new flow object representing the current flow of the residual network.
+             */
+            HTD_API htd::IFlow * createFlow(htd::vertex_t source, htd::vertex_t target) const;
+
+            /**
+             *  Access the scratch buffer for the labels (e.g. distances or heights) of the vertices.
+             *
+             *  @return The scratch buffer for the labels of the vertices. The buffer contains one entry per vertex.
+             */
+            std::vector<std::size_t> & labels(void)
+            {
+                return labels_;
+            }
+
+            /**
+             *  Access the scratch buffer for the excesses of the vertices.
+             *
+             *  @return The scratch buffer for the excesses of the vertices. The buffer contains one entry per vertex.
+             */
+            std::vector<std::size_t> & excesses(void)
+            {
+                return excesses_;
+            }
+
+            /**
+             *  Access the scratch buffer for the current arcs of the vertices.
+             *
+             *  @return The scratch buffer for the current arcs of the vertices. The buffer contains one entry per vertex.
+             */
+            std::vector<htd::index_t> & currentArcs(void)
+            {
+                return currentArcs_;
+            }
+
+            /**
+             *  Access the scratch buffer for queues of vertices.
+             *
+             *  @return The scratch buffer for queues of vertices. The buffer contains one entry per vertex.
+             */
+            std::vector<htd::vertex_t> & vertexQueue(void)
+            {
+                return vertexQueue_;
+            }
+
+            /**
+             *  Access the scratch buffer for paths and other sequences of indices.
+             *
+             *  @return The scratch buffer for paths and other sequences of indices. The buffer is initially empty and its capacity suffices for a sequence of all vertices.
+             */
+            std::vector<htd::index_t> & arcPath(void)
+            {
+                return arcPath_;
+            }
+
+            /**
+             *  Access the scratch buffer for marking vertices.
+             *
+             *  @return The scratch buffer for marking vertices. The buffer contains one entry per vertex.
+             */
+            std::vector<char> & marks(void)
+            {
+                return marks_;
+            }
+
+        private:
+            /**
+             *  The position of the first arc of each vertex. The vector contains one entry more than there are vertices.
+             */
+            std::vector<htd::index_t> arcOffsets_;
+
+            /**
+             *  The target vertex of each arc.
+             */
+            std::vector<htd::vertex_t> arcTargets_;
+
+            /**
+             *  The position of the opposite arc of each arc.
+             */
+            std::vector<htd::index_t> oppositeArcs_;
+
+            /**
+             *  The capacity of each arc.
+             */
+            std::vector<std::size_t> capacities_;
+
+            /**
+             *  The capacity of each arc after applying the capacity limit of the last reset.
+             */
+            std::vector<std::size_t> effectiveCapacities_;
+
+            /**
+             *  The residual capacity of each arc.
+             */
+            std::vector<std::size_t> residualCapacities_;
+
+            /**
+             *  The scratch buffer for the labels of the vertices.
+             */
+            std::vector<std::size_t> labels_;
+
+            /**
+             *  The scratch buffer for the excesses of the vertices.
+             */
+            std::vector<std::size_t> excesses_;
+
+            /**
+             *  The scratch buffer for the current arcs of the vertices.
+             */
+            std::vector<htd::index_t> currentArcs_;
+
+            /**
+             *  The scratch buffer for queues of vertices.
+             */
+            std::vector<htd::vertex_t> vertexQueue_;
+
+            /**
+             *  The scratch buffer for paths.
+             */
+            std::vector<htd::index_t> arcPath_;
+
+            /**
+             *  The scratch buffer for marking vertices.
+             */
+            std::vector<char> marks_;
+    };
+}
+
+#endif /* HTD_HTD_RESIDUALNETWORK_HPP */
@@ -120,6 +120,47 @@ namespace htd
              */
             HTD_API void setGraphSeparatorAlgorithm(htd::IGraphSeparatorAlgorithm * algorithm);
 
+            /**
+             *  Check whether the input graph is decomposed recursively.
+             *
+             *  @return True if the input graph is decomposed recursively, false if a trivial decomposition is refined via htd::WidthReductionOperation.
+             */
+            HTD_API bool isRecursiveDecompositionEnabled(void) const;
+
+            /**
+             *  Set whether the input graph shall be decomposed recursively.
+             *
+             *  By default, the algorithm refines a trivial decomposition via htd::WidthReductionOperation on the calling thread.
+             *  When the recursive decomposition is enabled, the input graph is decomposed recursively instead: After a separator
+             *  of the current subgraph was removed, each of the remaining components, extended by the separator (which is turned
+             *  into a clique), forms a new subgraph which is decomposed by its own task. The tasks are distributed to the worker
+             *  threads by a work-stealing scheduler and the decompositions of the subgraphs are joined after all tasks finished.
+             *  The random number generator is seeded for each task with a seed depending only on the position of the task in the
+             *  recursion and on the first pseudo-random number drawn from htd::randomNumber() by the calling thread, i.e., for a
+             *  fixed seed, the result depends neither on the number of threads nor on their scheduling.
+             *
+             *  @note Both approaches operate on the input graph directly, i.e., a preprocessed graph provided to computeDecomposition() is not used and no preprocessing is performed otherwise.
+             *
+             *  @param[in] recursiveDecompositionEnabled    A boolean flag indicating whether the input graph shall be decomposed recursively.
+             */
+            HTD_API void setRecursiveDecompositionEnabled(bool recursiveDecompositionEnabled);
+
+            /**
+             *  Getter for the number of threads which are used to decompose the subgraphs resulting from the separators.
+             *
+             *  @return The number of threads which are used to decompose the subgraphs resulting from the separators.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to decompose the subgraphs resulting from the separators.
+             *
+             *  @note The thread count only applies if the recursive decomposition is enabled, see setRecursiveDecompositionEnabled().
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to decompose the subgraphs resulting from the separators.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API void setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
 
             HTD_API void addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation) HTD_OVERRIDE;
@@ -26,11 +26,11 @@
 #define HTD_HTD_TREEDECOMPOSITION_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/BagStorage.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/LabeledTree.hpp>
 
-#include <unordered_map>
 
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
@@ -294,9 +294,7 @@ namespace htd
             void getChildBagSetUnion(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const;
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
-
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            htd::BagStorage bagStorage_;
     };
 }
 
@@ -27,6 +27,7 @@
 
 #include <htd/Globals.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
+#include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
 
 namespace htd
 {
@@ -73,6 +74,17 @@ namespace htd
              */
             HTD_API void setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm);
 
+            /**
+             *  Set the algorithm which shall be used to compute the minimal triangulations deciding which fill edges are redundant.
+             *
+             *  @param[in] algorithm    The algorithm which shall be used to compute the minimal triangulations.
+             *
+             *  @note When calling this method the control over the memory region of the triangulation algorithm is transferred to the
+             *  ordering algorithm. Deleting the triangulation algorithm provided to this method outside the current ordering algorithm or
+             *  assigning the same triangulation algorithm multiple times will lead to undefined behavior.
+             */
+            HTD_API void setMinimalTriangulationAlgorithm(htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm * algorithm);
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API TriangulationMinimizationOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
 #else
@@ -37,6 +37,10 @@ namespace htd
      *  Implementation of the ITreeDecompositionAlgorithm interface which
      *  returns the trivial tree decomposition consisting of only one bag
      *  which captures the whole graph.
+     *
+     *  @note The construction of the trivial decomposition itself never observes a termination request. The algorithm is
+     *  therefore safely interruptible as long as no global manipulation operations are assigned to it, which makes it a
+     *  suitable fallback for width-minimizing algorithms which are interrupted before finding their first decomposition.
      */
     class TrivialTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
     {
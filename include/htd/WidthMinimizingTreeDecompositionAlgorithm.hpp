@@ -32,6 +32,7 @@
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
 
+#include <chrono>
 #include <vector>
 #include <functional>
 
@@ -251,6 +252,22 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the wall-clock time limit of the algorithm (0=unlimited).
+             *
+             *  @return The wall-clock time limit of the algorithm.
+             */
+            HTD_API std::chrono::milliseconds timeLimit(void) const;
+
+            /**
+             *  Set the wall-clock time limit of the algorithm (0=unlimited).
+             *
+             *  @note When the time limit is exceeded, the algorithm stops and returns the best decomposition found so far. The overshoot is bounded by the time between two consecutive termination checks of the underlying algorithms.
+             *
+             *  @param[in] timeLimit    The wall-clock time limit of the algorithm.
+             */
+            HTD_API void setTimeLimit(std::chrono::milliseconds timeLimit);
+
             /**
              *  Check whether the computed decompositions shall contain only subset-maximal bags.
              *
@@ -30,15 +30,22 @@
 #include <htd/AddEmptyRootOperation.hpp>
 #include <htd/AddIdenticalJoinNodeParentOperation.hpp>
 #include <htd/Algorithm.hpp>
+#include <htd/ApproximateMinDegreeOrderingAlgorithm.hpp>
 #include <htd/AssemblyInfo.hpp>
+#include <htd/AtomBasedTreeDecompositionAlgorithm.hpp>
+#include <htd/BagStorage.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/BucketQueue.hpp>
+#include <htd/CancellationScope.hpp>
+#include <htd/CancellationToken.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 #include <htd/Collection.hpp>
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
 #include <htd/CompressionOperation.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/ConstCollection.hpp>
@@ -46,6 +53,8 @@
 #include <htd/ConstIterator.hpp>
 #include <htd/ConstIteratorWrapper.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/ConstSpan.hpp>
+#include <htd/DenseAdjacencyMatrix.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
@@ -139,6 +148,7 @@
 #include <htd/IMutablePath.hpp>
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/IMutableTree.hpp>
+#include <htd/IndexedPriorityQueue.hpp>
 #include <htd/InducedSubgraphLabelingOperation.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPathDecompositionAlgorithm.hpp>
@@ -211,6 +221,7 @@
 #include <htd/NaturalOrderingAlgorithm.hpp>
 #include <htd/NormalizationOperation.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
+#include <htd/ParallelExecution.hpp>
 #include <htd/PathDecompositionAlgorithmFactory.hpp>
 #include <htd/PathDecompositionFactory.hpp>
 #include <htd/PathDecomposition.hpp>
@@ -221,8 +232,10 @@
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/PreprocessorDefinitions.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/PushRelabelMaxFlowAlgorithm.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
+#include <htd/ResidualNetwork.hpp>
 #include <htd/SemiNormalizationOperation.hpp>
 #include <htd/SeparatorBasedTreeDecompositionAlgorithm.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
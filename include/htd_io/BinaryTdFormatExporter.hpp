@@ -0,0 +1,78 @@
+/*
+ * File:   BinaryTdFormatExporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATEXPORTER_HPP
+#define HTD_IO_BINARYTDFORMATEXPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd_io/ITreeDecompositionExporter.hpp>
+
+#include <iostream>
+#include <memory>
+
+namespace htd_io
+{
+    /**
+     *  Exporter which allows to export tree decompositions in the binary tree decomposition format 'btd'.
+     *
+     *  The format is designed to be mapped into memory by downstream tools, see htd_io::BinaryTdFormatHeader
+     *  for a description of its layout and htd_io::BinaryTdFormatImporter for the corresponding reader.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available output formats.)
+     */
+    class BinaryTdFormatExporter : public htd_io::ITreeDecompositionExporter
+    {
+        public:
+            HTD_IO_API BinaryTdFormatExporter(void);
+
+            HTD_IO_API virtual ~BinaryTdFormatExporter();
+
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const HTD_OVERRIDE;
+
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const HTD_OVERRIDE;
+
+            /**
+             *  Check whether the IDs of the edges induced by the bags are written.
+             *
+             *  @return True if the IDs of the edges induced by the bags are written, false otherwise.
+             */
+            HTD_IO_API bool isInducedEdgeExportEnabled(void) const;
+
+            /**
+             *  Set whether the IDs of the edges induced by the bags shall be written.
+             *
+             *  @param[in] inducedEdgeExportEnabled A boolean flag indicating whether the IDs of the edges induced by the bags shall be written.
+             */
+            HTD_IO_API void setInducedEdgeExportEnabled(bool inducedEdgeExportEnabled);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_BINARYTDFORMATEXPORTER_HPP */
@@ -0,0 +1,73 @@
+/*
+ * File:   BinaryTdFormatImporter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATIMPORTER_HPP
+#define HTD_IO_BINARYTDFORMATIMPORTER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd_io/BinaryTreeDecomposition.hpp>
+
+#include <iostream>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Importer which allows to read tree decompositions in the binary tree decomposition format 'btd'.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available output formats.)
+     */
+    class BinaryTdFormatImporter
+    {
+        public:
+            HTD_IO_API BinaryTdFormatImporter(void);
+
+            HTD_IO_API virtual ~BinaryTdFormatImporter();
+
+            /**
+             *  Import a tree decomposition from the given file.
+             *
+             *  If possible, the file is mapped into memory and the returned decomposition directly accesses the mapped
+             *  content. Otherwise, the content of the file is read into memory once.
+             *
+             *  @param[in] path The path to the file which shall be imported.
+             *
+             *  @return A new decomposition object representing the content of the file or nullptr if the file does not contain a valid decomposition.
+             */
+            HTD_IO_API htd_io::BinaryTreeDecomposition * import(const std::string & path) const;
+
+            /**
+             *  Import a tree decomposition from the given stream.
+             *
+             *  @param[in] stream   The stream from which the decomposition shall be read.
+             *
+             *  @return A new decomposition object representing the content of the stream or nullptr if the stream does not contain a valid decomposition.
+             */
+            HTD_IO_API htd_io::BinaryTreeDecomposition * import(std::istream & stream) const;
+    };
+}
+
+#endif /* HTD_IO_BINARYTDFORMATIMPORTER_HPP */
@@ -0,0 +1,275 @@
+/*
+ * File:   BinaryTreeDecomposition.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTREEDECOMPOSITION_HPP
+#define HTD_IO_BINARYTREEDECOMPOSITION_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/ITreeDecomposition.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace htd_io
+{
+    /**
+     *  Header of a tree decomposition stored in the binary tree decomposition format 'btd'.
+     *
+     *  The header is followed by the sections
+     *
+     *  - bag offsets (nodeCount + 1 entries of type std::uint64_t),
+     *  - induced edge offsets (nodeCount + 1 entries of type std::uint64_t, only if FLAG_INDUCED_EDGES is set),
+     *  - parents (nodeCount entries of type std::uint32_t),
+     *  - bag contents (bagEntryCount entries of type std::uint32_t) and
+     *  - induced edges (inducedEdgeEntryCount entries of type std::uint32_t, only if FLAG_INDUCED_EDGES is set).
+     *
+     *  The nodes of the decomposition are numbered from 0 to nodeCount - 1 in post-order, i.e., each node
+     *  has a smaller index than its parent and the root is the node with index nodeCount - 1. The parent of
+     *  the root is NO_PARENT. The content of the bag of node i is stored at the positions bagOffsets[i], ...,
+     *  bagOffsets[i + 1] - 1 of the bag content section, the induced edges (given by their IDs) are stored
+     *  analogously. All values are stored in native byte order.
+     *
+     *  (See https://github.com/mabseher/htd/FORMATS.md for information about the available output formats.)
+     */
+    struct BinaryTdFormatHeader
+    {
+        /**
+         *  The magic bytes identifying the format.
+         */
+        char magic[8];
+
+        /**
+         *  The version of the format.
+         */
+        std::uint32_t version;
+
+        /**
+         *  The flags describing the optional sections which are present.
+         */
+        std::uint32_t flags;
+
+        /**
+         *  The number of nodes of the decomposition.
+         */
+        std::uint64_t nodeCount;
+
+        /**
+         *  The number of vertices of the decomposed graph.
+         */
+        std::uint64_t vertexCount;
+
+        /**
+         *  The maximum bag size of the decomposition.
+         */
+        std::uint64_t maximumBagSize;
+
+        /**
+         *  The total number of entries of all bags.
+         */
+        std::uint64_t bagEntryCount;
+
+        /**
+         *  The total number of induced edge entries of all bags.
+         */
+        std::uint64_t inducedEdgeEntryCount;
+
+        /**
+         *  Reserved for future use, always zero.
+         */
+        std::uint64_t reserved;
+
+        /**
+         *  The magic bytes identifying the format.
+         */
+        HTD_IO_API static const char MAGIC[8];
+
+        /**
+         *  The current version of the format.
+         */
+        HTD_IO_API static const std::uint32_t VERSION = 1;
+
+        /**
+         *  Flag indicating that the sections containing the induced edges are present.
+         */
+        HTD_IO_API static const std::uint32_t FLAG_INDUCED_EDGES = 1;
+
+        /**
+         *  The value stored as parent of the root node.
+         */
+        HTD_IO_API static const std::uint32_t NO_PARENT = 0xFFFFFFFF;
+    };
+
+    /**
+     *  Read-only view of a tree decomposition stored in the binary tree decomposition format 'btd'.
+     *
+     *  The view directly accesses the stored sections, i.e., if the decomposition was read from a file
+     *  which could be mapped into memory, no data is copied or parsed.
+     */
+    class BinaryTreeDecomposition
+    {
+        public:
+            /**
+             *  Constructor for a binary tree decomposition.
+             *
+             *  @param[in] data     The storage holding the decomposition. The storage is released when the binary tree decomposition is destroyed.
+             *  @param[in] size     The size of the storage in bytes.
+             *  @param[in] release  The function releasing the storage.
+             *
+             *  @note The storage must be aligned to an 8-byte boundary and it must contain a valid decomposition.
+             */
+            HTD_IO_API BinaryTreeDecomposition(const void * data, std::size_t size, const std::function<void(const void *, std::size_t)> & release);
+
+            HTD_IO_API virtual ~BinaryTreeDecomposition();
+
+            /**
+             *  Getter for the header of the decomposition.
+             *
+             *  @return The header of the decomposition.
+             */
+            HTD_IO_API const htd_io::BinaryTdFormatHeader & header(void) const;
+
+            /**
+             *  Getter for the number of nodes of the decomposition.
+             *
+             *  @return The number of nodes of the decomposition.
+             */
+            HTD_IO_API std::size_t nodeCount(void) const;
+
+            /**
+             *  Getter for the number of vertices of the decomposed graph.
+             *
+             *  @return The number of vertices of the decomposed graph.
+             */
+            HTD_IO_API std::size_t vertexCount(void) const;
+
+            /**
+             *  Getter for the maximum bag size of the decomposition.
+             *
+             *  @return The maximum bag size of the decomposition.
+             */
+            HTD_IO_API std::size_t maximumBagSize(void) const;
+
+            /**
+             *  Getter for the index of the root node.
+             *
+             *  @return The index of the root node. If the decomposition is empty, htd_io::BinaryTdFormatHeader::NO_PARENT is returned.
+             */
+            HTD_IO_API std::uint32_t root(void) const;
+
+            /**
+             *  Getter for the parent of a node.
+             *
+             *  @param[in] node The index of the node.
+             *
+             *  @return The index of the parent of the node or htd_io::BinaryTdFormatHeader::NO_PARENT if the node is the root.
+             */
+            HTD_IO_API std::uint32_t parent(std::uint32_t node) const;
+
+            /**
+             *  Access the parent array of the decomposition.
+             *
+             *  @return A pointer to the first entry of the parent array.
+             */
+            HTD_IO_API const std::uint32_t * parents(void) const;
+
+            /**
+             *  Getter for the size of the bag of a node.
+             *
+             *  @param[in] node The index of the node.
+             *
+             *  @return The size of the bag of the node.
+             */
+            HTD_IO_API std::size_t bagSize(std::uint32_t node) const;
+
+            /**
+             *  Access the content of the bag of a node.
+             *
+             *  @param[in] node The index of the node.
+             *
+             *  @return A pointer to the first vertex of the bag. The vertices of the bag are sorted in ascending order.
+             */
+            HTD_IO_API const std::uint32_t * bagContent(std::uint32_t node) const;
+
+            /**
+             *  Check whether the induced edges of the bags are available.
+             *
+             *  @return True if the induced edges of the bags are available, false otherwise.
+             */
+            HTD_IO_API bool hasInducedEdges(void) const;
+
+            /**
+             *  Getter for the number of edges induced by the bag of a node.
+             *
+             *  @param[in] node The index of the node.
+             *
+             *  @return The number of edges induced by the bag of the node.
+             */
+            HTD_IO_API std::size_t inducedEdgeCount(std::uint32_t node) const;
+
+            /**
+             *  Access the IDs of the edges induced by the bag of a node.
+             *
+             *  @param[in] node The index of the node.
+             *
+             *  @return A pointer to the ID of the first edge induced by the bag of the node.
+             */
+            HTD_IO_API const std::uint32_t * inducedEdges(std::uint32_t node) const;
+
+            /**
+             *  Create a tree decomposition with the same structure and bag contents as the current decomposition.
+             *
+             *  @param[in] manager  The management instance to which the new tree decomposition shall belong.
+             *
+             *  @return A new tree decomposition with the same structure and bag contents as the current decomposition.
+             *
+             *  @note The induced edges are not part of the new tree decomposition because the decomposed graph is not available.
+             */
+            HTD_IO_API htd::ITreeDecomposition * toTreeDecomposition(const htd::LibraryInstance * const manager) const;
+
+            /**
+             *  Check whether a memory region contains a valid decomposition in the binary tree decomposition format 'btd'.
+             *
+             *  @param[in] data The start of the memory region. It must be aligned to an 8-byte boundary.
+             *  @param[in] size The size of the memory region in bytes.
+             *
+             *  @return True if the memory region contains a valid decomposition, false otherwise.
+             */
+            HTD_IO_API static bool isValid(const void * data, std::size_t size);
+
+            BinaryTreeDecomposition(const BinaryTreeDecomposition & original) = delete;
+
+            BinaryTreeDecomposition & operator=(const BinaryTreeDecomposition & original) = delete;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_BINARYTREEDECOMPOSITION_HPP */
@@ -61,6 +61,8 @@ namespace htd_io
 
             HTD_IO_API void setPreprocessor(htd::IGraphPreprocessor * preprocessor) HTD_OVERRIDE;
 
+            HTD_IO_API void setCancellationToken(const std::shared_ptr<htd::CancellationToken> & token) HTD_OVERRIDE;
+
             HTD_IO_API void registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback) HTD_OVERRIDE;
 
             HTD_IO_API void registerPreprocessingCallback(const std::function<void(std::size_t vertexCount, std::size_t edgeCount)> & callback) HTD_OVERRIDE;
@@ -28,6 +28,7 @@
 #include <htd_io/PreprocessorDefinitions.hpp>
 
 #include <htd/IMultiGraph.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
 
 #include <string>
 #include <iostream>
@@ -70,6 +71,28 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiGraph * import(std::istream & stream) const;
 
+            /**
+             *  Create a new, immutable htd::CompactMultiHypergraph instance based on the information stored in a given file.
+             *
+             *  The edges are collected in flat arrays and the graph is built in one step without creating an intermediate mutable graph.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new htd::CompactMultiHypergraph instance based on the information stored in the given file.
+             */
+            HTD_IO_API htd::CompactMultiHypergraph * importCompact(const std::string & path) const;
+
+            /**
+             *  Create a new, immutable htd::CompactMultiHypergraph instance based on the information from a given stream.
+             *
+             *  The edges are collected in flat arrays and the graph is built in one step without creating an intermediate mutable graph.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             *
+             *  @return A new htd::CompactMultiHypergraph instance based on the information from the given stream.
+             */
+            HTD_IO_API htd::CompactMultiHypergraph * importCompact(std::istream & stream) const;
+
         private:
             struct Implementation;
 
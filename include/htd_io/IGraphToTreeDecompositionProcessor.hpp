@@ -27,11 +27,13 @@
 
 #include <htd_io/IGraphProcessor.hpp>
 
+#include <htd/CancellationToken.hpp>
 #include <htd/FitnessEvaluation.hpp>
 
 #include <string>
 #include <iostream>
 #include <functional>
+#include <memory>
 
 namespace htd_io
 {
@@ -57,6 +59,17 @@ namespace htd_io
              */
             virtual void setExporter(htd_io::ITreeDecompositionExporter * exporter) = 0;
 
+            /**
+             *  Set the cancellation token which is attached to the calling thread while the input graph is preprocessed and decomposed.
+             *
+             *  The resulting decomposition is exported after the token was detached again, i.e., a cancellation (e.g., because
+             *  the deadline of the token has passed) stops the computation but never interrupts the output of its result.
+             *
+             *  @param[in] token    The cancellation token which shall be attached to the calling thread. If it is nullptr, the
+             *                      token which is attached to the calling thread when the graph is processed is retained.
+             */
+            virtual void setCancellationToken(const std::shared_ptr<htd::CancellationToken> & token) = 0;
+
             /**
              *  Register a new callback function which is invoked after preprocessing the input graph.
              *
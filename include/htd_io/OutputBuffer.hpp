@@ -0,0 +1,257 @@
+/*
+ * File:   OutputBuffer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_OUTPUTBUFFER_HPP
+#define HTD_IO_OUTPUTBUFFER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace htd_io
+{
+    /**
+     *  Output buffer which collects formatted text in a large contiguous memory block and
+     *  forwards it to an output stream in few, large chunks.
+     *
+     *  Unsigned integers are converted to text directly within the buffer, i.e., without
+     *  using the formatting facilities of the output stream.
+     *
+     *  @note The buffered content is written to the output stream when the buffer is full,
+     *  when flush() is called and when the output buffer is destroyed.
+     */
+    class OutputBuffer
+    {
+        public:
+            /**
+             *  The default capacity of an output buffer in bytes.
+             */
+            static const std::size_t DEFAULT_CAPACITY = 1 << 16;
+
+            /**
+             *  Constructor of a new output buffer.
+             *
+             *  @param[in] outputStream The output stream to which the buffered content shall be written.
+             *  @param[in] capacity     The capacity of the output buffer in bytes.
+             */
+            OutputBuffer(std::ostream & outputStream, std::size_t capacity = DEFAULT_CAPACITY) : outputStream_(outputStream), buffer_(capacity > MAXIMUM_INTEGER_LENGTH ? capacity : static_cast<std::size_t>(MAXIMUM_INTEGER_LENGTH)), size_(0)
+            {
+
+            }
+
+            /**
+             *  Destructor of an output buffer.
+             */
+            ~OutputBuffer(void)
+            {
+                writeBuffer();
+            }
+
+            /**
+             *  Append a single character to the output buffer.
+             *
+             *  @param[in] character    The character which shall be appended.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(char character)
+            {
+                if (size_ == buffer_.size())
+                {
+                    writeBuffer();
+                }
+
+                buffer_[size_++] = character;
+
+                return *this;
+            }
+
+            /**
+             *  Append a sequence of characters to the output buffer.
+             *
+             *  @param[in] data     A pointer to the first character of the sequence.
+             *  @param[in] length   The number of characters in the sequence.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(const char * data, std::size_t length)
+            {
+                if (size_ + length > buffer_.size())
+                {
+                    writeBuffer();
+
+                    if (length > buffer_.size())
+                    {
+                        outputStream_.write(data, static_cast<std::streamsize>(length));
+
+                        return *this;
+                    }
+                }
+
+                std::memcpy(buffer_.data() + size_, data, length);
+
+                size_ += length;
+
+                return *this;
+            }
+
+            /**
+             *  Append a null-terminated string to the output buffer.
+             *
+             *  @param[in] text The null-terminated string which shall be appended.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(const char * text)
+            {
+                return append(text, std::strlen(text));
+            }
+
+            /**
+             *  Append a string to the output buffer.
+             *
+             *  @param[in] text The string which shall be appended.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(const std::string & text)
+            {
+                return append(text.data(), text.size());
+            }
+
+            /**
+             *  Append the decimal representation of an unsigned integer to the output buffer.
+             *
+             *  @param[in] value    The integer which shall be appended.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(unsigned long long value)
+            {
+                if (size_ + MAXIMUM_INTEGER_LENGTH > buffer_.size())
+                {
+                    writeBuffer();
+                }
+
+                char digits[MAXIMUM_INTEGER_LENGTH];
+
+                char * end = digits + MAXIMUM_INTEGER_LENGTH;
+
+                char * position = end;
+
+                do
+                {
+                    *(--position) = static_cast<char>('0' + value % 10);
+
+                    value /= 10;
+                }
+                while (value > 0);
+
+                std::size_t length = static_cast<std::size_t>(end - position);
+
+                std::memcpy(buffer_.data() + size_, position, length);
+
+                size_ += length;
+
+                return *this;
+            }
+
+            /**
+             *  Append the decimal representation of an unsigned integer to the output buffer.
+             *
+             *  @param[in] value    The integer which shall be appended.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(unsigned long value)
+            {
+                return append(static_cast<unsigned long long>(value));
+            }
+
+            /**
+             *  Append the decimal representation of an unsigned integer to the output buffer.
+             *
+             *  @param[in] value    The integer which shall be appended.
+             *
+             *  @return A reference to the output buffer.
+             */
+            OutputBuffer & append(unsigned int value)
+            {
+                return append(static_cast<unsigned long long>(value));
+            }
+
+            /**
+             *  Write the buffered content to the output stream and flush the output stream.
+             */
+            void flush(void)
+            {
+                writeBuffer();
+
+                outputStream_.flush();
+            }
+
+        private:
+            /**
+             *  The maximum number of characters of the decimal representation of an unsigned 64-bit integer.
+             */
+            static const std::size_t MAXIMUM_INTEGER_LENGTH = 20;
+
+            /**
+             *  The output stream to which the buffered content is written.
+             */
+            std::ostream & outputStream_;
+
+            /**
+             *  The memory block holding the buffered content.
+             */
+            std::vector<char> buffer_;
+
+            /**
+             *  The number of buffered characters.
+             */
+            std::size_t size_;
+
+            /**
+             *  Write the buffered content to the output stream and clear the buffer.
+             */
+            void writeBuffer(void)
+            {
+                if (size_ > 0)
+                {
+                    outputStream_.write(buffer_.data(), static_cast<std::streamsize>(size_));
+
+                    size_ = 0;
+                }
+            }
+
+            OutputBuffer(const OutputBuffer & original) = delete;
+
+            OutputBuffer & operator=(const OutputBuffer & original) = delete;
+    };
+}
+
+#endif /* HTD_IO_OUTPUTBUFFER_HPP */
@@ -25,6 +25,9 @@
 #ifndef HTD_IO_MAIN_HPP
 #define HTD_IO_MAIN_HPP
 
+#include <htd_io/BinaryTdFormatExporter.hpp>
+#include <htd_io/BinaryTdFormatImporter.hpp>
+#include <htd_io/BinaryTreeDecomposition.hpp>
 #include <htd_io/GrFormatGraphProcessor.hpp>
 #include <htd_io/GrFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/GrFormatImporter.hpp>
@@ -38,6 +41,7 @@
 #include <htd_io/ITreeDecompositionExporter.hpp>
 #include <htd_io/LpFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/LpFormatImporter.hpp>
+#include <htd_io/OutputBuffer.hpp>
 #include <htd_io/ParsingResult.hpp>
 #include <htd_io/TdFormatExporter.hpp>
 #include <htd_io/WidthExporter.hpp>
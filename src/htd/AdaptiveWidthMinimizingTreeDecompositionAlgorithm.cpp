@@ -28,6 +28,7 @@
 #include <htd/AdaptiveWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
 
+#include <htd/CancellationScope.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
@@ -44,7 +45,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), timeLimit_(0), computeInducedEdges_(true)
     {
 
     }
@@ -54,7 +55,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), timeLimit_(original.timeLimit_), computeInducedEdges_(original.computeInducedEdges_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -100,6 +101,11 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The wall-clock time limit of the algorithm (0=unlimited).
+     */
+    std::chrono::milliseconds timeLimit_;
+
     /**
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
@@ -214,6 +220,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -274,6 +282,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -310,6 +320,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     std::size_t bestMaxBagSize = maxBagSize;
 
     if (bestMaxBagSize != (std::size_t)-1)
@@ -640,6 +652,16 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::chrono::milliseconds htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::timeLimit(void) const
+{
+    return implementation_->timeLimit_;
+}
+
+void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setTimeLimit(std::chrono::milliseconds timeLimit)
+{
+    implementation_->timeLimit_ = timeLimit;
+}
+
 std::size_t htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::decisionRounds(void) const
 {
     return implementation_->decisionRounds_;
@@ -0,0 +1,529 @@
+/* 
+ * File:   ApproximateMinDegreeOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP
+#define HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ApproximateMinDegreeOrderingAlgorithm.hpp>
+#include <htd/BucketQueue.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <utility>
+
+/**
+ *  Private implementation details of class htd::ApproximateMinDegreeOrderingAlgorithm.
+ */
+struct htd::ApproximateMinDegreeOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The possible states of a node of the quotient graph.
+     */
+    enum NodeStatus
+    {
+        /**
+         *  The node is a principal variable, i.e., a not yet eliminated vertex representing a supervariable.
+         */
+        VARIABLE,
+
+        /**
+         *  The node is a vertex which was merged into another supervariable or which was eliminated together with a pivot.
+         */
+        INACTIVE_VARIABLE,
+
+        /**
+         *  The node is an element, i.e., an eliminated vertex whose neighborhood is still relevant.
+         */
+        ELEMENT,
+
+        /**
+         *  The node is an element which was absorbed by a newer element.
+         */
+        ABSORBED_ELEMENT
+    };
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+};
+
+htd::ApproximateMinDegreeOrderingAlgorithm::ApproximateMinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm::~ApproximateMinDegreeOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(graph.vertexCount());
+
+    std::size_t iterations = 0;
+
+    std::size_t currentMaxBagSize = (std::size_t)-1;
+
+    do
+    {
+        ordering.clear();
+
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
+
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+std::size_t htd::ApproximateMinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t ret = preprocessedGraph.minTreeWidth() + 1;
+
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::size_t size = remainingVertices.size();
+
+    /* The nodes of the quotient graph are identified by the positions of the remaining vertices. */
+    std::vector<htd::index_t> positions(preprocessedGraph.inputGraphVertexCount(), 0);
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        positions[remainingVertices[index]] = index;
+    }
+
+    std::vector<std::vector<htd::index_t>> variableNeighbors(size);
+    std::vector<std::vector<htd::index_t>> adjacentElements(size);
+    std::vector<std::vector<htd::index_t>> elementVariables(size);
+
+    std::vector<NodeStatus> status(size, VARIABLE);
+
+    std::vector<std::size_t> weight(size, 1);
+    std::vector<std::size_t> degree(size, 0);
+    std::vector<std::size_t> elementWeight(size, 0);
+
+    /* The weight of the part of an element which is not covered by the current pivot element, or -1 if it was not computed yet. */
+    std::vector<long> externalWeight(size, -1);
+
+    std::vector<std::size_t> mark(size, 0);
+
+    std::size_t currentMark = 0;
+
+    /* The vertices represented by a supervariable are stored as a linked list. */
+    std::vector<htd::index_t> nextMember(size, (htd::index_t)-1);
+    std::vector<htd::index_t> lastMember(size, 0);
+
+    std::vector<htd::index_t> pivotVariables;
+    std::vector<htd::index_t> touchedElements;
+    std::vector<std::pair<std::size_t, htd::index_t>> candidates;
+
+    htd::BucketQueue<htd::index_t, std::greater<std::size_t>> priorityQueue(size, size);
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        std::vector<htd::index_t> & currentNeighbors = variableNeighbors[index];
+
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(remainingVertices[index]))
+        {
+            currentNeighbors.push_back(positions[neighbor]);
+        }
+
+        degree[index] = currentNeighbors.size();
+
+        lastMember[index] = index;
+
+        priorityQueue.push(index, degree[index]);
+    }
+
+    std::size_t remainingWeight = size;
+
+    while (remainingWeight > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::index_t pivot = htd::selectRandomElement<htd::index_t>(priorityQueue.topCollection());
+
+        priorityQueue.eraseFromTopCollection(pivot);
+
+        ++currentMark;
+
+        mark[pivot] = currentMark;
+
+        pivotVariables.clear();
+
+        std::size_t pivotDegree = 0;
+
+        for (htd::index_t neighbor : variableNeighbors[pivot])
+        {
+            if (status[neighbor] == VARIABLE && mark[neighbor] != currentMark)
+            {
+                mark[neighbor] = currentMark;
+
+                pivotVariables.push_back(neighbor);
+
+                pivotDegree += weight[neighbor];
+            }
+        }
+
+        /* The new element covers all elements adjacent to the pivot, hence they are absorbed. */
+        for (htd::index_t element : adjacentElements[pivot])
+        {
+            if (status[element] == ELEMENT)
+            {
+                for (htd::index_t variable : elementVariables[element])
+                {
+                    if (status[variable] == VARIABLE && mark[variable] != currentMark)
+                    {
+                        mark[variable] = currentMark;
+
+                        pivotVariables.push_back(variable);
+
+                        pivotDegree += weight[variable];
+                    }
+                }
+
+                status[element] = ABSORBED_ELEMENT;
+
+                std::vector<htd::index_t>().swap(elementVariables[element]);
+            }
+        }
+
+        std::vector<htd::index_t>().swap(variableNeighbors[pivot]);
+        std::vector<htd::index_t>().swap(adjacentElements[pivot]);
+
+        status[pivot] = ELEMENT;
+
+        if (weight[pivot] + pivotDegree > ret)
+        {
+            ret = weight[pivot] + pivotDegree;
+        }
+
+        remainingWeight -= weight[pivot];
+
+        for (htd::index_t member = pivot; member != (htd::index_t)-1; member = nextMember[member])
+        {
+            target.push_back(preprocessedGraph.vertexName(remainingVertices[member]));
+        }
+
+        /* Remove stale entries and compute the weight of each adjacent element outside of the new element. */
+        touchedElements.clear();
+
+        for (htd::index_t variable : pivotVariables)
+        {
+            std::vector<htd::index_t> & currentElements = adjacentElements[variable];
+
+            currentElements.erase(std::remove_if(currentElements.begin(), currentElements.end(), [&](htd::index_t element) { return status[element] != ELEMENT; }), currentElements.end());
+
+            for (htd::index_t element : currentElements)
+            {
+                if (externalWeight[element] < 0)
+                {
+                    externalWeight[element] = static_cast<long>(elementWeight[element]);
+
+                    touchedElements.push_back(element);
+                }
+
+                externalWeight[element] -= static_cast<long>(weight[variable]);
+            }
+
+            /* Neighbors within the new element are covered by the element itself. */
+            std::vector<htd::index_t> & currentNeighbors = variableNeighbors[variable];
+
+            currentNeighbors.erase(std::remove_if(currentNeighbors.begin(), currentNeighbors.end(), [&](htd::index_t neighbor) { return status[neighbor] != VARIABLE || mark[neighbor] == currentMark; }), currentNeighbors.end());
+        }
+
+        /* Compute the approximate degrees and detect variables which can be eliminated together with the pivot. */
+        std::size_t pivotWeight = pivotDegree;
+
+        candidates.clear();
+
+        for (htd::index_t variable : pivotVariables)
+        {
+            std::vector<htd::index_t> & currentElements = adjacentElements[variable];
+
+            std::size_t elementDegree = 0;
+
+            auto last = std::remove_if(currentElements.begin(), currentElements.end(), [&](htd::index_t element)
+            {
+                bool absorbed = status[element] != ELEMENT;
+
+                if (!absorbed && externalWeight[element] == 0)
+                {
+                    /* Aggressive absorption: The element is completely covered by the new element. */
+                    status[element] = ABSORBED_ELEMENT;
+
+                    std::vector<htd::index_t>().swap(elementVariables[element]);
+
+                    absorbed = true;
+                }
+                else if (!absorbed)
+                {
+                    elementDegree += static_cast<std::size_t>(externalWeight[element]);
+                }
+
+                return absorbed;
+            });
+
+            currentElements.erase(last, currentElements.end());
+
+            currentElements.push_back(pivot);
+
+            std::size_t neighborDegree = 0;
+
+            for (htd::index_t neighbor : variableNeighbors[variable])
+            {
+                neighborDegree += weight[neighbor];
+            }
+
+            std::size_t otherPivotVariables = pivotDegree - weight[variable];
+
+            if (neighborDegree == 0 && currentElements.size() == 1)
+            {
+                /* Mass elimination: The neighborhood of the variable is a subset of the new element, hence it can be eliminated without any fill. */
+                status[variable] = INACTIVE_VARIABLE;
+
+                priorityQueue.erase(variable);
+
+                remainingWeight -= weight[variable];
+
+                pivotWeight -= weight[variable];
+
+                for (htd::index_t member = variable; member != (htd::index_t)-1; member = nextMember[member])
+                {
+                    target.push_back(preprocessedGraph.vertexName(remainingVertices[member]));
+                }
+
+                std::vector<htd::index_t>().swap(adjacentElements[variable]);
+            }
+            else
+            {
+                std::size_t newDegree = std::min(remainingWeight - weight[variable], degree[variable] + otherPivotVariables);
+
+                newDegree = std::min(newDegree, neighborDegree + otherPivotVariables + elementDegree);
+
+                degree[variable] = newDegree;
+
+                std::size_t hash = pivot;
+
+                for (htd::index_t neighbor : variableNeighbors[variable])
+                {
+                    hash += neighbor;
+                }
+
+                for (htd::index_t element : currentElements)
+                {
+                    hash += element;
+                }
+
+                candidates.emplace_back(hash, variable);
+            }
+        }
+
+        for (htd::index_t element : touchedElements)
+        {
+            externalWeight[element] = -1;
+        }
+
+        /* Merge indistinguishable variables, i.e., variables with identical sets of adjacent variables and elements, into supervariables. */
+        std::sort(candidates.begin(), candidates.end());
+
+        for (auto it = candidates.begin(); it != candidates.end();)
+        {
+            auto end = it + 1;
+
+            while (end != candidates.end() && end->first == it->first)
+            {
+                ++end;
+            }
+
+            if (end - it > 1)
+            {
+                for (auto it2 = it; it2 != end; ++it2)
+                {
+                    std::sort(variableNeighbors[it2->second].begin(), variableNeighbors[it2->second].end());
+                    std::sort(adjacentElements[it2->second].begin(), adjacentElements[it2->second].end());
+                }
+
+                for (auto it2 = it; it2 != end; ++it2)
+                {
+                    htd::index_t variable = it2->second;
+
+                    if (status[variable] == VARIABLE)
+                    {
+                        for (auto it3 = it2 + 1; it3 != end; ++it3)
+                        {
+                            htd::index_t other = it3->second;
+
+                            if (status[other] == VARIABLE &&
+                                variableNeighbors[variable] == variableNeighbors[other] &&
+                                adjacentElements[variable] == adjacentElements[other])
+                            {
+                                status[other] = INACTIVE_VARIABLE;
+
+                                priorityQueue.erase(other);
+
+                                degree[variable] -= std::min(degree[variable], weight[other]);
+
+                                weight[variable] += weight[other];
+
+                                weight[other] = 0;
+
+                                nextMember[lastMember[variable]] = other;
+
+                                lastMember[variable] = lastMember[other];
+
+                                std::vector<htd::index_t>().swap(variableNeighbors[other]);
+                                std::vector<htd::index_t>().swap(adjacentElements[other]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            it = end;
+        }
+
+        for (const std::pair<std::size_t, htd::index_t> & candidate : candidates)
+        {
+            if (status[candidate.second] == VARIABLE)
+            {
+                priorityQueue.updatePriority(candidate.second, degree[candidate.second]);
+            }
+        }
+
+        std::vector<htd::index_t> & currentElementVariables = elementVariables[pivot];
+
+        for (htd::index_t variable : pivotVariables)
+        {
+            if (status[variable] == VARIABLE)
+            {
+                currentElementVariables.push_back(variable);
+            }
+        }
+
+        elementWeight[pivot] = pivotWeight;
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::ApproximateMinDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ApproximateMinDegreeOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::clone(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+#endif
+
+#endif /* HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP */
@@ -0,0 +1,801 @@
+/*
+ * File:   AtomBasedTreeDecompositionAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_ATOMBASEDTREEDECOMPOSITIONALGORITHM_CPP
+#define HTD_HTD_ATOMBASEDTREEDECOMPOSITIONALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+
+#include <htd/AtomBasedTreeDecompositionAlgorithm.hpp>
+#include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
+#include <htd/ILabelingFunction.hpp>
+#include <htd/IMutableTreeDecomposition.hpp>
+#include <htd/ITreeDecompositionManipulationOperation.hpp>
+#include <htd/ParallelExecution.hpp>
+#include <htd/TreeDecompositionAlgorithmFactory.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+
+#include <algorithm>
+#include <cstdarg>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::AtomBasedTreeDecompositionAlgorithm.
+ */
+struct htd::AtomBasedTreeDecompositionAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager  The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), decompositionAlgorithm_(nullptr), labelingFunctions_(), postProcessingOperations_(), threadCount_(1), computeInducedEdges_(true)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), decompositionAlgorithm_(nullptr), labelingFunctions_(), postProcessingOperations_(), threadCount_(original.threadCount_), computeInducedEdges_(original.computeInducedEdges_)
+    {
+        if (original.decompositionAlgorithm_ != nullptr)
+        {
+            decompositionAlgorithm_ = original.decompositionAlgorithm_->clone();
+        }
+
+        for (htd::ILabelingFunction * labelingFunction : original.labelingFunctions_)
+        {
+    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            labelingFunctions_.push_back(labelingFunction->clone());
+    #else
+            labelingFunctions_.push_back(labelingFunction->cloneLabelingFunction());
+    #endif
+        }
+
+        for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : original.postProcessingOperations_)
+        {
+    #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            postProcessingOperations_.push_back(postProcessingOperation->clone());
+    #else
+            postProcessingOperations_.push_back(postProcessingOperation->cloneTreeDecompositionManipulationOperation());
+    #endif
+        }
+    }
+
+    virtual ~Implementation()
+    {
+        delete decompositionAlgorithm_;
+
+        for (auto & labelingFunction : labelingFunctions_)
+        {
+            delete labelingFunction;
+        }
+
+        for (auto & postProcessingOperation : postProcessingOperations_)
+        {
+            delete postProcessingOperation;
+        }
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The base decomposition algorithm which is used to decompose the atoms (nullptr=default algorithm of the management instance).
+     */
+    htd::ITreeDecompositionAlgorithm * decompositionAlgorithm_;
+
+    /**
+     *  The labeling functions which are applied after the decomposition was computed.
+     */
+    std::vector<htd::ILabelingFunction *> labelingFunctions_;
+
+    /**
+     *  The manipuation operations which are applied after the decomposition was computed.
+     */
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
+
+    /**
+     *  The number of threads which shall be used to decompose the atoms of the input graph.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
+     */
+    bool computeInducedEdges_;
+
+    /**
+     *  Create a new instance of the base decomposition algorithm.
+     *
+     *  @return A new instance of the base decomposition algorithm.
+     */
+    htd::ITreeDecompositionAlgorithm * createDecompositionAlgorithm(void) const
+    {
+        htd::ITreeDecompositionAlgorithm * ret = nullptr;
+
+        if (decompositionAlgorithm_ != nullptr)
+        {
+            ret = decompositionAlgorithm_->clone();
+        }
+        else
+        {
+            ret = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+        }
+
+        HTD_ASSERT(ret != nullptr)
+
+        ret->setComputeInducedEdgesEnabled(computeInducedEdges_);
+
+        return ret;
+    }
+
+    /**
+     *  Create the subgraph of the given graph which is induced by the given atom.
+     *
+     *  The vertex with index i in the atom is represented by the vertex htd::Vertex::FIRST + i in the new graph. All
+     *  hyperedges of the given graph which are fully contained in the atom are part of the new graph, the hyperedge
+     *  with position i in the new graph is the hyperedge with position hyperedgePositions[i] in the given graph.
+     *
+     *  @param[in] graph                The input graph.
+     *  @param[in] atom                 The vertices of the atom in ascending order.
+     *  @param[in] hyperedgePositions   The positions of the hyperedges contained in the atom in ascending order.
+     *
+     *  @return The subgraph of the given graph which is induced by the given atom.
+     */
+    htd::IMultiHypergraph * createAtomGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & atom, const std::vector<htd::index_t> & hyperedgePositions) const
+    {
+        std::vector<htd::index_t> edgeOffsets;
+
+        std::vector<htd::vertex_t> edgeElements;
+
+        edgeOffsets.reserve(hyperedgePositions.size() + 1);
+
+        edgeOffsets.push_back(0);
+
+        for (htd::index_t position : hyperedgePositions)
+        {
+            for (htd::vertex_t vertex : graph.hyperedgeAtPosition(position).elements())
+            {
+                edgeElements.push_back(htd::Vertex::FIRST + static_cast<htd::vertex_t>(std::lower_bound(atom.begin(), atom.end(), vertex) - atom.begin()));
+            }
+
+            edgeOffsets.push_back(static_cast<htd::index_t>(edgeElements.size()));
+        }
+
+        return new htd::CompactMultiHypergraph(managementInstance_, atom.size(), std::move(edgeOffsets), std::move(edgeElements));
+    }
+
+    /**
+     *  Compute the decompositions of the given atoms.
+     *
+     *  @param[in] graph                The input graph.
+     *  @param[in] atoms                The atoms of the input graph.
+     *  @param[in] hyperedgePositions   The positions of the hyperedges contained in each of the atoms.
+     *  @param[out] decompositions      The decompositions of the atoms (nullptr if the decomposition of the respective atom was interrupted).
+     */
+    void decomposeAtoms(const htd::IMultiHypergraph & graph,
+                        const std::vector<std::vector<htd::vertex_t>> & atoms,
+                        const std::vector<std::vector<htd::index_t>> & hyperedgePositions,
+                        std::vector<htd::ITreeDecomposition *> & decompositions) const;
+
+    /**
+     *  Copy the given decomposition of an atom into the target decomposition.
+     *
+     *  @param[in] graph                The input graph.
+     *  @param[in] atom                 The vertices of the atom in ascending order.
+     *  @param[in] hyperedgePositions   The positions of the hyperedges contained in the atom in ascending order.
+     *  @param[in] decomposition        The decomposition of the atom.
+     *  @param[in] start                The vertex of the decomposition of the atom which shall be attached to the target decomposition.
+     *  @param[in] attachmentPoint      The vertex of the target decomposition to which the decomposition of the atom shall be attached (htd::Vertex::UNKNOWN if the target decomposition is empty).
+     *  @param[in,out] target           The target decomposition.
+     *  @param[out] createdVertices     The vector to which the created vertices of the target decomposition shall be appended.
+     */
+    void copyAtomDecomposition(const htd::IMultiHypergraph & graph,
+                               const std::vector<htd::vertex_t> & atom,
+                               const std::vector<htd::index_t> & hyperedgePositions,
+                               const htd::ITreeDecomposition & decomposition,
+                               htd::vertex_t start,
+                               htd::vertex_t attachmentPoint,
+                               htd::IMutableTreeDecomposition & target,
+                               std::vector<htd::vertex_t> & createdVertices) const;
+
+    /**
+     *  Compute a new mutable tree decompostion of the given graph.
+     *
+     *  @param[in] graph    The graph which shall be decomposed.
+     *
+     *  @return A mutable tree decompostion of the given graph.
+     */
+    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+};
+
+htd::AtomBasedTreeDecompositionAlgorithm::AtomBasedTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::AtomBasedTreeDecompositionAlgorithm::AtomBasedTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)  : implementation_(new Implementation(manager))
+{
+    setManipulationOperations(manipulationOperations);
+}
+
+htd::AtomBasedTreeDecompositionAlgorithm::AtomBasedTreeDecompositionAlgorithm(const htd::AtomBasedTreeDecompositionAlgorithm & original)  : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::AtomBasedTreeDecompositionAlgorithm::~AtomBasedTreeDecompositionAlgorithm()
+{
+
+}
+
+htd::ITreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph);
+
+    if (ret != nullptr)
+    {
+        std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+        std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(operation);
+
+            if (labelingFunction != nullptr)
+            {
+                labelingFunctions.push_back(labelingFunction);
+            }
+
+            htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(operation);
+
+            if (manipulationOperation != nullptr)
+            {
+                postProcessingOperations.push_back(manipulationOperation);
+            }
+        }
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
+        {
+            operation->apply(graph, *ret);
+        }
+
+        for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+        {
+            operation->apply(graph, *ret);
+        }
+
+        for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+        {
+            for (htd::vertex_t vertex : ret->vertices())
+            {
+                htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+
+        for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+        {
+            for (htd::vertex_t vertex : ret->vertices())
+            {
+                htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                delete labelCollection;
+
+                ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+            }
+        }
+    }
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    HTD_UNUSED(preprocessedGraph)
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::setDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->decompositionAlgorithm_;
+
+    implementation_->decompositionAlgorithm_ = algorithm;
+}
+
+std::size_t htd::AtomBasedTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (auto & labelingFunction : implementation_->labelingFunctions_)
+    {
+        delete labelingFunction;
+    }
+
+    for (auto & postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        delete postProcessingOperation;
+    }
+
+    implementation_->labelingFunctions_.clear();
+
+    implementation_->postProcessingOperations_.clear();
+
+    addManipulationOperations(manipulationOperations);
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation)
+{
+    bool assigned = false;
+
+    htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(manipulationOperation);
+
+    if (labelingFunction != nullptr)
+    {
+        implementation_->labelingFunctions_.emplace_back(labelingFunction);
+
+        assigned = true;
+    }
+
+    htd::ITreeDecompositionManipulationOperation * newManipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(manipulationOperation);
+
+    if (newManipulationOperation != nullptr)
+    {
+        implementation_->postProcessingOperations_.emplace_back(newManipulationOperation);
+
+        assigned = true;
+    }
+
+    if (!assigned)
+    {
+        delete manipulationOperation;
+    }
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        addManipulationOperation(operation);
+    }
+}
+
+bool htd::AtomBasedTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
+{
+    return false;
+}
+
+const htd::LibraryInstance * htd::AtomBasedTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+bool htd::AtomBasedTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
+{
+    return implementation_->computeInducedEdges_;
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled)
+{
+    implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
+}
+
+htd::AtomBasedTreeDecompositionAlgorithm * htd::AtomBasedTreeDecompositionAlgorithm::clone(void) const
+{
+    return new htd::AtomBasedTreeDecompositionAlgorithm(*this);
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::Implementation::decomposeAtoms(const htd::IMultiHypergraph & graph,
+                                                                              const std::vector<std::vector<htd::vertex_t>> & atoms,
+                                                                              const std::vector<std::vector<htd::index_t>> & hyperedgePositions,
+                                                                              std::vector<htd::ITreeDecomposition *> & decompositions) const
+{
+    std::size_t atomCount = atoms.size();
+
+    decompositions.assign(atomCount, nullptr);
+
+    /* Decompose the largest atoms first to balance the load of the worker threads. */
+    std::vector<htd::index_t> schedule(atomCount);
+
+    for (htd::index_t index = 0; index < atomCount; ++index)
+    {
+        schedule[index] = index;
+    }
+
+    std::stable_sort(schedule.begin(), schedule.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return atoms[index1].size() > atoms[index2].size();
+    });
+
+    std::vector<std::unique_ptr<htd::ITreeDecompositionAlgorithm>> algorithms(std::max(std::min(threadCount_, atomCount), (std::size_t)1));
+
+    htd::seededParallelFor(atomCount, threadCount_, [&](htd::index_t worker, htd::index_t task)
+    {
+        if (!managementInstance_->isTerminated())
+        {
+            htd::index_t index = schedule[task];
+
+            if (!algorithms[worker])
+            {
+                algorithms[worker].reset(createDecompositionAlgorithm());
+            }
+
+            std::unique_ptr<htd::IMultiHypergraph> atomGraph(createAtomGraph(graph, atoms[index], hyperedgePositions[index]));
+
+            decompositions[index] = algorithms[worker]->computeDecomposition(*atomGraph);
+        }
+    });
+}
+
+void htd::AtomBasedTreeDecompositionAlgorithm::Implementation::copyAtomDecomposition(const htd::IMultiHypergraph & graph,
+                                                                                     const std::vector<htd::vertex_t> & atom,
+                                                                                     const std::vector<htd::index_t> & hyperedgePositions,
+                                                                                     const htd::ITreeDecomposition & decomposition,
+                                                                                     htd::vertex_t start,
+                                                                                     htd::vertex_t attachmentPoint,
+                                                                                     htd::IMutableTreeDecomposition & target,
+                                                                                     std::vector<htd::vertex_t> & createdVertices) const
+{
+    auto createVertex = [&](htd::vertex_t vertex, htd::vertex_t parent)
+    {
+        std::vector<htd::vertex_t> bagContent;
+
+        bagContent.reserve(decomposition.bagContent(vertex).size());
+
+        /* The vertices of the atom graph are numbered in ascending order of the vertices of the atom, i.e., the bag remains sorted. */
+        for (htd::vertex_t bagVertex : decomposition.bagContent(vertex))
+        {
+            bagContent.push_back(atom[bagVertex - htd::Vertex::FIRST]);
+        }
+
+        std::vector<htd::index_t> inducedEdgePositions;
+
+        if (computeInducedEdges_)
+        {
+            for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(vertex))
+            {
+                inducedEdgePositions.push_back(hyperedgePositions[hyperedge.id() - htd::Id::FIRST]);
+            }
+
+            std::sort(inducedEdgePositions.begin(), inducedEdgePositions.end());
+        }
+
+        htd::vertex_t ret = htd::Vertex::UNKNOWN;
+
+        if (parent == htd::Vertex::UNKNOWN)
+        {
+            ret = target.insertRoot(std::move(bagContent), graph.hyperedgesAtPositions(std::move(inducedEdgePositions)));
+        }
+        else
+        {
+            ret = target.addChild(parent, std::move(bagContent), graph.hyperedgesAtPositions(std::move(inducedEdgePositions)));
+        }
+
+        createdVertices.push_back(ret);
+
+        return ret;
+    };
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> originStack;
+
+    std::vector<htd::vertex_t> neighbors;
+
+    originStack.emplace_back(start, createVertex(start, attachmentPoint));
+
+    /* The identifiers of the nodes are not necessarily contiguous, e.g., if the base algorithm removed nodes of the decomposition. */
+    htd::vertex_t maximumVertex = start;
+
+    for (htd::vertex_t vertex : decomposition.vertices())
+    {
+        maximumVertex = std::max(maximumVertex, vertex);
+    }
+
+    std::vector<bool> visitedVertices(maximumVertex + 1, false);
+
+    visitedVertices[start] = true;
+
+    while (!originStack.empty())
+    {
+        std::pair<htd::vertex_t, htd::vertex_t> current = originStack.back();
+
+        originStack.pop_back();
+
+        neighbors.clear();
+
+        decomposition.copyNeighborsTo(current.first, neighbors);
+
+        for (htd::vertex_t neighbor : neighbors)
+        {
+            if (!visitedVertices[neighbor])
+            {
+                visitedVertices[neighbor] = true;
+
+                originStack.emplace_back(neighbor, createVertex(neighbor, current.second));
+            }
+        }
+    }
+}
+
+htd::IMutableTreeDecomposition * htd::AtomBasedTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    htd::IMutableTreeDecomposition * ret = nullptr;
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    htd::CliqueMinimalSeparatorAlgorithm separatorAlgorithm(managementInstance_);
+
+    separatorAlgorithm.computeAtoms(graph, atoms, separators);
+
+    if (managementInstance_->isTerminated())
+    {
+        ret = nullptr;
+    }
+    else if (atoms.size() <= 1)
+    {
+        std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(createDecompositionAlgorithm());
+
+        htd::ITreeDecomposition * decomposition = algorithm->computeDecomposition(graph);
+
+        if (decomposition != nullptr)
+        {
+            ret = &(managementInstance_->treeDecompositionFactory().accessMutableInstance(*decomposition));
+        }
+    }
+    else
+    {
+        std::size_t atomCount = atoms.size();
+
+        /* Each hyperedge forms a clique in the primal graph, i.e., it is fully contained in at least one atom. */
+        std::vector<std::vector<htd::index_t>> atomsOfVertex;
+
+        std::vector<std::vector<htd::index_t>> hyperedgePositions(atomCount);
+
+        for (htd::index_t index = 0; index < atomCount; ++index)
+        {
+            for (htd::vertex_t vertex : atoms[index])
+            {
+                if (vertex >= atomsOfVertex.size())
+                {
+                    atomsOfVertex.resize(vertex + 1);
+                }
+
+                atomsOfVertex[vertex].push_back(index);
+            }
+        }
+
+        htd::index_t position = 0;
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            const std::vector<htd::vertex_t> & elements = hyperedge.sortedElements();
+
+            if (!elements.empty())
+            {
+                for (htd::index_t index : atomsOfVertex[elements[0]])
+                {
+                    const std::vector<htd::vertex_t> & atom = atoms[index];
+
+                    if (std::includes(atom.begin(), atom.end(), elements.begin(), elements.end()))
+                    {
+                        hyperedgePositions[index].push_back(position);
+                    }
+                }
+            }
+
+            ++position;
+        }
+
+        std::vector<htd::ITreeDecomposition *> decompositions;
+
+        decomposeAtoms(graph, atoms, hyperedgePositions, decompositions);
+
+        if (!managementInstance_->isTerminated() && std::find(decompositions.begin(), decompositions.end(), nullptr) == decompositions.end())
+        {
+            ret = managementInstance_->treeDecompositionFactory().createInstance();
+
+            std::vector<std::vector<htd::vertex_t>> createdVertices(atomCount);
+
+            /* Each separator is contained in a subsequent atom, hence the atoms are glued in reverse order. */
+            for (htd::index_t index = atomCount; index > 0 && !managementInstance_->isTerminated(); --index)
+            {
+                const std::vector<htd::vertex_t> & atom = atoms[index - 1];
+
+                const std::vector<htd::vertex_t> & separator = separators[index - 1];
+
+                const htd::ITreeDecomposition & decomposition = *(decompositions[index - 1]);
+
+                htd::vertex_t start = decomposition.root();
+
+                htd::vertex_t attachmentPoint = htd::Vertex::UNKNOWN;
+
+                if (!createdVertices[atomCount - 1].empty())
+                {
+                    attachmentPoint = createdVertices[atomCount - 1][0];
+                }
+
+                if (!separator.empty())
+                {
+                    std::vector<htd::vertex_t> localSeparator;
+
+                    for (htd::vertex_t vertex : separator)
+                    {
+                        localSeparator.push_back(htd::Vertex::FIRST + static_cast<htd::vertex_t>(std::lower_bound(atom.begin(), atom.end(), vertex) - atom.begin()));
+                    }
+
+                    bool found = false;
+
+                    /* The separator is a clique of the atom graph, i.e., it is fully contained in at least one bag of its decomposition. */
+                    const htd::ConstCollection<htd::vertex_t> decompositionVertices = decomposition.vertices();
+
+                    for (auto it = decompositionVertices.begin(); !found && it != decompositionVertices.end(); ++it)
+                    {
+                        const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(*it);
+
+                        if (std::includes(bagContent.begin(), bagContent.end(), localSeparator.begin(), localSeparator.end()))
+                        {
+                            start = *it;
+
+                            found = true;
+                        }
+                    }
+
+                    HTD_ASSERT(found)
+
+                    found = false;
+
+                    for (htd::index_t otherIndex = index; !found && otherIndex < atomCount; ++otherIndex)
+                    {
+                        const std::vector<htd::vertex_t> & otherAtom = atoms[otherIndex];
+
+                        if (std::includes(otherAtom.begin(), otherAtom.end(), separator.begin(), separator.end()))
+                        {
+                            for (auto it = createdVertices[otherIndex].begin(); !found && it != createdVertices[otherIndex].end(); ++it)
+                            {
+                                const std::vector<htd::vertex_t> & bagContent = ret->bagContent(*it);
+
+                                if (std::includes(bagContent.begin(), bagContent.end(), separator.begin(), separator.end()))
+                                {
+                                    attachmentPoint = *it;
+
+                                    found = true;
+                                }
+                            }
+                        }
+                    }
+
+                    HTD_ASSERT(found)
+                }
+
+                copyAtomDecomposition(graph, atom, hyperedgePositions[index - 1], decomposition, start, attachmentPoint, *ret, createdVertices[index - 1]);
+            }
+
+            if (managementInstance_->isTerminated())
+            {
+                delete ret;
+
+                ret = nullptr;
+            }
+        }
+
+        for (htd::ITreeDecomposition * decomposition : decompositions)
+        {
+            delete decomposition;
+        }
+    }
+
+    return ret;
+}
+
+#endif /* HTD_HTD_ATOMBASEDTREEDECOMPOSITIONALGORITHM_CPP */
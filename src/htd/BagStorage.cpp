@@ -0,0 +1,453 @@
+/*
+ * File:   BagStorage.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BAGSTORAGE_CPP
+#define HTD_HTD_BAGSTORAGE_CPP
+
+#include <htd/BagStorage.hpp>
+
+#include <utility>
+
+htd::BagStorage::BagStorage(void) : slots_(), offset_(htd::Vertex::FIRST), size_(0), vertexArena_(), indexArena_(), vertexGarbage_(0), indexGarbage_(0), mutex_()
+{
+
+}
+
+htd::BagStorage::BagStorage(const htd::BagStorage & original) : slots_(), offset_(htd::Vertex::FIRST), size_(0), vertexArena_(), indexArena_(), vertexGarbage_(0), indexGarbage_(0), mutex_()
+{
+    assign(original);
+}
+
+htd::BagStorage::BagStorage(htd::BagStorage && original) : slots_(std::move(original.slots_)), offset_(original.offset_), size_(original.size_), vertexArena_(std::move(original.vertexArena_)), indexArena_(std::move(original.indexArena_)), vertexGarbage_(original.vertexGarbage_), indexGarbage_(original.indexGarbage_), mutex_()
+{
+    original.clear();
+}
+
+htd::BagStorage::~BagStorage()
+{
+
+}
+
+std::size_t htd::BagStorage::size(void) const
+{
+    return size_;
+}
+
+bool htd::BagStorage::contains(htd::vertex_t vertex) const
+{
+    return vertex >= offset_ && vertex - offset_ < slots_.size() && slots_[vertex - offset_].used;
+}
+
+void htd::BagStorage::insert(htd::vertex_t vertex)
+{
+    Slot & slot = acquireSlot(vertex);
+
+    release(slot);
+
+    compact();
+}
+
+void htd::BagStorage::insert(htd::vertex_t vertex, const std::vector<htd::vertex_t> & bagContent, const htd::FilteredHyperedgeCollection & inducedEdges)
+{
+    store(acquireSlot(vertex), htd::ConstSpan<htd::vertex_t>(bagContent), inducedEdges.baseCollection_, htd::ConstSpan<htd::index_t>(*(inducedEdges.relevantIndices_)));
+
+    compact();
+}
+
+void htd::BagStorage::insert(htd::vertex_t vertex, std::vector<htd::vertex_t> && bagContent, htd::FilteredHyperedgeCollection && inducedEdges)
+{
+    insert(vertex, static_cast<const std::vector<htd::vertex_t> &>(bagContent), static_cast<const htd::FilteredHyperedgeCollection &>(inducedEdges));
+}
+
+void htd::BagStorage::erase(htd::vertex_t vertex)
+{
+    if (contains(vertex))
+    {
+        Slot & slot = slots_[vertex - offset_];
+
+        release(slot);
+
+        slot.used = false;
+
+        --size_;
+
+        while (!slots_.empty() && !slots_.front().used)
+        {
+            slots_.pop_front();
+
+            ++offset_;
+        }
+
+        while (!slots_.empty() && !slots_.back().used)
+        {
+            slots_.pop_back();
+        }
+
+        compact();
+    }
+}
+
+void htd::BagStorage::clear(void)
+{
+    slots_.clear();
+
+    size_ = 0;
+
+    std::vector<htd::vertex_t>().swap(vertexArena_);
+
+    std::vector<htd::index_t>().swap(indexArena_);
+
+    vertexGarbage_ = 0;
+
+    indexGarbage_ = 0;
+}
+
+std::size_t htd::BagStorage::bagSize(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(contains(vertex))
+
+    return bagRange(slots_[vertex - offset_]).size();
+}
+
+htd::ConstSpan<htd::vertex_t> htd::BagStorage::bagSpan(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(contains(vertex))
+
+    return bagRange(slots_[vertex - offset_]);
+}
+
+std::vector<htd::vertex_t> & htd::BagStorage::bagContent(htd::vertex_t vertex)
+{
+    HTD_ASSERT(contains(vertex))
+
+    return detachBagContent(slots_[vertex - offset_]);
+}
+
+const std::vector<htd::vertex_t> & htd::BagStorage::bagContent(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(contains(vertex))
+
+    return detachBagContent(slots_[vertex - offset_]);
+}
+
+htd::FilteredHyperedgeCollection & htd::BagStorage::inducedHyperedges(htd::vertex_t vertex)
+{
+    HTD_ASSERT(contains(vertex))
+
+    return detachInducedEdges(slots_[vertex - offset_]);
+}
+
+const htd::FilteredHyperedgeCollection & htd::BagStorage::inducedHyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(contains(vertex))
+
+    return detachInducedEdges(slots_[vertex - offset_]);
+}
+
+htd::BagStorage & htd::BagStorage::operator=(const htd::BagStorage & original)
+{
+    if (this != &original)
+    {
+        clear();
+
+        assign(original);
+    }
+
+    return *this;
+}
+
+htd::BagStorage & htd::BagStorage::operator=(htd::BagStorage && original)
+{
+    if (this != &original)
+    {
+        slots_ = std::move(original.slots_);
+
+        offset_ = original.offset_;
+
+        size_ = original.size_;
+
+        vertexArena_ = std::move(original.vertexArena_);
+
+        indexArena_ = std::move(original.indexArena_);
+
+        vertexGarbage_ = original.vertexGarbage_;
+
+        indexGarbage_ = original.indexGarbage_;
+
+        original.clear();
+    }
+
+    return *this;
+}
+
+htd::BagStorage::Slot & htd::BagStorage::acquireSlot(htd::vertex_t vertex)
+{
+    if (slots_.empty())
+    {
+        offset_ = vertex;
+    }
+
+    while (vertex < offset_)
+    {
+        slots_.emplace_front();
+
+        --offset_;
+    }
+
+    while (vertex - offset_ >= slots_.size())
+    {
+        slots_.emplace_back();
+    }
+
+    Slot & ret = slots_[vertex - offset_];
+
+    if (!ret.used)
+    {
+        ret.used = true;
+
+        ++size_;
+    }
+
+    return ret;
+}
+
+void htd::BagStorage::release(Slot & slot)
+{
+    std::vector<htd::vertex_t> * bagContent = slot.bagContent.exchange(nullptr);
+
+    if (bagContent != nullptr)
+    {
+        delete bagContent;
+    }
+    else
+    {
+        vertexGarbage_ += slot.bagLength;
+    }
+
+    htd::FilteredHyperedgeCollection * inducedEdges = slot.inducedEdges.exchange(nullptr);
+
+    if (inducedEdges != nullptr)
+    {
+        delete inducedEdges;
+    }
+    else
+    {
+        indexGarbage_ += slot.edgeLength;
+    }
+
+    slot.bagOffset = 0;
+    slot.bagLength = 0;
+
+    slot.edgeOffset = 0;
+    slot.edgeLength = 0;
+
+    slot.baseCollection.reset();
+}
+
+void htd::BagStorage::store(Slot & slot, htd::ConstSpan<htd::vertex_t> bagContent, const std::shared_ptr<htd::IHyperedgeCollection> & baseCollection, htd::ConstSpan<htd::index_t> relevantIndices)
+{
+    /* The new entries are appended before the old ones are released because they may be the detached entries of the slot itself. */
+    std::shared_ptr<htd::IHyperedgeCollection> newBaseCollection(baseCollection);
+
+    std::size_t bagOffset = vertexArena_.size();
+    std::size_t bagLength = bagContent.size();
+
+    vertexArena_.insert(vertexArena_.end(), bagContent.begin(), bagContent.end());
+
+    std::size_t edgeOffset = indexArena_.size();
+    std::size_t edgeLength = relevantIndices.size();
+
+    indexArena_.insert(indexArena_.end(), relevantIndices.begin(), relevantIndices.end());
+
+    release(slot);
+
+    slot.bagOffset = bagOffset;
+    slot.bagLength = bagLength;
+
+    slot.edgeOffset = edgeOffset;
+    slot.edgeLength = edgeLength;
+
+    slot.baseCollection = std::move(newBaseCollection);
+}
+
+void htd::BagStorage::assign(const htd::BagStorage & original)
+{
+    std::size_t vertexCount = 0;
+
+    std::size_t indexCount = 0;
+
+    for (const Slot & originalSlot : original.slots_)
+    {
+        if (originalSlot.used)
+        {
+            vertexCount += original.bagRange(originalSlot).size();
+
+            indexCount += original.edgeRange(originalSlot).size();
+        }
+    }
+
+    vertexArena_.reserve(vertexCount);
+
+    indexArena_.reserve(indexCount);
+
+    offset_ = original.offset_;
+
+    size_ = original.size_;
+
+    for (const Slot & originalSlot : original.slots_)
+    {
+        slots_.emplace_back();
+
+        if (originalSlot.used)
+        {
+            Slot & slot = slots_.back();
+
+            slot.used = true;
+
+            store(slot, original.bagRange(originalSlot), original.baseCollection(originalSlot), original.edgeRange(originalSlot));
+        }
+    }
+}
+
+void htd::BagStorage::compact(void)
+{
+    std::size_t garbage = vertexGarbage_ + indexGarbage_;
+
+    /* The compaction visits all slots, hence it is only performed if the garbage outweighs both the remaining entries and the slots. */
+    if (garbage > vertexArena_.size() + indexArena_.size() - garbage && garbage >= slots_.size())
+    {
+        std::vector<htd::vertex_t> newVertexArena;
+
+        std::vector<htd::index_t> newIndexArena;
+
+        newVertexArena.reserve(vertexArena_.size() - vertexGarbage_);
+
+        newIndexArena.reserve(indexArena_.size() - indexGarbage_);
+
+        for (Slot & slot : slots_)
+        {
+            if (slot.used && slot.bagContent.load(std::memory_order_relaxed) == nullptr)
+            {
+                std::size_t bagOffset = newVertexArena.size();
+
+                newVertexArena.insert(newVertexArena.end(), vertexArena_.begin() + slot.bagOffset, vertexArena_.begin() + slot.bagOffset + slot.bagLength);
+
+                slot.bagOffset = bagOffset;
+            }
+
+            if (slot.used && slot.inducedEdges.load(std::memory_order_relaxed) == nullptr)
+            {
+                std::size_t edgeOffset = newIndexArena.size();
+
+                newIndexArena.insert(newIndexArena.end(), indexArena_.begin() + slot.edgeOffset, indexArena_.begin() + slot.edgeOffset + slot.edgeLength);
+
+                slot.edgeOffset = edgeOffset;
+            }
+        }
+
+        vertexArena_.swap(newVertexArena);
+
+        indexArena_.swap(newIndexArena);
+
+        vertexGarbage_ = 0;
+
+        indexGarbage_ = 0;
+    }
+}
+
+htd::ConstSpan<htd::vertex_t> htd::BagStorage::bagRange(const Slot & slot) const
+{
+    const std::vector<htd::vertex_t> * bagContent = slot.bagContent.load(std::memory_order_acquire);
+
+    return bagContent != nullptr ? htd::ConstSpan<htd::vertex_t>(*bagContent) : htd::ConstSpan<htd::vertex_t>(vertexArena_.data() + slot.bagOffset, slot.bagLength);
+}
+
+htd::ConstSpan<htd::index_t> htd::BagStorage::edgeRange(const Slot & slot) const
+{
+    const htd::FilteredHyperedgeCollection * inducedEdges = slot.inducedEdges.load(std::memory_order_acquire);
+
+    return inducedEdges != nullptr ? htd::ConstSpan<htd::index_t>(*(inducedEdges->relevantIndices_)) : htd::ConstSpan<htd::index_t>(indexArena_.data() + slot.edgeOffset, slot.edgeLength);
+}
+
+const std::shared_ptr<htd::IHyperedgeCollection> & htd::BagStorage::baseCollection(const Slot & slot) const
+{
+    const htd::FilteredHyperedgeCollection * inducedEdges = slot.inducedEdges.load(std::memory_order_acquire);
+
+    return inducedEdges != nullptr ? inducedEdges->baseCollection_ : slot.baseCollection;
+}
+
+std::vector<htd::vertex_t> & htd::BagStorage::detachBagContent(const Slot & slot) const
+{
+    std::vector<htd::vertex_t> * ret = slot.bagContent.load(std::memory_order_acquire);
+
+    if (ret == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        ret = slot.bagContent.load(std::memory_order_relaxed);
+
+        if (ret == nullptr)
+        {
+            ret = new std::vector<htd::vertex_t>(vertexArena_.begin() + slot.bagOffset, vertexArena_.begin() + slot.bagOffset + slot.bagLength);
+
+            vertexGarbage_ += slot.bagLength;
+
+            slot.bagContent.store(ret, std::memory_order_release);
+        }
+    }
+
+    return *ret;
+}
+
+htd::FilteredHyperedgeCollection & htd::BagStorage::detachInducedEdges(const Slot & slot) const
+{
+    htd::FilteredHyperedgeCollection * ret = slot.inducedEdges.load(std::memory_order_acquire);
+
+    if (ret == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        ret = slot.inducedEdges.load(std::memory_order_relaxed);
+
+        if (ret == nullptr)
+        {
+            if (slot.baseCollection)
+            {
+                ret = new htd::FilteredHyperedgeCollection(slot.baseCollection, std::vector<htd::index_t>(indexArena_.begin() + slot.edgeOffset, indexArena_.begin() + slot.edgeOffset + slot.edgeLength));
+            }
+            else
+            {
+                ret = new htd::FilteredHyperedgeCollection();
+            }
+
+            indexGarbage_ += slot.edgeLength;
+
+            slot.inducedEdges.store(ret, std::memory_order_release);
+        }
+    }
+
+    return *ret;
+}
+
+#endif /* HTD_HTD_BAGSTORAGE_CPP */
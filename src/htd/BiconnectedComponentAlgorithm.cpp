@@ -71,7 +71,7 @@ htd::BiconnectedComponentAlgorithm::~BiconnectedComponentAlgorithm()
 
 void htd::BiconnectedComponentAlgorithm::determineComponents(const htd::IGraphStructure & graph, std::vector<std::vector<htd::vertex_t>> & target, std::vector<htd::vertex_t> & articulationPoints) const
 {
-    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
     if (!vertexCollection.empty())
     {
@@ -0,0 +1,69 @@
+/*
+ * File:   CancellationScope.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CANCELLATIONSCOPE_CPP
+#define HTD_HTD_CANCELLATIONSCOPE_CPP
+
+#include <htd/CancellationScope.hpp>
+
+namespace htd
+{
+    /**
+     *  Create the token which shall be attached to the calling thread within a time-limited scope.
+     *
+     *  @param[in] timeLimit    The wall-clock time limit of the scope (0=unlimited).
+     *
+     *  @return A child of the currently attached token whose deadline reflects the time limit or the currently attached token itself if the time limit is 0.
+     */
+    static std::shared_ptr<htd::CancellationToken> createTimeLimitedToken(std::chrono::milliseconds timeLimit)
+    {
+        std::shared_ptr<htd::CancellationToken> ret = htd::CancellationToken::current();
+
+        if (timeLimit > std::chrono::milliseconds::zero())
+        {
+            ret = std::make_shared<htd::CancellationToken>(ret);
+
+            ret->setTimeout(timeLimit);
+        }
+
+        return ret;
+    }
+}
+
+htd::CancellationScope::CancellationScope(const std::shared_ptr<htd::CancellationToken> & token) : previousToken_(htd::CancellationToken::attach(token))
+{
+
+}
+
+htd::CancellationScope::CancellationScope(std::chrono::milliseconds timeLimit) : previousToken_(htd::CancellationToken::attach(htd::createTimeLimitedToken(timeLimit)))
+{
+
+}
+
+htd::CancellationScope::~CancellationScope()
+{
+    htd::CancellationToken::attach(previousToken_);
+}
+
+#endif /* HTD_HTD_CANCELLATIONSCOPE_CPP */
@@ -0,0 +1,186 @@
+/*
+ * File:   CancellationToken.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CANCELLATIONTOKEN_CPP
+#define HTD_HTD_CANCELLATIONTOKEN_CPP
+
+#include <htd/CancellationToken.hpp>
+
+#include <atomic>
+#include <limits>
+
+namespace htd
+{
+    /**
+     *  The token which is attached to the current thread.
+     */
+    static thread_local std::shared_ptr<htd::CancellationToken> attachedCancellationToken;
+
+    /**
+     *  A plain pointer to the token which is attached to the current thread. It allows polling the token without the overhead of accessing a shared pointer.
+     */
+    static thread_local const htd::CancellationToken * attachedCancellationTokenPointer = nullptr;
+}
+
+/**
+ *  Private implementation details of class htd::CancellationToken.
+ */
+struct htd::CancellationToken::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] parent   The parent token.
+     */
+    Implementation(const std::shared_ptr<htd::CancellationToken> & parent) : parent_(parent), cancelled_(false), deadline_(std::numeric_limits<clock::rep>::max())
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The parent token.
+     */
+    std::shared_ptr<htd::CancellationToken> parent_;
+
+    /**
+     *  A boolean flag indicating whether cancel() was called.
+     */
+    std::atomic<bool> cancelled_;
+
+    /**
+     *  The deadline of the token in ticks since the epoch of the clock or the maximum value of clock::rep if no deadline is set.
+     */
+    std::atomic<clock::rep> deadline_;
+};
+
+htd::CancellationToken::CancellationToken(void) : implementation_(new Implementation(nullptr))
+{
+
+}
+
+htd::CancellationToken::CancellationToken(const std::shared_ptr<htd::CancellationToken> & parent) : implementation_(new Implementation(parent))
+{
+
+}
+
+htd::CancellationToken::~CancellationToken()
+{
+
+}
+
+bool htd::CancellationToken::isCancelled(void) const HTD_NOEXCEPT
+{
+    clock::rep now = 0;
+
+    bool clockRead = false;
+
+    for (const htd::CancellationToken * token = this; token != nullptr; token = token->implementation_->parent_.get())
+    {
+        const Implementation & implementation = *(token->implementation_);
+
+        if (implementation.cancelled_.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        clock::rep deadline = implementation.deadline_.load(std::memory_order_relaxed);
+
+        if (deadline != std::numeric_limits<clock::rep>::max())
+        {
+            if (!clockRead)
+            {
+                now = clock::now().time_since_epoch().count();
+
+                clockRead = true;
+            }
+
+            if (now >= deadline)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void htd::CancellationToken::cancel(void) HTD_NOEXCEPT
+{
+    implementation_->cancelled_.store(true);
+}
+
+bool htd::CancellationToken::hasDeadline(void) const HTD_NOEXCEPT
+{
+    return implementation_->deadline_.load() != std::numeric_limits<clock::rep>::max();
+}
+
+htd::CancellationToken::clock::time_point htd::CancellationToken::deadline(void) const HTD_NOEXCEPT
+{
+    return clock::time_point(clock::duration(implementation_->deadline_.load()));
+}
+
+void htd::CancellationToken::setDeadline(const clock::time_point & deadline) HTD_NOEXCEPT
+{
+    implementation_->deadline_.store(deadline.time_since_epoch().count());
+}
+
+void htd::CancellationToken::setTimeout(const clock::duration & duration) HTD_NOEXCEPT
+{
+    setDeadline(clock::now() + duration);
+}
+
+const std::shared_ptr<htd::CancellationToken> & htd::CancellationToken::parent(void) const HTD_NOEXCEPT
+{
+    return implementation_->parent_;
+}
+
+std::shared_ptr<htd::CancellationToken> htd::CancellationToken::current(void)
+{
+    return htd::attachedCancellationToken;
+}
+
+bool htd::CancellationToken::isCurrentCancelled(void) HTD_NOEXCEPT
+{
+    const htd::CancellationToken * token = htd::attachedCancellationTokenPointer;
+
+    return token != nullptr && token->isCancelled();
+}
+
+std::shared_ptr<htd::CancellationToken> htd::CancellationToken::attach(const std::shared_ptr<htd::CancellationToken> & token)
+{
+    std::shared_ptr<htd::CancellationToken> ret = std::move(htd::attachedCancellationToken);
+
+    htd::attachedCancellationToken = token;
+
+    htd::attachedCancellationTokenPointer = token.get();
+
+    return ret;
+}
+
+#endif /* HTD_HTD_CANCELLATIONTOKEN_CPP */
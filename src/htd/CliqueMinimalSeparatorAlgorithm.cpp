@@ -123,6 +123,11 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
                 target.insert(target.end(), vertices_.begin(), vertices_.end());
             }
 
+            htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE
+            {
+                return htd::ConstSpan<htd::vertex_t>(vertices_);
+            }
+
             htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(index < vertices_.size())
@@ -210,6 +215,15 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
                 target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
             }
 
+            htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                HTD_UNUSED(buffer)
+
+                return htd::ConstSpan<htd::vertex_t>(neighborhood_[vertex]);
+            }
+
             htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(isVertex(vertex))
@@ -621,29 +635,23 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
                     }
                     else
                     {
-                        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+                        const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
-                        auto position = vertexCollection.begin();
+                        std::vector<htd::vertex_t> neighborBuffer;
 
-                        for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
+                        for (htd::vertex_t vertex : vertexCollection)
                         {
-                            htd::vertex_t vertex = *position;
-
                             htd::vertex_t mappedVertex = registerVertex(vertex);
 
                             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
 
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
-
-                            auto position2 = neighborCollection.begin();
+                            const htd::ConstSpan<htd::vertex_t> neighborCollection = graph.neighborSpan(vertex, neighborBuffer);
 
                             currentNeighborhood.reserve(neighborCollection.size() + 1);
 
-                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
+                            for (htd::vertex_t neighbor : neighborCollection)
                             {
-                                currentNeighborhood.push_back(registerVertex(*position2));
-
-                                ++position2;
+                                currentNeighborhood.push_back(registerVertex(neighbor));
                             }
 
                             std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
@@ -654,8 +662,6 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
                             {
                                 currentNeighborhood.erase(position3);
                             }
-
-                            ++position;
                         }
                     }
                 }
@@ -664,6 +670,130 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
             }
     };
 
+    /**
+     *  Compute a minimal triangulation of the given graph using the algorithm MCS-M.
+     *
+     *  @param[in] referenceGraph       The graph which shall be triangulated.
+     *  @param[out] triangulatedGraph   The triangulated graph. The graph must be a copy of the reference graph when calling this method.
+     *  @param[out] ordering            The vertex elimination ordering of the minimal triangulation, i.e., the reverse of the visiting order of MCS-M.
+     *  @param[out] generators          The vertices which generate the minimal separators of the triangulated graph in ascending order.
+     */
+    void computeMinimalTriangulation(const TriangulatedGraph & referenceGraph, TriangulatedGraph & triangulatedGraph, std::vector<htd::vertex_t> & ordering, std::vector<htd::vertex_t> & generators) const
+    {
+        std::size_t size = referenceGraph.vertexCount();
+
+        TriangulatedGraph eliminationGraph(referenceGraph);
+
+        std::unordered_set<htd::vertex_t> vertices(size);
+
+        htd::fillSet(eliminationGraph.vertices(), vertices);
+
+        std::vector<htd::vertex_t> pool;
+
+        std::vector<std::size_t> labels(size);
+
+        std::unordered_set<htd::vertex_t> reached;
+
+        std::unordered_map<std::size_t, std::vector<htd::vertex_t>> reachable;
+
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        ordering.reserve(size);
+
+        std::size_t lastLabel = (std::size_t)-1;
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            labels[index] = 0;
+        }
+
+        while (size > 0 && !managementInstance.isTerminated())
+        {
+            fillMaxCardinalityPool(vertices, labels, pool);
+
+            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+
+            const std::vector<htd::vertex_t> & selectedNeighborhood = eliminationGraph.neighborhood(selectedVertex);
+
+            if (lastLabel != (std::size_t)-1 && labels[selectedVertex] <= lastLabel)
+            {
+                htd::insertSorted(generators, selectedVertex);
+            }
+
+            lastLabel = labels[selectedVertex];
+
+            std::vector<htd::vertex_t> triangulationNeighbors(eliminationGraph.neighborhood(selectedVertex));
+
+            ordering.push_back(selectedVertex);
+
+            vertices.erase(selectedVertex);
+
+            pool.clear();
+
+            --size;
+
+            reached.insert(selectedVertex);
+
+            for (htd::index_t index = 0; index <= size; ++index)
+            {
+                reachable[index].clear();
+            }
+
+            for (htd::vertex_t neighbor : selectedNeighborhood)
+            {
+                reached.insert(neighbor);
+
+                reachable[labels[neighbor]].push_back(neighbor);
+            }
+
+            for (htd::index_t index = 0; index <= size; ++index)
+            {
+                std::vector<htd::vertex_t> & currentlyReachableVertices = reachable[index];
+
+                while (!currentlyReachableVertices.empty())
+                {
+                    htd::vertex_t reachableVertex = htd::selectRandomElement<htd::vertex_t>(currentlyReachableVertices);
+
+                    currentlyReachableVertices.erase(std::lower_bound(currentlyReachableVertices.begin(),
+                                                                      currentlyReachableVertices.end(),
+                                                                      reachableVertex));
+
+                    for (htd::vertex_t neighbor : eliminationGraph.neighborhood(reachableVertex))
+                    {
+                        if (reached.count(neighbor) == 0)
+                        {
+                            reached.insert(neighbor);
+
+                            if (labels[neighbor] > index)
+                            {
+                                triangulationNeighbors.push_back(neighbor);
+
+                                htd::insertSorted(reachable[labels[neighbor]], neighbor);
+                            }
+                            else
+                            {
+                                htd::insertSorted(currentlyReachableVertices, neighbor);
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (htd::vertex_t neighbor : triangulationNeighbors)
+            {
+                triangulatedGraph.addTriangulationEdge(selectedVertex, neighbor);
+
+                labels[neighbor]++;
+            }
+
+            eliminationGraph.removeVertex(selectedVertex);
+
+            reached.clear();
+        }
+
+        std::reverse(ordering.begin(), ordering.end());
+    }
+
     /**
      *  Fill the pool of vertices having maximum weight.
      *
@@ -711,7 +841,7 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
         {
             const std::vector<htd::vertex_t> & currentNeighborhood = graph.neighborhood(*it);
 
-            ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
+            ret = htd::set_intersection_size(currentNeighborhood, vertices) >= vertices.size() - 1;
         }
 
         return ret;
@@ -793,169 +923,156 @@ std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSepara
     {
         htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph(graph);
 
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph eliminationGraph(referenceGraph);
-
         htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(referenceGraph);
 
-        std::unordered_set<htd::vertex_t> vertices(size);
+        std::vector<htd::vertex_t> ordering;
 
-        htd::fillSet(eliminationGraph.vertices(), vertices);
+        std::vector<htd::vertex_t> generators;
 
-        std::vector<htd::vertex_t> pool;
+        implementation_->computeMinimalTriangulation(referenceGraph, triangulatedGraph, ordering, generators);
 
-        std::vector<std::size_t> labels(graph.vertexCount());
+        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph2(referenceGraph);
 
-        std::unordered_set<htd::vertex_t> reached;
+        std::vector<std::vector<htd::vertex_t>> cliqueSeparators;
 
-        std::unordered_map<std::size_t, std::vector<htd::vertex_t>> reachable;
+        for (htd::vertex_t vertex : ordering)
+        {
+            if (std::binary_search(generators.begin(), generators.end(), vertex))
+            {
+                const std::vector<htd::vertex_t> & currentNeighborhood = triangulatedGraph.neighborhood(vertex);
 
-        std::vector<htd::vertex_t> generators;
+                if (!currentNeighborhood.empty())
+                {
+                    if (implementation_->isComplete(referenceGraph, currentNeighborhood))
+                    {
+                        std::vector<htd::vertex_t> * component = implementation_->determineComponent(referenceGraph2, currentNeighborhood, vertex);
 
-        const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+                        for (htd::vertex_t componentVertex : *component)
+                        {
+                            referenceGraph2.removeVertex(componentVertex);
+                        }
 
-        std::vector<htd::vertex_t> ordering;
-        ordering.reserve(graph.vertexCount());
+                        cliqueSeparators.push_back(currentNeighborhood);
 
-        std::size_t lastLabel = (std::size_t)-1;
+                        delete component;
+                    }
+                }
+            }
 
-        for (htd::index_t index = 0; index < size; ++index)
-        {
-            labels[index] = 0;
+            triangulatedGraph.removeVertex(vertex);
         }
 
-        while (size > 0 && !managementInstance.isTerminated())
-        {
-            implementation_->fillMaxCardinalityPool(vertices, labels, pool);
+        std::sort(cliqueSeparators.begin(), cliqueSeparators.end());
 
-            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+        cliqueSeparators.erase(std::unique(cliqueSeparators.begin(), cliqueSeparators.end()), cliqueSeparators.end());
 
-            const std::vector<htd::vertex_t> & selectedNeighborhood = eliminationGraph.neighborhood(selectedVertex);
+        if (!cliqueSeparators.empty())
+        {
+            const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators);
 
-            if (lastLabel != (std::size_t)-1 && labels[selectedVertex] <= lastLabel)
+            for (htd::vertex_t vertex : separator)
             {
-                htd::insertSorted(generators, selectedVertex);
+                ret->push_back(referenceGraph.vertexName(vertex));
             }
+        }
+    }
 
-            lastLabel = labels[selectedVertex];
+    return ret;
+}
 
-            std::vector<htd::vertex_t> triangulationNeighbors(eliminationGraph.neighborhood(selectedVertex));
+void htd::CliqueMinimalSeparatorAlgorithm::computeAtoms(const htd::IGraphStructure & graph, std::vector<std::vector<htd::vertex_t>> & atoms, std::vector<std::vector<htd::vertex_t>> & separators) const
+{
+    std::size_t size = graph.vertexCount();
 
-            ordering.push_back(selectedVertex);
+    if (size > 0)
+    {
+        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph(graph);
 
-            vertices.erase(selectedVertex);
+        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(referenceGraph);
 
-            pool.clear();
+        std::vector<htd::vertex_t> ordering;
 
-            --size;
+        std::vector<htd::vertex_t> generators;
 
-            reached.insert(selectedVertex);
+        implementation_->computeMinimalTriangulation(referenceGraph, triangulatedGraph, ordering, generators);
 
-            for (htd::index_t index = 0; index <= size; ++index)
-            {
-                reachable[index].clear();
-            }
+        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph remainingGraph(referenceGraph);
 
-            for (htd::vertex_t neighbor : selectedNeighborhood)
-            {
-                reached.insert(neighbor);
+        std::vector<bool> removedVertices(size, false);
 
-                reachable[labels[neighbor]].push_back(neighbor);
-            }
+        const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-            for (htd::index_t index = 0; index <= size; ++index)
+        for (auto it = ordering.begin(); it != ordering.end() && !managementInstance.isTerminated(); ++it)
+        {
+            htd::vertex_t vertex = *it;
+
+            if (!removedVertices[vertex] && std::binary_search(generators.begin(), generators.end(), vertex))
             {
-                std::vector<htd::vertex_t> & currentlyReachableVertices = reachable[index];
+                const std::vector<htd::vertex_t> & currentNeighborhood = triangulatedGraph.neighborhood(vertex);
 
-                while (!currentlyReachableVertices.empty())
+                /* The empty set is a clique, i.e., connected components of the graph form atoms on their own. */
+                if (implementation_->isComplete(referenceGraph, currentNeighborhood))
                 {
-                    htd::vertex_t reachableVertex = htd::selectRandomElement<htd::vertex_t>(currentlyReachableVertices);
+                    std::vector<htd::vertex_t> * component = implementation_->determineComponent(remainingGraph, currentNeighborhood, vertex);
 
-                    currentlyReachableVertices.erase(std::lower_bound(currentlyReachableVertices.begin(),
-                                                                      currentlyReachableVertices.end(),
-                                                                      reachableVertex));
+                    std::vector<htd::vertex_t> atom;
 
-                    for (htd::vertex_t neighbor : eliminationGraph.neighborhood(reachableVertex))
+                    atom.reserve(component->size() + currentNeighborhood.size());
+
+                    for (htd::vertex_t componentVertex : *component)
                     {
-                        if (reached.count(neighbor) == 0)
-                        {
-                            reached.insert(neighbor);
+                        remainingGraph.removeVertex(componentVertex);
 
-                            if (labels[neighbor] > index)
-                            {
-                                triangulationNeighbors.push_back(neighbor);
+                        removedVertices[componentVertex] = true;
 
-                                htd::insertSorted(reachable[labels[neighbor]], neighbor);
-                            }
-                            else
-                            {
-                                htd::insertSorted(currentlyReachableVertices, neighbor);
-                            }
-                        }
+                        atom.push_back(referenceGraph.vertexName(componentVertex));
                     }
-                }
-            }
 
-            for (htd::vertex_t neighbor : triangulationNeighbors)
-            {
-                triangulatedGraph.addTriangulationEdge(selectedVertex, neighbor);
+                    std::vector<htd::vertex_t> separator;
 
-                labels[neighbor]++;
-            }
+                    separator.reserve(currentNeighborhood.size());
 
-            eliminationGraph.removeVertex(selectedVertex);
-
-            reached.clear();
-        }
-
-        std::reverse(ordering.begin(), ordering.end());
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph2(referenceGraph);
+                    for (htd::vertex_t separatorVertex : currentNeighborhood)
+                    {
+                        separator.push_back(referenceGraph.vertexName(separatorVertex));
+                    }
 
-        std::vector<std::vector<htd::vertex_t>> cliqueSeparators;
+                    std::sort(separator.begin(), separator.end());
 
-        for (htd::vertex_t vertex : ordering)
-        {
-            if (std::binary_search(generators.begin(), generators.end(), vertex))
-            {
-                const std::vector<htd::vertex_t> & currentNeighborhood = triangulatedGraph.neighborhood(vertex);
+                    atom.insert(atom.end(), separator.begin(), separator.end());
 
-                if (!currentNeighborhood.empty())
-                {
-                    if (implementation_->isComplete(referenceGraph, currentNeighborhood))
-                    {
-                        std::vector<htd::vertex_t> * component = implementation_->determineComponent(referenceGraph2, currentNeighborhood, vertex);
+                    std::sort(atom.begin(), atom.end());
 
-                        for (htd::vertex_t componentVertex : *component)
-                        {
-                            referenceGraph2.removeVertex(componentVertex);
-                        }
+                    atoms.push_back(std::move(atom));
 
-                        cliqueSeparators.push_back(currentNeighborhood);
+                    separators.push_back(std::move(separator));
 
-                        delete component;
-                    }
+                    delete component;
                 }
             }
 
             triangulatedGraph.removeVertex(vertex);
         }
 
-        std::sort(cliqueSeparators.begin(), cliqueSeparators.end());
-
-        cliqueSeparators.erase(std::unique(cliqueSeparators.begin(), cliqueSeparators.end()), cliqueSeparators.end());
+        std::vector<htd::vertex_t> lastAtom;
 
-        if (!cliqueSeparators.empty())
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
         {
-            const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators);
-
-            for (htd::vertex_t vertex : separator)
+            if (!removedVertices[vertex])
             {
-                ret->push_back(referenceGraph.vertexName(vertex));
+                lastAtom.push_back(referenceGraph.vertexName(vertex));
             }
         }
-    }
 
-    return ret;
+        if (!lastAtom.empty())
+        {
+            std::sort(lastAtom.begin(), lastAtom.end());
+
+            atoms.push_back(std::move(lastAtom));
+
+            separators.push_back(std::vector<htd::vertex_t>());
+        }
+    }
 }
 
 const htd::LibraryInstance * htd::CliqueMinimalSeparatorAlgorithm::managementInstance(void) const HTD_NOEXCEPT
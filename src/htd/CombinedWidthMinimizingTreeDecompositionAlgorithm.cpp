@@ -28,6 +28,7 @@
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/IWidthMinimizingTreeDecompositionAlgorithm.hpp>
 
+#include <htd/CancellationScope.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
@@ -44,7 +45,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), timeLimit_(0), computeInducedEdges_(true)
     {
 
     }
@@ -54,7 +55,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), timeLimit_(original.timeLimit_), computeInducedEdges_(original.computeInducedEdges_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -80,6 +81,11 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     std::vector<htd::ITreeDecompositionAlgorithm *> algorithms_;
 
+    /**
+     *  The wall-clock time limit of the algorithm (0=unlimited).
+     */
+    std::chrono::milliseconds timeLimit_;
+
     /**
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
@@ -131,6 +137,8 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -191,6 +199,8 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -227,13 +237,15 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     std::size_t bestMaxBagSize = maxBagSize;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     htd::ITreeDecomposition * ret = nullptr;
 
-    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && (ret == nullptr || !managementInstance.isTerminated()); ++it)
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -439,6 +451,16 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setComputeInducedEd
     }
 }
 
+std::chrono::milliseconds htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::timeLimit(void) const
+{
+    return implementation_->timeLimit_;
+}
+
+void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setTimeLimit(std::chrono::milliseconds timeLimit)
+{
+    implementation_->timeLimit_ = timeLimit;
+}
+
 const htd::LibraryInstance * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
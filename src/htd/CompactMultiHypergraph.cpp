@@ -0,0 +1,949 @@
+/*
+ * File:   CompactMultiHypergraph.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPACTMULTIHYPERGRAPH_CPP
+#define HTD_HTD_COMPACTMULTIHYPERGRAPH_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
+#include <htd/VectorAdapter.hpp>
+#include <htd/HyperedgeVector.hpp>
+
+#include <htd/Algorithm.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::CompactMultiHypergraph.
+ */
+struct htd::CompactMultiHypergraph::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager)
+        : managementInstance_(manager),
+          vertices_(),
+          vertexExistence_(),
+          neighborOffsets_(),
+          neighbors_(),
+          edgeIds_(),
+          edgeOffsets_(1, 0),
+          edgeElements_(),
+          incidenceOffsets_(),
+          incidences_(),
+          hyperedges_(),
+          hyperedgesInitialized_()
+    {
+
+    }
+
+    /**
+     *  Copy constructor of the implementation details structure.
+     *
+     *  @note The htd::Hyperedge objects of the original are not copied, they are re-created on demand.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original)
+        : managementInstance_(original.managementInstance_),
+          vertices_(original.vertices_),
+          vertexExistence_(original.vertexExistence_),
+          neighborOffsets_(original.neighborOffsets_),
+          neighbors_(original.neighbors_),
+          edgeIds_(original.edgeIds_),
+          edgeOffsets_(original.edgeOffsets_),
+          edgeElements_(original.edgeElements_),
+          incidenceOffsets_(original.incidenceOffsets_),
+          incidences_(original.incidences_),
+          hyperedges_(),
+          hyperedgesInitialized_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Getter for the position of a vertex within the vectors indexed by vertices.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The position of the vertex within the vectors indexed by vertices.
+     */
+    inline htd::index_t vertexIndex(htd::vertex_t vertex) const
+    {
+        return vertex - htd::Vertex::FIRST;
+    }
+
+    /**
+     *  Initialize the vectors indexed by vertices based on the (ascendingly sorted) vector of vertices.
+     */
+    void initializeVertexIndex(void)
+    {
+        std::size_t range = vertices_.empty() ? 0 : vertexIndex(vertices_.back()) + 1;
+
+        vertexExistence_.assign(range, false);
+
+        for (htd::vertex_t vertex : vertices_)
+        {
+            vertexExistence_[vertexIndex(vertex)] = true;
+        }
+    }
+
+    /**
+     *  Compute the vertex-to-hyperedge incidences based on the endpoints of the hyperedges.
+     *
+     *  The incidence list of each vertex contains the positions of the hyperedges containing
+     *  the vertex in ascending order. Each hyperedge is listed at most once per vertex.
+     */
+    void computeIncidences(void)
+    {
+        std::size_t range = vertexExistence_.size();
+
+        std::size_t edgeCount = edgeIds_.size();
+
+        std::vector<htd::index_t> lastEdge(range, edgeCount);
+
+        incidenceOffsets_.assign(range + 1, 0);
+
+        for (htd::index_t edge = 0; edge < edgeCount; ++edge)
+        {
+            for (htd::index_t position = edgeOffsets_[edge]; position < edgeOffsets_[edge + 1]; ++position)
+            {
+                htd::index_t index = vertexIndex(edgeElements_[position]);
+
+                if (lastEdge[index] != edge)
+                {
+                    lastEdge[index] = edge;
+
+                    ++(incidenceOffsets_[index + 1]);
+                }
+            }
+        }
+
+        for (htd::index_t index = 0; index < range; ++index)
+        {
+            incidenceOffsets_[index + 1] += incidenceOffsets_[index];
+        }
+
+        incidences_.resize(incidenceOffsets_[range]);
+
+        std::vector<htd::index_t> insertionPositions(incidenceOffsets_.begin(), incidenceOffsets_.end() - 1);
+
+        std::fill(lastEdge.begin(), lastEdge.end(), edgeCount);
+
+        for (htd::index_t edge = 0; edge < edgeCount; ++edge)
+        {
+            for (htd::index_t position = edgeOffsets_[edge]; position < edgeOffsets_[edge + 1]; ++position)
+            {
+                htd::index_t index = vertexIndex(edgeElements_[position]);
+
+                if (lastEdge[index] != edge)
+                {
+                    lastEdge[index] = edge;
+
+                    incidences_[insertionPositions[index]++] = edge;
+                }
+            }
+        }
+    }
+
+    /**
+     *  Compute the neighborhoods of all vertices based on the incidences of the vertices.
+     *
+     *  A vertex is a neighbor of itself if and only if it occurs at least twice in one of its incident hyperedges.
+     */
+    void computeNeighborhoods(void)
+    {
+        std::size_t range = vertexExistence_.size();
+
+        std::vector<htd::index_t> lastVertex(range, range);
+
+        neighborOffsets_.assign(range + 1, 0);
+
+        neighbors_.clear();
+
+        for (htd::index_t index = 0; index < range; ++index)
+        {
+            if (vertexExistence_[index])
+            {
+                htd::vertex_t vertex = index + htd::Vertex::FIRST;
+
+                std::size_t neighborhoodBegin = neighbors_.size();
+
+                for (htd::index_t incidence = incidenceOffsets_[index]; incidence < incidenceOffsets_[index + 1]; ++incidence)
+                {
+                    htd::index_t edge = incidences_[incidence];
+
+                    std::size_t occurrences = 0;
+
+                    for (htd::index_t position = edgeOffsets_[edge]; position < edgeOffsets_[edge + 1]; ++position)
+                    {
+                        htd::vertex_t element = edgeElements_[position];
+
+                        if (element == vertex)
+                        {
+                            ++occurrences;
+                        }
+
+                        if ((element != vertex || occurrences > 1) && lastVertex[vertexIndex(element)] != index)
+                        {
+                            lastVertex[vertexIndex(element)] = index;
+
+                            neighbors_.push_back(element);
+                        }
+                    }
+                }
+
+                std::sort(neighbors_.begin() + neighborhoodBegin, neighbors_.end());
+            }
+
+            neighborOffsets_[index + 1] = neighbors_.size();
+        }
+
+        neighbors_.shrink_to_fit();
+    }
+
+    /**
+     *  Check whether the hyperedge at a given position has exactly the given endpoints in the given order.
+     *
+     *  @param[in] edge     The position of the hyperedge.
+     *  @param[in] begin    An iterator pointing to the first of the endpoints.
+     *  @param[in] end      An iterator pointing to the end of the endpoints.
+     *  @param[in] size     The number of endpoints.
+     *
+     *  @return True if the hyperedge at the given position has exactly the given endpoints in the given order, false otherwise.
+     */
+    template <typename Iterator>
+    bool hasElements(htd::index_t edge, Iterator begin, Iterator end, std::size_t size) const
+    {
+        return edgeOffsets_[edge + 1] - edgeOffsets_[edge] == size &&
+               htd::equal(edgeElements_.begin() + edgeOffsets_[edge], edgeElements_.begin() + edgeOffsets_[edge + 1], begin, end);
+    }
+
+    /**
+     *  Collect the IDs of all hyperedges which have exactly the given endpoints in the given order.
+     *
+     *  @param[in] begin    An iterator pointing to the first of the endpoints.
+     *  @param[in] end      An iterator pointing to the end of the endpoints.
+     *  @param[in] size     The number of endpoints.
+     *  @param[out] target  The target vector to which the IDs of the matching hyperedges shall be appended.
+     *  @param[in] firstOnly A boolean flag whether the search shall stop after the first match.
+     */
+    template <typename Iterator>
+    void collectEdgeIds(Iterator begin, Iterator end, std::size_t size, std::vector<htd::id_t> & target, bool firstOnly) const
+    {
+        if (size > 0)
+        {
+            htd::vertex_t firstElement = *begin;
+
+            if (firstElement >= htd::Vertex::FIRST && vertexIndex(firstElement) < vertexExistence_.size() && vertexExistence_[vertexIndex(firstElement)])
+            {
+                htd::index_t index = vertexIndex(firstElement);
+
+                for (htd::index_t incidence = incidenceOffsets_[index]; incidence < incidenceOffsets_[index + 1]; ++incidence)
+                {
+                    htd::index_t edge = incidences_[incidence];
+
+                    if (hasElements(edge, begin, end, size))
+                    {
+                        target.push_back(edgeIds_[edge]);
+
+                        if (firstOnly)
+                        {
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     *  Create a new htd::Hyperedge object for the hyperedge at a given position.
+     *
+     *  @param[in] edge The position of the hyperedge.
+     *
+     *  @return A new htd::Hyperedge object for the hyperedge at the given position.
+     */
+    htd::Hyperedge createHyperedge(htd::index_t edge) const
+    {
+        htd::index_t begin = edgeOffsets_[edge];
+        htd::index_t end = edgeOffsets_[edge + 1];
+
+        switch (end - begin)
+        {
+            case 1:
+            {
+                return htd::Hyperedge(edgeIds_[edge], edgeElements_[begin]);
+            }
+            case 2:
+            {
+                return htd::Hyperedge(edgeIds_[edge], edgeElements_[begin], edgeElements_[begin + 1]);
+            }
+            default:
+            {
+                return htd::Hyperedge(edgeIds_[edge], std::vector<htd::vertex_t>(edgeElements_.begin() + begin, edgeElements_.begin() + end));
+            }
+        }
+    }
+
+    /**
+     *  Access the htd::Hyperedge objects of the graph. The objects are created on the first call of this method.
+     *
+     *  @return The htd::Hyperedge objects of the graph sorted by ID in ascending order.
+     */
+    const std::shared_ptr<std::vector<htd::Hyperedge>> & hyperedgeObjects(void) const
+    {
+        std::call_once(hyperedgesInitialized_, [&]()
+        {
+            std::shared_ptr<std::vector<htd::Hyperedge>> result = std::make_shared<std::vector<htd::Hyperedge>>();
+
+            result->reserve(edgeIds_.size());
+
+            for (htd::index_t edge = 0; edge < edgeIds_.size(); ++edge)
+            {
+                result->push_back(createHyperedge(edge));
+            }
+
+            hyperedges_ = std::move(result);
+        });
+
+        return hyperedges_;
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The vector of all vertices in the graph sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> vertices_;
+
+    /**
+     *  The vector indicating for each vertex ID in the range of the graph whether the vertex exists.
+     */
+    std::vector<bool> vertexExistence_;
+
+    /**
+     *  The offsets of the neighborhoods of the vertices within the vector neighbors_.
+     */
+    std::vector<htd::index_t> neighborOffsets_;
+
+    /**
+     *  The neighborhoods of all vertices. The neighborhood of each vertex is sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> neighbors_;
+
+    /**
+     *  The IDs of the hyperedges sorted in ascending order.
+     */
+    std::vector<htd::id_t> edgeIds_;
+
+    /**
+     *  The offsets of the hyperedges within the vector edgeElements_.
+     */
+    std::vector<htd::index_t> edgeOffsets_;
+
+    /**
+     *  The endpoints of all hyperedges.
+     */
+    std::vector<htd::vertex_t> edgeElements_;
+
+    /**
+     *  The offsets of the incidence lists of the vertices within the vector incidences_.
+     */
+    std::vector<htd::index_t> incidenceOffsets_;
+
+    /**
+     *  The positions of the hyperedges containing the respective vertices.
+     */
+    std::vector<htd::index_t> incidences_;
+
+    /**
+     *  The htd::Hyperedge objects of the graph, created on demand.
+     */
+    mutable std::shared_ptr<std::vector<htd::Hyperedge>> hyperedges_;
+
+    /**
+     *  The flag ensuring that the htd::Hyperedge objects of the graph are created only once.
+     */
+    mutable std::once_flag hyperedgesInitialized_;
+};
+
+htd::CompactMultiHypergraph::CompactMultiHypergraph(const htd::IMultiHypergraph & original) : implementation_(new Implementation(original.managementInstance()))
+{
+    Implementation & implementation = *implementation_;
+
+    original.copyVerticesTo(implementation.vertices_);
+
+    implementation.initializeVertexIndex();
+
+    std::size_t range = implementation.vertexExistence_.size();
+
+    implementation.neighborOffsets_.assign(range + 1, 0);
+
+    for (htd::vertex_t vertex : implementation.vertices_)
+    {
+        htd::index_t index = implementation.vertexIndex(vertex);
+
+        implementation.neighborOffsets_[index + 1] = original.neighborCount(vertex);
+    }
+
+    for (htd::index_t index = 0; index < range; ++index)
+    {
+        implementation.neighborOffsets_[index + 1] += implementation.neighborOffsets_[index];
+    }
+
+    implementation.neighbors_.reserve(implementation.neighborOffsets_[range]);
+
+    for (htd::vertex_t vertex : implementation.vertices_)
+    {
+        original.copyNeighborsTo(vertex, implementation.neighbors_);
+    }
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = original.hyperedges();
+
+    implementation.edgeIds_.reserve(hyperedgeCollection.size());
+    implementation.edgeOffsets_.reserve(hyperedgeCollection.size() + 1);
+
+    for (const htd::Hyperedge & hyperedge : hyperedgeCollection)
+    {
+        implementation.edgeIds_.push_back(hyperedge.id());
+
+        implementation.edgeElements_.insert(implementation.edgeElements_.end(), hyperedge.begin(), hyperedge.end());
+
+        implementation.edgeOffsets_.push_back(implementation.edgeElements_.size());
+    }
+
+    implementation.computeIncidences();
+}
+
+htd::CompactMultiHypergraph::CompactMultiHypergraph(const htd::LibraryInstance * const manager,
+                                                    std::size_t vertexCount,
+                                                    std::vector<htd::index_t> && edgeOffsets,
+                                                    std::vector<htd::vertex_t> && edgeElements) : implementation_(new Implementation(manager))
+{
+    HTD_ASSERT(!edgeOffsets.empty() && edgeOffsets[0] == 0 && edgeOffsets.back() == edgeElements.size())
+
+    Implementation & implementation = *implementation_;
+
+    implementation.vertices_.resize(vertexCount);
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        implementation.vertices_[index] = htd::Vertex::FIRST + index;
+    }
+
+    implementation.vertexExistence_.assign(vertexCount, true);
+
+    implementation.edgeOffsets_ = std::move(edgeOffsets);
+
+    implementation.edgeElements_ = std::move(edgeElements);
+
+    #ifndef NDEBUG
+    for (htd::vertex_t vertex : implementation.edgeElements_)
+    {
+        HTD_ASSERT(isVertex(vertex))
+    }
+    #endif
+
+    implementation.edgeIds_.resize(implementation.edgeOffsets_.size() - 1);
+
+    for (htd::index_t index = 0; index < implementation.edgeIds_.size(); ++index)
+    {
+        implementation.edgeIds_[index] = htd::Id::FIRST + index;
+    }
+
+    implementation.computeIncidences();
+
+    implementation.computeNeighborhoods();
+}
+
+htd::CompactMultiHypergraph::CompactMultiHypergraph(const htd::CompactMultiHypergraph & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::CompactMultiHypergraph::~CompactMultiHypergraph()
+{
+
+}
+
+std::size_t htd::CompactMultiHypergraph::vertexCount(void) const
+{
+    return implementation_->vertices_.size();
+}
+
+std::size_t htd::CompactMultiHypergraph::edgeCount(void) const
+{
+    return implementation_->edgeIds_.size();
+}
+
+std::size_t htd::CompactMultiHypergraph::edgeCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::index_t index = implementation_->vertexIndex(vertex);
+
+    return implementation_->incidenceOffsets_[index + 1] - implementation_->incidenceOffsets_[index];
+}
+
+bool htd::CompactMultiHypergraph::isVertex(htd::vertex_t vertex) const
+{
+    return vertex >= htd::Vertex::FIRST &&
+           implementation_->vertexIndex(vertex) < implementation_->vertexExistence_.size() &&
+           implementation_->vertexExistence_[implementation_->vertexIndex(vertex)];
+}
+
+bool htd::CompactMultiHypergraph::isEdge(htd::id_t edgeId) const
+{
+    return std::binary_search(implementation_->edgeIds_.begin(), implementation_->edgeIds_.end(), edgeId);
+}
+
+bool htd::CompactMultiHypergraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    std::vector<htd::vertex_t> elements { vertex1, vertex2 };
+
+    return isEdge(elements);
+}
+
+bool htd::CompactMultiHypergraph::isEdge(const std::vector<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), result, true);
+
+    return !result.empty();
+}
+
+bool htd::CompactMultiHypergraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), result, true);
+
+    return !result.empty();
+}
+
+htd::ConstCollection<htd::id_t> htd::CompactMultiHypergraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    std::vector<htd::vertex_t> elements { vertex1, vertex2 };
+
+    return associatedEdgeIds(elements);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompactMultiHypergraph::associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), ret.container(), false);
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompactMultiHypergraph::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), ret.container(), false);
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompactMultiHypergraph::vertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
+}
+
+const std::vector<htd::vertex_t> & htd::CompactMultiHypergraph::vertexVector(void) const
+{
+    return implementation_->vertices_;
+}
+
+void htd::CompactMultiHypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
+{
+    target.insert(target.end(), implementation_->vertices_.begin(), implementation_->vertices_.end());
+}
+
+htd::ConstSpan<htd::vertex_t> htd::CompactMultiHypergraph::vertexSpan(void) const
+{
+    return htd::ConstSpan<htd::vertex_t>(implementation_->vertices_);
+}
+
+htd::vertex_t htd::CompactMultiHypergraph::vertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->vertices_.size())
+
+    return implementation_->vertices_[index];
+}
+
+bool htd::CompactMultiHypergraph::isConnected(void) const
+{
+    const Implementation & implementation = *implementation_;
+
+    bool ret = true;
+
+    if (!implementation.vertices_.empty())
+    {
+        std::vector<bool> visitedVertices(implementation.vertexExistence_.size(), false);
+
+        std::vector<htd::vertex_t> originStack;
+
+        std::size_t visitedVertexCount = 1;
+
+        htd::vertex_t startingVertex = implementation.vertices_[0];
+
+        visitedVertices[implementation.vertexIndex(startingVertex)] = true;
+
+        originStack.push_back(startingVertex);
+
+        while (!originStack.empty())
+        {
+            htd::index_t index = implementation.vertexIndex(originStack.back());
+
+            originStack.pop_back();
+
+            for (htd::index_t position = implementation.neighborOffsets_[index]; position < implementation.neighborOffsets_[index + 1]; ++position)
+            {
+                htd::vertex_t neighbor = implementation.neighbors_[position];
+
+                if (!visitedVertices[implementation.vertexIndex(neighbor)])
+                {
+                    visitedVertices[implementation.vertexIndex(neighbor)] = true;
+
+                    ++visitedVertexCount;
+
+                    originStack.push_back(neighbor);
+                }
+            }
+        }
+
+        ret = visitedVertexCount == implementation.vertices_.size();
+    }
+
+    return ret;
+}
+
+bool htd::CompactMultiHypergraph::isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+    const Implementation & implementation = *implementation_;
+
+    bool ret = vertex1 == vertex2;
+
+    if (!ret)
+    {
+        std::vector<bool> visitedVertices(implementation.vertexExistence_.size(), false);
+
+        std::vector<htd::vertex_t> originStack;
+
+        visitedVertices[implementation.vertexIndex(vertex1)] = true;
+
+        originStack.push_back(vertex1);
+
+        while (!ret && !originStack.empty())
+        {
+            htd::index_t index = implementation.vertexIndex(originStack.back());
+
+            originStack.pop_back();
+
+            for (htd::index_t position = implementation.neighborOffsets_[index]; !ret && position < implementation.neighborOffsets_[index + 1]; ++position)
+            {
+                htd::vertex_t neighbor = implementation.neighbors_[position];
+
+                if (!visitedVertices[implementation.vertexIndex(neighbor)])
+                {
+                    visitedVertices[implementation.vertexIndex(neighbor)] = true;
+
+                    originStack.push_back(neighbor);
+
+                    ret = neighbor == vertex2;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool htd::CompactMultiHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+{
+    HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+
+    htd::index_t index = implementation_->vertexIndex(vertex);
+
+    auto begin = implementation_->neighbors_.begin();
+
+    return std::binary_search(begin + implementation_->neighborOffsets_[index], begin + implementation_->neighborOffsets_[index + 1], neighbor);
+}
+
+std::size_t htd::CompactMultiHypergraph::neighborCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::index_t index = implementation_->vertexIndex(vertex);
+
+    return implementation_->neighborOffsets_[index + 1] - implementation_->neighborOffsets_[index];
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompactMultiHypergraph::neighbors(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::index_t index = implementation_->vertexIndex(vertex);
+
+    auto begin = implementation_->neighbors_.cbegin();
+
+    return htd::ConstCollection<htd::vertex_t>(htd::ConstIterator<htd::vertex_t>(begin + implementation_->neighborOffsets_[index]),
+                                               htd::ConstIterator<htd::vertex_t>(begin + implementation_->neighborOffsets_[index + 1]));
+}
+
+void htd::CompactMultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::index_t index = implementation_->vertexIndex(vertex);
+
+    auto begin = implementation_->neighbors_.begin();
+
+    target.insert(target.end(), begin + implementation_->neighborOffsets_[index], begin + implementation_->neighborOffsets_[index + 1]);
+}
+
+htd::ConstSpan<htd::vertex_t> htd::CompactMultiHypergraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    HTD_UNUSED(buffer)
+
+    htd::index_t index = implementation_->vertexIndex(vertex);
+
+    htd::index_t offset = implementation_->neighborOffsets_[index];
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighbors_.data() + offset, implementation_->neighborOffsets_[index + 1] - offset);
+}
+
+htd::vertex_t htd::CompactMultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(index < neighborCount(vertex))
+
+    return implementation_->neighbors_[implementation_->neighborOffsets_[implementation_->vertexIndex(vertex)] + index];
+}
+
+std::size_t htd::CompactMultiHypergraph::isolatedVertexCount(void) const
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (neighborCount(vertex) == 0)
+        {
+            ++ret;
+        }
+    }
+
+    return ret;
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompactMultiHypergraph::isolatedVertices(void) const
+{
+    htd::VectorAdapter<htd::vertex_t> ret;
+
+    auto & result = ret.container();
+
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (neighborCount(vertex) == 0)
+        {
+            result.push_back(vertex);
+        }
+    }
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
+}
+
+htd::vertex_t htd::CompactMultiHypergraph::isolatedVertexAtPosition(htd::index_t index) const
+{
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (neighborCount(vertex) == 0)
+        {
+            if (index == 0)
+            {
+                return vertex;
+            }
+
+            --index;
+        }
+    }
+
+    throw std::out_of_range("htd::vertex_t htd::CompactMultiHypergraph::isolatedVertexAtPosition(htd::index_t) const");
+}
+
+bool htd::CompactMultiHypergraph::isIsolatedVertex(htd::vertex_t vertex) const
+{
+    return neighborCount(vertex) == 0;
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompactMultiHypergraph::hyperedges(void) const
+{
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->hyperedgeObjects()));
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompactMultiHypergraph::hyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation & implementation = *implementation_;
+
+    htd::VectorAdapter<htd::Hyperedge> ret;
+
+    auto & result = ret.container();
+
+    htd::index_t index = implementation.vertexIndex(vertex);
+
+    result.reserve(implementation.incidenceOffsets_[index + 1] - implementation.incidenceOffsets_[index]);
+
+    for (htd::index_t incidence = implementation.incidenceOffsets_[index]; incidence < implementation.incidenceOffsets_[index + 1]; ++incidence)
+    {
+        result.push_back(implementation.createHyperedge(implementation.incidences_[incidence]));
+    }
+
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
+}
+
+const htd::Hyperedge & htd::CompactMultiHypergraph::hyperedge(htd::id_t edgeId) const
+{
+    const std::vector<htd::id_t> & edgeIds = implementation_->edgeIds_;
+
+    auto position = std::lower_bound(edgeIds.begin(), edgeIds.end(), edgeId);
+
+    HTD_ASSERT(position != edgeIds.end() && *position == edgeId)
+
+    return (*(implementation_->hyperedgeObjects()))[std::distance(edgeIds.begin(), position)];
+}
+
+const htd::Hyperedge & htd::CompactMultiHypergraph::hyperedgeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->edgeIds_.size())
+
+    return implementation_->hyperedgeObjects()->at(index);
+}
+
+const htd::Hyperedge & htd::CompactMultiHypergraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
+{
+    if (isVertex(vertex))
+    {
+        htd::index_t vertexIndex = implementation_->vertexIndex(vertex);
+
+        htd::index_t incidence = implementation_->incidenceOffsets_[vertexIndex] + index;
+
+        if (incidence < implementation_->incidenceOffsets_[vertexIndex + 1])
+        {
+            return (*(implementation_->hyperedgeObjects()))[implementation_->incidences_[incidence]];
+        }
+    }
+
+    throw std::out_of_range("const htd::Hyperedge & htd::CompactMultiHypergraph::hyperedgeAtPosition(htd::index_t, htd::vertex_t) const");
+}
+
+htd::FilteredHyperedgeCollection htd::CompactMultiHypergraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->hyperedgeObjects()), indices);
+}
+
+htd::FilteredHyperedgeCollection htd::CompactMultiHypergraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->hyperedgeObjects()), std::move(indices));
+}
+
+std::size_t htd::CompactMultiHypergraph::hyperedgeSizeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->edgeIds_.size())
+
+    return implementation_->edgeOffsets_[index + 1] - implementation_->edgeOffsets_[index];
+}
+
+void htd::CompactMultiHypergraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(index < implementation_->edgeIds_.size())
+
+    auto begin = implementation_->edgeElements_.begin();
+
+    target.insert(target.end(), begin + implementation_->edgeOffsets_[index], begin + implementation_->edgeOffsets_[index + 1]);
+}
+
+const htd::LibraryInstance * htd::CompactMultiHypergraph::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::CompactMultiHypergraph::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::CompactMultiHypergraph * htd::CompactMultiHypergraph::clone(void) const
+{
+    return new htd::CompactMultiHypergraph(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IGraphStructure * htd::CompactMultiHypergraph::cloneGraphStructure(void) const
+{
+    return clone();
+}
+
+htd::IMultiHypergraph * htd::CompactMultiHypergraph::cloneMultiHypergraph(void) const
+{
+    return clone();
+}
+#endif
+
+htd::CompactMultiHypergraph & htd::CompactMultiHypergraph::operator=(const htd::CompactMultiHypergraph & original)
+{
+    if (this != &original)
+    {
+        implementation_.reset(new Implementation(*(original.implementation_)));
+    }
+
+    return *this;
+}
+
+#endif /* HTD_HTD_COMPACTMULTIHYPERGRAPH_CPP */
@@ -0,0 +1,102 @@
+/*
+ * File:   DenseAdjacencyMatrix.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_DENSEADJACENCYMATRIX_CPP
+#define HTD_HTD_DENSEADJACENCYMATRIX_CPP
+
+#include <htd/DenseAdjacencyMatrix.hpp>
+
+#include <algorithm>
+
+/**
+ *  The maximum number of vertices for which the dense representation is always recommended.
+ */
+static const std::size_t HTD_DENSE_ADJACENCY_SMALL_VERTEX_COUNT = 1024;
+
+/**
+ *  The maximum number of vertices for which the dense representation is recommended at all.
+ */
+static const std::size_t HTD_DENSE_ADJACENCY_MAX_VERTEX_COUNT = 16384;
+
+htd::DenseAdjacencyMatrix::DenseAdjacencyMatrix(const std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::vertex_t> & vertices)
+    : vertices_(vertices), wordCount_(requiredWordCount(vertices.size())), words_(vertices.size() * wordCount_, 0)
+{
+    HTD_ASSERT(std::is_sorted(vertices.begin(), vertices.end()))
+
+    for (htd::index_t index = 0; index < vertices_.size(); ++index)
+    {
+        const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertices_[index]];
+
+        word_t * currentRow = words_.data() + index * wordCount_;
+
+        auto position = vertices_.begin();
+
+        /* Both sequences are sorted, hence the positions of the neighbors can be determined in a single pass. */
+        for (auto it = currentNeighborhood.begin(); it != currentNeighborhood.end() && position != vertices_.end(); ++it)
+        {
+            position = std::lower_bound(position, vertices_.end(), *it);
+
+            if (position != vertices_.end() && *position == *it)
+            {
+                set(currentRow, static_cast<htd::index_t>(std::distance(vertices_.begin(), position)));
+            }
+        }
+    }
+}
+
+htd::DenseAdjacencyMatrix::DenseAdjacencyMatrix(const htd::DenseAdjacencyMatrix & original) : vertices_(original.vertices_), wordCount_(original.wordCount_), words_(original.words_)
+{
+
+}
+
+htd::DenseAdjacencyMatrix::~DenseAdjacencyMatrix()
+{
+
+}
+
+bool htd::DenseAdjacencyMatrix::isRecommended(std::size_t vertexCount, std::size_t edgeCount) HTD_NOEXCEPT
+{
+    bool ret = false;
+
+    if (vertexCount > 0 && vertexCount <= HTD_DENSE_ADJACENCY_MAX_VERTEX_COUNT)
+    {
+        ret = vertexCount <= HTD_DENSE_ADJACENCY_SMALL_VERTEX_COUNT || 2 * edgeCount >= vertexCount * requiredWordCount(vertexCount);
+    }
+
+    return ret;
+}
+
+htd::DenseAdjacencyMatrix & htd::DenseAdjacencyMatrix::operator=(const htd::DenseAdjacencyMatrix & original)
+{
+    if (this != &original)
+    {
+        vertices_ = original.vertices_;
+        wordCount_ = original.wordCount_;
+        words_ = original.words_;
+    }
+
+    return *this;
+}
+
+#endif /* HTD_HTD_DENSEADJACENCYMATRIX_CPP */
@@ -72,7 +72,7 @@ htd::DepthFirstConnectedComponentAlgorithm::~DepthFirstConnectedComponentAlgorit
 
 void htd::DepthFirstConnectedComponentAlgorithm::determineComponents(const htd::IGraphStructure & graph, std::vector<std::vector<htd::vertex_t>> & target) const
 {
-    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
     if (!vertexCollection.empty())
     {
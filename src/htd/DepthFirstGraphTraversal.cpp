@@ -33,6 +33,7 @@
 #include <tuple>
 #include <stdexcept>
 #include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::DepthFirstGraphTraversal.
@@ -78,6 +79,8 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
 
     std::unordered_set<htd::vertex_t> visitedVertices;
 
+    std::vector<htd::vertex_t> neighborBuffer;
+
     std::size_t currentDistance = 0;
     htd::vertex_t currentVertex = startingVertex;
 
@@ -99,20 +102,12 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
 
             originDeque.pop_front();
 
-            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
-
-            auto it = neighborCollection.begin();
-
-            for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
+            for (htd::vertex_t neighbor : graph.neighborSpan(currentVertex, neighborBuffer))
             {
-                htd::vertex_t neighbor = *it;
-
                 if (visitedVertices.count(neighbor) == 0)
                 {
                     originDeque.emplace_back(neighbor, currentVertex, currentDistance + 1);
                 }
-
-                ++it;
             }
         }
         else
@@ -28,99 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
-#include <htd/IFlow.hpp>
+#include <htd/ResidualNetwork.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <stack>
-#include <stdexcept>
-#include <unordered_map>
-
-namespace htd
-{
-    /**
-     *  Internal implementation of the htd::IFlow interface.
-     */
-    class Flow : public htd::IFlow
-    {
-        public:
-            /**
-             *  Constructor of a new flow data structure.
-             *
-             *  @param[in] vertexCount  The number of vertices of the flow data structure.
-             *  @param[in] source       The source vertex.
-             *  @param[in] target       The target vertex.
-             */
-            Flow(std::size_t vertexCount, htd::vertex_t source, htd::vertex_t target) : flow_(vertexCount, std::vector<long long>(vertexCount)), source_(source), target_(target)
-            {
-
-            }
-
-            /**
-             *  Copy constructor of a new flow data structure.
-             *
-             *  @param[in] original The original flow data structure.
-             */
-            Flow(const Flow & original) : flow_(original.flow_), source_(original.source_), target_(original.target_)
-            {
-
-            }
-
-            std::size_t vertexCount(void) const HTD_OVERRIDE
-            {
-                return flow_.size();
-            }
-
-            htd::vertex_t source(void) const HTD_OVERRIDE
-            {
-                return source_;
-            }
-
-            htd::vertex_t target(void) const HTD_OVERRIDE
-            {
-                return target_;
-            }
-
-            std::size_t value(void) const HTD_OVERRIDE
-            {
-                std::size_t ret = 0;
-
-                for (const std::vector<long long> & current : flow_)
-                {
-                    ret = ret + static_cast<std::size_t>(current[target_]);
-                }
-
-                return ret;
-            }
-
-            virtual long long flow(htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(source < vertexCount() && target < vertexCount())
-
-                return flow_[source][target];
-            }
-
-            Flow * clone(void) const HTD_OVERRIDE
-            {
-                return new Flow(*this);
-            }
-
-            /**
-             *  The flow.
-             */
-            std::vector<std::vector<long long>> flow_;
-
-            /**
-             *  The source vertex.
-             */
-            htd::vertex_t source_;
-
-            /**
-             *  The target vertex.
-             */
-            htd::vertex_t target_;
-    };
-}
 
 /**
  *  Private implementation details of class htd::DinitzMaxFlowAlgorithm.
@@ -148,47 +58,27 @@ struct htd::DinitzMaxFlowAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Try to improve an existing flow.
+     *  Compute the level graph of the residual network, i.e., the distances from the source vertex to all other vertices.
      *
-     *  @param[in] flowNetwork  The network for which the improved flow shall be computed.
-     *  @param[in] flow         The (currently) best known flow within the given flow network.
+     *  @param[in] residualNetwork  The residual network. Its label buffer is updated with the distances ((std::size_t)-1 for unreachable vertices).
+     *  @param[in] source           The source vertex.
+     *  @param[in] target           The target vertex.
      *
-     *  @return A matrix containing the updated residual capacities or nullptr if the provided flow is already maximal.
+     *  @return True if the target vertex is reachable from the source vertex, false otherwise.
      */
-    std::vector<std::vector<std::size_t>> * improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const;
+    bool computeLevelGraph(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target) const;
 
     /**
-     *  Perform an improvement step for the flow between the source and the target vertex.
+     *  Compute a blocking flow within the level graph of the residual network.
      *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The residual capacities which will be updated.
-     *  @param[in] distances    The distances from each vertex to the target vertex of the flow network.
-     *  @param[in] source       The source vertex.
-     *  @param[in] target       The target vertex.
-     */
-    void performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const;
-
-    /**
-     *  Compute the minimum distances between the vertices of the given flow network to the selected target vertex.
+     *  @param[in] residualNetwork  The residual network. Its label buffer must contain the levels of the vertices.
+     *  @param[in] source           The source vertex.
+     *  @param[in] target           The target vertex.
+     *  @param[in] flowLimit        The maximum value of the flow which shall be pushed from the source to the target.
      *
-     *  @param[in] flowNetwork  The flow network.
-     *  @param[in] capacities   The current residual capacities of the flow network.
-     *  @param[in] target       The target vertex.
-     *
-     *  @return A vector containing the distances from each vertex to the target vertex.
+     *  @return The value of the blocking flow or the limit if the blocking flow would exceed it.
      */
-    std::vector<std::size_t> * computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
-
-    /**
-     *  Compute the minimum capacity within the given path starting from the given target vertex.
-     *
-     *  @param[in] path         A sequence of vertices which defines the path to investigate.
-     *  @param[in] capacities   The current residual capacities of the flow network.
-     *  @param[in] target       The target vertex.
-     *
-     *  @return The minimum capacity within the given path.
-     */
-    std::size_t computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const;
+    std::size_t computeBlockingFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const;
 };
 
 htd::DinitzMaxFlowAlgorithm::DinitzMaxFlowAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -203,25 +93,24 @@ htd::DinitzMaxFlowAlgorithm::~DinitzMaxFlowAlgorithm()
 
 htd::IFlow * htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    htd::ResidualNetwork residualNetwork(flowNetwork);
 
-    htd::Flow * ret = new htd::Flow(vertexCount, source, target);
+    determineMaximumFlow(residualNetwork, source, target, (std::size_t)-1);
 
-    std::vector<std::vector<std::size_t>> * capacities = implementation_->improveFlow(flowNetwork, *ret);
+    return residualNetwork.createFlow(source, target);
+}
 
-    while (capacities != nullptr)
-    {
-        for (htd::index_t i = 0; i < vertexCount; ++i)
-        {
-            for (htd::index_t j = 0; j < vertexCount; ++j)
-            {
-                ret->flow_[i][j] = flowNetwork.capacity(i, j) - (*capacities)[i][j];
-            }
-        }
+std::size_t htd::DinitzMaxFlowAlgorithm::determineMaximumFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const
+{
+    HTD_ASSERT(source < residualNetwork.vertexCount() && target < residualNetwork.vertexCount())
+
+    std::size_t ret = 0;
 
-        delete capacities;
+    residualNetwork.reset(residualNetwork.computeCapacityBound(source, target));
 
-        capacities = implementation_->improveFlow(flowNetwork, *ret);
+    while (ret < flowLimit && source != target && !implementation_->managementInstance_->isTerminated() && implementation_->computeLevelGraph(residualNetwork, source, target))
+    {
+        ret += implementation_->computeBlockingFlow(residualNetwork, source, target, flowLimit - ret);
     }
 
     return ret;
@@ -244,162 +133,129 @@ htd::DinitzMaxFlowAlgorithm * htd::DinitzMaxFlowAlgorithm::clone(void) const
     return new htd::DinitzMaxFlowAlgorithm(managementInstance());
 }
 
-std::vector<std::vector<std::size_t>> * htd::DinitzMaxFlowAlgorithm::Implementation::improveFlow(const htd::IFlowNetworkStructure & flowNetwork, const htd::Flow & flow) const
+bool htd::DinitzMaxFlowAlgorithm::Implementation::computeLevelGraph(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target) const
 {
-    std::size_t vertexCount = flowNetwork.vertexCount();
+    std::vector<std::size_t> & levels = residualNetwork.labels();
+
+    std::vector<htd::vertex_t> & queue = residualNetwork.vertexQueue();
 
-    std::vector<std::vector<std::size_t>> * ret = new std::vector<std::vector<std::size_t>>(vertexCount, std::vector<std::size_t>(vertexCount));
+    std::fill(levels.begin(), levels.end(), (std::size_t)-1);
 
-    std::vector<std::vector<std::size_t>> & capacities = *ret;
+    levels[source] = 0;
 
-    for (htd::index_t i = 0; i < vertexCount; i++)
+    queue[0] = source;
+
+    std::size_t queueSize = 1;
+
+    /* The vertices at a larger distance than the target vertex cannot be part of a shortest augmenting path. */
+    for (htd::index_t queueIndex = 0; queueIndex < queueSize && levels[queue[queueIndex]] < levels[target]; ++queueIndex)
     {
-        for (htd::index_t j = 0; j < vertexCount; j++)
+        htd::vertex_t vertex = queue[queueIndex];
+
+        for (htd::index_t arc = residualNetwork.firstArc(vertex); arc < residualNetwork.endArc(vertex); ++arc)
         {
-            capacities[i][j] = flowNetwork.capacity(i, j) - static_cast<std::size_t>(flow.flow_[i][j]);
-        }
-    }
+            htd::vertex_t next = residualNetwork.arcTarget(arc);
 
-    std::vector<std::size_t> * distances = computeMinimumDistances(flowNetwork, capacities, flow.target_);
+            if (levels[next] == (std::size_t)-1 && residualNetwork.residualCapacity(arc) > 0)
+            {
+                levels[next] = levels[vertex] + 1;
 
-    if ((*distances)[flow.source_] == (std::size_t)-1)
-    {
-        delete ret;
+                queue[queueSize] = next;
 
-        ret = nullptr;
-    }
-    else
-    {
-        performImprovementStep(flowNetwork, capacities, *distances, flow.source_, flow.target_);
+                ++queueSize;
+            }
+        }
     }
 
-    delete distances;
-
-    return ret;
+    return levels[target] != (std::size_t)-1;
 }
 
-void htd::DinitzMaxFlowAlgorithm::Implementation::performImprovementStep(const htd::IFlowNetworkStructure & flowNetwork, std::vector<std::vector<std::size_t>> & capacities, const std::vector<std::size_t> & distances, htd::vertex_t source, htd::vertex_t target) const
+std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::computeBlockingFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const
 {
-    std::deque<htd::vertex_t> originDeque;
+    std::size_t ret = 0;
 
-    std::unordered_set<htd::vertex_t> visitedVertices;
+    std::vector<std::size_t> & levels = residualNetwork.labels();
 
-    htd::vertex_t currentVertex = source;
+    std::vector<htd::index_t> & currentArcs = residualNetwork.currentArcs();
 
-    originDeque.emplace_back(currentVertex);
+    std::vector<htd::index_t> & path = residualNetwork.arcPath();
 
-    std::vector<htd::vertex_t> predecessors(flowNetwork.vertexCount(), (htd::vertex_t)-1);
-
-    while (!originDeque.empty() && !managementInstance_->isTerminated())
+    for (htd::vertex_t vertex = 0; vertex < residualNetwork.vertexCount(); ++vertex)
     {
-        currentVertex = originDeque.front();
+        currentArcs[vertex] = residualNetwork.firstArc(vertex);
+    }
 
-        if (visitedVertices.count(currentVertex) == 0)
-        {
-            visitedVertices.insert(currentVertex);
+    path.clear();
 
-            if (currentVertex == target)
-            {
-                std::size_t delta = computeMinimumCapacity(predecessors, capacities, target);
+    htd::vertex_t vertex = source;
+
+    bool blocked = false;
 
-                htd::vertex_t current = currentVertex;
+    while (!blocked && ret < flowLimit)
+    {
+        if (vertex == target)
+        {
+            std::size_t delta = flowLimit - ret;
 
-                htd::vertex_t predecessor = predecessors[currentVertex];
+            for (htd::index_t arc : path)
+            {
+                delta = std::min(delta, residualNetwork.residualCapacity(arc));
+            }
 
-                while (predecessor != (htd::vertex_t)-1)
-                {
-                    capacities[predecessor][current] = capacities[predecessor][current] - delta;
-                    capacities[current][predecessor] = capacities[current][predecessor] + delta;
+            htd::index_t saturatedArcIndex = path.size();
 
-                    if (capacities[predecessor][current] == 0)
-                    {
-                        currentVertex = predecessor;
-                    }
+            for (htd::index_t index = path.size(); index > 0; --index)
+            {
+                htd::index_t arc = path[index - 1];
 
-                    current = predecessor;
+                residualNetwork.push(arc, delta);
 
-                    predecessor = predecessors[predecessor];
+                if (residualNetwork.residualCapacity(arc) == 0)
+                {
+                    saturatedArcIndex = index - 1;
                 }
             }
 
-            originDeque.pop_front();
+            ret += delta;
 
-            for (htd::vertex_t otherVertex = 0; otherVertex < flowNetwork.vertexCount(); ++otherVertex)
-            {
-                if (visitedVertices.count(otherVertex) == 0 && flowNetwork.capacity(currentVertex, otherVertex) > 0 && capacities[currentVertex][otherVertex] > 0 && distances[currentVertex] == distances[otherVertex] + 1)
-                {
-                    predecessors[otherVertex] = currentVertex;
+            /* Continue the search at the tail of the first saturated arc of the path. */
+            path.resize(saturatedArcIndex);
 
-                    originDeque.emplace_back(otherVertex);
-                }
-            }
+            vertex = path.empty() ? source : residualNetwork.arcTarget(path.back());
         }
         else
         {
-            originDeque.pop_front();
-        }
-    }
-}
+            htd::index_t & currentArc = currentArcs[vertex];
 
-std::vector<std::size_t> * htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumDistances(const htd::IFlowNetworkStructure & flowNetwork, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t vertexCount = flowNetwork.vertexCount();
+            htd::index_t endArc = residualNetwork.endArc(vertex);
 
-    std::vector<std::size_t> * ret = new std::vector<std::size_t>(vertexCount, (std::size_t)-1);
-
-    std::vector<std::size_t> & distances = *ret;
-
-    distances[target]=0;
-
-    std::stack<htd::vertex_t> stack;
-
-    stack.push(target);
-
-    while(!stack.empty())
-    {
-        htd::vertex_t vertex = stack.top();
-
-        stack.pop();
-
-        for (htd::index_t index = 0; index < vertexCount; ++index)
-        {
-            if (flowNetwork.capacity(index, vertex) > 0 && capacities[index][vertex] > 0)
+            while (currentArc < endArc && (residualNetwork.residualCapacity(currentArc) == 0 || levels[residualNetwork.arcTarget(currentArc)] != levels[vertex] + 1))
             {
-                std::size_t distance = distances[vertex] + 1;
-
-                if (distance < distances[index])
-                {
-                    distances[index] = distance;
-
-                    stack.push(index);
-                }
+                ++currentArc;
             }
-        }
-    }
 
-    return ret;
-}
-
-std::size_t htd::DinitzMaxFlowAlgorithm::Implementation::computeMinimumCapacity(const std::vector<htd::vertex_t> & path, const std::vector<std::vector<std::size_t>> & capacities, htd::vertex_t target) const
-{
-    std::size_t ret = (std::size_t)-1;
+            if (currentArc < endArc)
+            {
+                path.push_back(currentArc);
 
-    htd::vertex_t current = target;
+                vertex = residualNetwork.arcTarget(currentArc);
+            }
+            else if (vertex == source)
+            {
+                blocked = true;
+            }
+            else
+            {
+                /* The vertex is a dead end, hence it is removed from the level graph. */
+                levels[vertex] = (std::size_t)-1;
 
-    htd::vertex_t predecessor = path[current];
+                path.pop_back();
 
-    while (predecessor != (htd::vertex_t)-1)
-    {
-        std::size_t capacity = capacities[predecessor][current];
+                vertex = path.empty() ? source : residualNetwork.arcTarget(path.back());
 
-        if (ret > capacity)
-        {
-            ret = capacity;
+                ++currentArcs[vertex];
+            }
         }
-
-        current = predecessor;
-
-        predecessor = path[predecessor];
     }
 
     return ret;
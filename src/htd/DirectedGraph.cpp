@@ -183,6 +183,13 @@ void htd::DirectedGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::
     base_->copyNeighborsTo(vertex, target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::DirectedGraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return base_->neighborSpan(vertex, buffer);
+}
+
 htd::vertex_t htd::DirectedGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return base_->neighborAtPosition(vertex, index);
@@ -218,6 +225,11 @@ void htd::DirectedGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) con
     base_->copyVerticesTo(target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::DirectedGraph::vertexSpan(void) const
+{
+    return base_->vertexSpan();
+}
+
 htd::vertex_t htd::DirectedGraph::vertexAtPosition(htd::index_t index) const
 {
     return base_->vertexAtPosition(index);
@@ -282,6 +282,13 @@ void htd::DirectedMultiGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<
     implementation_->base_->copyNeighborsTo(vertex, target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::DirectedMultiGraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->base_->neighborSpan(vertex, buffer);
+}
+
 htd::vertex_t htd::DirectedMultiGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return implementation_->base_->neighborAtPosition(vertex, index);
@@ -357,6 +364,11 @@ void htd::DirectedMultiGraph::copyVerticesTo(std::vector<htd::vertex_t> & target
     implementation_->base_->copyVerticesTo(target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::DirectedMultiGraph::vertexSpan(void) const
+{
+    return implementation_->base_->vertexSpan();
+}
+
 htd::vertex_t htd::DirectedMultiGraph::vertexAtPosition(htd::index_t index) const
 {
     return implementation_->base_->vertexAtPosition(index);
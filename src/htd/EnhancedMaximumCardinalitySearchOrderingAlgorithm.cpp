@@ -31,10 +31,10 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
+#include <htd/BucketQueue.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm.
@@ -46,7 +46,7 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), lexicographicSearchEnabled_(false)
     {
 
     }
@@ -62,95 +62,34 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Fill the pool of vertices having maximum weight.
-     *
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[out] pool    The vertex pool which shall be filled with all vertices of maximum weight.
+     *  A boolean flag indicating whether the lexicographic labels of LEX M shall be used instead of the weights of MCS-M.
      */
-    void fillMaxCardinalityPool(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::size_t> & weights, std::vector<htd::vertex_t> & pool) const HTD_NOEXCEPT
-    {
-        std::size_t max = 0;
-
-        pool.clear();
-
-        for (htd::vertex_t vertex : vertices)
-        {
-            std::size_t tmp = weights[vertex];
-
-            if (tmp >= max)
-            {
-                if (tmp > max)
-                {
-                    max = tmp;
-
-                    pool.clear();
-                }
+    bool lexicographicSearchEnabled_;
 
-                pool.push_back(vertex);
-            }
-        }
-    }
+    /**
+     *  Perform the search (MCS-M or LEX M) on a graph given in compressed sparse row format.
+     *
+     *  @param[in] offsets      The offsets of the neighborhoods within the vector of neighbors. The vector contains one entry more than there are vertices.
+     *  @param[in] neighbors    The neighborhoods of all vertices, each vertex given by its index.
+     *  @param[out] sequence    The vector to which the vertices shall be appended in the order in which they are numbered, i.e., in reverse elimination order.
+     *  @param[out] fillEdges   The vector to which the fill edges of the minimal triangulation shall be appended or nullptr if the fill edges are not required.
+     */
+    void search(const std::vector<htd::index_t> & offsets, const std::vector<htd::index_t> & neighbors, std::vector<htd::index_t> & sequence, std::vector<std::pair<htd::index_t, htd::index_t>> * fillEdges) const;
 
     /**
-     *  Check whether there exists a path between two vertices consisting of only
-     *  unnumbered vertices in the graph whose weight is strictly less than the
-     *  weight of the source vertex.
+     *  Replace the labels of the unnumbered vertices by their ranks after the given vertices were updated.
      *
-     *  @param[in] graph    The graph.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] source   The source vertex.
-     *  @param[in] target   The target vertex.
+     *  The label of an updated vertex is extended by the number of the current step which is smaller than all numbers
+     *  already contained in the labels. Hence, the order of two labels only changes if they were equal before, i.e.,
+     *  the new rank of a vertex is determined by its old rank and whether it was updated.
      *
-     *  @return True if a valid path between the two vertices exists, false otherwise.
+     *  @param[in] unnumberedVertices   The unnumbered vertices.
+     *  @param[in] updatedVertices      The unnumbered vertices whose labels were extended.
+     *  @param[in,out] ranks            The ranks of the labels of the vertices.
+     *  @param[in,out] rankBuffer       A buffer with at least twice as many entries as there are distinct ranks, all of them set to zero.
+     *  @param[in,out] queue            The bucket queue of the unnumbered vertices which shall be updated with the new ranks.
      */
-    bool hasValidPath(const htd::IPreprocessedGraph & graph, const std::vector<std::size_t> & weights, const std::unordered_set<htd::vertex_t> & vertices, htd::vertex_t source, htd::vertex_t target)
-    {
-        bool ret = false;
-
-        std::size_t currentWeight = weights[source];
-
-        std::deque<htd::vertex_t> originDeque;
-
-        std::unordered_set<htd::vertex_t> visitedVertices;
-
-        htd::vertex_t currentVertex = source;
-
-        originDeque.push_back(currentVertex);
-
-        while (!ret && !originDeque.empty() && !managementInstance_->isTerminated())
-        {
-            currentVertex = originDeque.front();
-
-            visitedVertices.insert(currentVertex);
-
-            ret = currentVertex == target;
-
-            if (!ret)
-            {
-                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
-
-                auto it = neighborCollection.begin();
-
-                for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
-                {
-                    htd::vertex_t neighbor = *it;
-
-                    if (visitedVertices.count(neighbor) == 0 && ((vertices.count(neighbor) == 1 && weights[neighbor] < currentWeight) || neighbor == target))
-                    {
-                        originDeque.push_back(neighbor);
-                    }
-
-                    ++it;
-                }
-            }
-
-            originDeque.pop_front();
-        }
-
-        return ret;
-    }
+    void updateRanks(const std::vector<htd::index_t> & unnumberedVertices, const std::vector<htd::index_t> & updatedVertices, std::vector<std::size_t> & ranks, std::vector<std::size_t> & rankBuffer, htd::BucketQueue<htd::index_t, std::less<std::size_t>> & queue) const;
 };
 
 htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::EnhancedMaximumCardinalitySearchOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -181,17 +120,43 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
 {
     HTD_UNUSED(graph)
 
-    std::size_t size = preprocessedGraph.remainingVertices().size();
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    std::size_t size = remainingVertices.size();
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    std::vector<htd::index_t> indices(preprocessedGraph.inputGraphVertexCount(), (htd::index_t)-1);
 
-    std::vector<htd::vertex_t> pool;
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        indices[remainingVertices[index]] = index;
+    }
+
+    std::vector<htd::index_t> offsets(1, 0);
 
-    std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
+    std::vector<htd::index_t> neighbors;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    offsets.reserve(size + 1);
+
+    std::vector<htd::vertex_t> neighborBuffer;
+
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborSpan(vertex, neighborBuffer))
+        {
+            htd::index_t index = indices[neighbor];
+
+            if (index != (htd::index_t)-1 && neighbor != vertex)
+            {
+                neighbors.push_back(index);
+            }
+        }
+
+        offsets.push_back(neighbors.size());
+    }
+
+    std::vector<htd::index_t> sequence;
+
+    implementation_->search(offsets, neighbors, sequence, nullptr);
 
     std::vector<htd::vertex_t> ordering;
     ordering.reserve(preprocessedGraph.vertexCount());
@@ -200,32 +165,78 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
                     preprocessedGraph.eliminationSequence().begin(),
                     preprocessedGraph.eliminationSequence().end());
 
-    while (size > 0 && !managementInstance.isTerminated())
+    for (auto it = sequence.rbegin(); it != sequence.rend(); ++it)
     {
-        implementation_->fillMaxCardinalityPool(vertices, weights, pool);
+        ordering.push_back(preprocessedGraph.vertexName(remainingVertices[*it]));
+    }
 
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+    return new htd::VertexOrdering(std::move(ordering), 1);
+}
+
+void htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::computeMinimalTriangulation(const htd::IGraphStructure & graph, std::vector<htd::vertex_t> & ordering, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges) const
+{
+    const htd::ConstSpan<htd::vertex_t> vertices = graph.vertexSpan();
 
-        vertices.erase(selectedVertex);
+    std::size_t size = vertices.size();
+
+    /* The vertices are numbered consecutively in most cases, so the index of a vertex can be computed directly. */
+    bool consecutive = size == 0 || vertices[size - 1] - vertices[0] + 1 == size;
+
+    auto index = [&](htd::vertex_t vertex)
+    {
+        return consecutive ? static_cast<htd::index_t>(vertex - vertices[0]) : static_cast<htd::index_t>(std::distance(vertices.begin(), std::lower_bound(vertices.begin(), vertices.end(), vertex)));
+    };
 
-        for (htd::vertex_t vertex : vertices)
+    std::vector<htd::index_t> offsets(1, 0);
+
+    std::vector<htd::index_t> neighbors;
+
+    offsets.reserve(size + 1);
+
+    std::vector<htd::vertex_t> neighborBuffer;
+
+    for (htd::vertex_t vertex : vertices)
+    {
+        for (htd::vertex_t neighbor : graph.neighborSpan(vertex, neighborBuffer))
         {
-            if (implementation_->hasValidPath(preprocessedGraph, weights, vertices, vertex, selectedVertex))
+            if (neighbor != vertex)
             {
-                weights[vertex]++;
+                neighbors.push_back(index(neighbor));
             }
         }
 
-        pool.clear();
+        offsets.push_back(neighbors.size());
+    }
+
+    std::vector<htd::index_t> sequence;
+
+    std::vector<std::pair<htd::index_t, htd::index_t>> localFillEdges;
 
-        --size;
+    implementation_->search(offsets, neighbors, sequence, &localFillEdges);
 
-        ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
+    ordering.reserve(ordering.size() + sequence.size());
+
+    for (auto it = sequence.rbegin(); it != sequence.rend(); ++it)
+    {
+        ordering.push_back(vertices[*it]);
     }
 
-    std::reverse(ordering.begin() + preprocessedGraph.eliminationSequence().size(), ordering.end());
+    fillEdges.reserve(fillEdges.size() + localFillEdges.size());
 
-    return new htd::VertexOrdering(std::move(ordering), 1);
+    for (const std::pair<htd::index_t, htd::index_t> & fillEdge : localFillEdges)
+    {
+        fillEdges.emplace_back(vertices[fillEdge.first], vertices[fillEdge.second]);
+    }
+}
+
+bool htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::isLexicographicSearchEnabled(void) const
+{
+    return implementation_->lexicographicSearchEnabled_;
+}
+
+void htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::setLexicographicSearchEnabled(bool lexicographicSearchEnabled)
+{
+    implementation_->lexicographicSearchEnabled_ = lexicographicSearchEnabled;
 }
 
 const htd::LibraryInstance * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
@@ -242,14 +253,205 @@ void htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::setManagementInstan
 
 htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::clone(void) const
 {
-    return new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(managementInstance());
+    htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm * ret = new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(managementInstance());
+
+    ret->setLexicographicSearchEnabled(isLexicographicSearchEnabled());
+
+    return ret;
 }
 
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 htd::IOrderingAlgorithm * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::cloneOrderingAlgorithm(void) const
 {
-    return new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 #endif
 
+void htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation::search(const std::vector<htd::index_t> & offsets, const std::vector<htd::index_t> & neighbors, std::vector<htd::index_t> & sequence, std::vector<std::pair<htd::index_t, htd::index_t>> * fillEdges) const
+{
+    std::size_t size = offsets.size() - 1;
+
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    /* For MCS-M, the priority of a vertex is its weight. For LEX M, it is the rank of its label among the labels of all unnumbered vertices. */
+    std::vector<std::size_t> priorities(size, 0);
+
+    htd::BucketQueue<htd::index_t, std::less<std::size_t>> queue(size, size);
+
+    std::vector<htd::index_t> unnumberedVertices;
+
+    std::vector<htd::index_t> positions(size);
+
+    for (htd::index_t vertex = 0; vertex < size; ++vertex)
+    {
+        queue.push(vertex, 0);
+
+        unnumberedVertices.push_back(vertex);
+
+        positions[vertex] = vertex;
+    }
+
+    std::vector<bool> numbered(size, false);
+
+    /* The step in which a vertex was reached most recently by the search. */
+    std::vector<std::size_t> reached(size, 0);
+
+    /* The vertices reached by the search, bucketed by the maximum priority of the inner vertices of the path via which they were reached. */
+    std::vector<std::vector<htd::index_t>> reachBuckets(size + 1);
+
+    std::vector<htd::index_t> updatedVertices;
+
+    std::vector<std::size_t> rankBuffer(lexicographicSearchEnabled_ ? 2 * size : 0, 0);
+
+    sequence.reserve(sequence.size() + size);
+
+    for (std::size_t step = 1; step <= size && !managementInstance.isTerminated(); ++step)
+    {
+        htd::index_t selectedVertex = htd::selectRandomElement<htd::index_t>(queue.topCollection());
+
+        queue.eraseFromTopCollection(selectedVertex);
+
+        numbered[selectedVertex] = true;
+
+        reached[selectedVertex] = step;
+
+        htd::index_t lastVertex = unnumberedVertices.back();
+
+        unnumberedVertices[positions[selectedVertex]] = lastVertex;
+
+        positions[lastVertex] = positions[selectedVertex];
+
+        unnumberedVertices.pop_back();
+
+        sequence.push_back(selectedVertex);
+
+        updatedVertices.clear();
+
+        /* Vertices reached via a path whose inner vertices all have a priority of at least the maximum priority cannot be updated. */
+        std::size_t limit = queue.empty() ? 0 : queue.topPriority();
+
+        for (htd::index_t position = offsets[selectedVertex]; position < offsets[selectedVertex + 1]; ++position)
+        {
+            htd::index_t neighbor = neighbors[position];
+
+            if (!numbered[neighbor] && reached[neighbor] != step)
+            {
+                reached[neighbor] = step;
+
+                reachBuckets[priorities[neighbor]].push_back(neighbor);
+
+                updatedVertices.push_back(neighbor);
+            }
+        }
+
+        for (std::size_t level = 0; level < limit; ++level)
+        {
+            std::vector<htd::index_t> & reachBucket = reachBuckets[level];
+
+            while (!reachBucket.empty())
+            {
+                htd::index_t vertex = reachBucket.back();
+
+                reachBucket.pop_back();
+
+                for (htd::index_t position = offsets[vertex]; position < offsets[vertex + 1]; ++position)
+                {
+                    htd::index_t neighbor = neighbors[position];
+
+                    if (!numbered[neighbor] && reached[neighbor] != step)
+                    {
+                        reached[neighbor] = step;
+
+                        std::size_t priority = priorities[neighbor];
+
+                        if (priority > level)
+                        {
+                            reachBuckets[priority].push_back(neighbor);
+
+                            updatedVertices.push_back(neighbor);
+
+                            if (fillEdges != nullptr)
+                            {
+                                fillEdges->emplace_back(std::min(selectedVertex, neighbor), std::max(selectedVertex, neighbor));
+                            }
+                        }
+                        else
+                        {
+                            reachBucket.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+        }
+
+        /* Only the bucket of the maximum priority may still contain vertices which were not expanded. */
+        if (limit < reachBuckets.size())
+        {
+            reachBuckets[limit].clear();
+        }
+
+        if (lexicographicSearchEnabled_)
+        {
+            updateRanks(unnumberedVertices, updatedVertices, priorities, rankBuffer, queue);
+        }
+        else
+        {
+            for (htd::index_t vertex : updatedVertices)
+            {
+                std::size_t & priority = priorities[vertex];
+
+                ++priority;
+
+                queue.updatePriority(vertex, priority);
+            }
+        }
+    }
+}
+
+void htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation::updateRanks(const std::vector<htd::index_t> & unnumberedVertices, const std::vector<htd::index_t> & updatedVertices, std::vector<std::size_t> & ranks, std::vector<std::size_t> & rankBuffer, htd::BucketQueue<htd::index_t, std::less<std::size_t>> & queue) const
+{
+    if (!updatedVertices.empty())
+    {
+        std::size_t keyCount = 0;
+
+        for (htd::index_t vertex : unnumberedVertices)
+        {
+            ranks[vertex] *= 2;
+
+            keyCount = std::max(keyCount, ranks[vertex] + 2);
+        }
+
+        for (htd::index_t vertex : updatedVertices)
+        {
+            ++ranks[vertex];
+        }
+
+        for (htd::index_t vertex : unnumberedVertices)
+        {
+            rankBuffer[ranks[vertex]] = 1;
+        }
+
+        std::size_t rank = 0;
+
+        for (htd::index_t key = 0; key < keyCount; ++key)
+        {
+            if (rankBuffer[key] != 0)
+            {
+                ++rank;
+
+                rankBuffer[key] = rank;
+            }
+        }
+
+        for (htd::index_t vertex : unnumberedVertices)
+        {
+            ranks[vertex] = rankBuffer[ranks[vertex]] - 1;
+
+            queue.updatePriority(vertex, ranks[vertex]);
+        }
+
+        std::fill(rankBuffer.begin(), rankBuffer.begin() + keyCount, 0);
+    }
+}
+
 #endif /* HTD_HTD_ENHANCEDMAXIMUMCARDINALITYSEARCHORDERINGALGORITHM_CPP */
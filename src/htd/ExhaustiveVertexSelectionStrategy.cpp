@@ -43,7 +43,7 @@ htd::ExhaustiveVertexSelectionStrategy::~ExhaustiveVertexSelectionStrategy()
 
 void htd::ExhaustiveVertexSelectionStrategy::selectVertices(const htd::IMultiHypergraph & graph, std::vector<htd::vertex_t> & target) const
 {
-    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
     target.insert(target.end(), vertexCollection.begin(), vertexCollection.end());
 }
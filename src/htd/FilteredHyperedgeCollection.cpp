@@ -34,7 +34,43 @@
 #include <algorithm>
 #include <stdexcept>
 
-htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(void) HTD_NOEXCEPT : baseCollection_(new htd::HyperedgeVector(std::make_shared<std::vector<htd::Hyperedge>>())), relevantIndices_(std::make_shared<std::vector<htd::index_t>>())
+/**
+ *  Access the empty hyperedge collection which is shared by all empty instances of htd::FilteredHyperedgeCollection.
+ *
+ *  @return The shared empty hyperedge collection.
+ */
+static const std::shared_ptr<htd::IHyperedgeCollection> & emptyHyperedgeCollection(void)
+{
+    static const std::shared_ptr<htd::IHyperedgeCollection> ret(new htd::HyperedgeVector(std::make_shared<std::vector<htd::Hyperedge>>()));
+
+    return ret;
+}
+
+/**
+ *  Access the empty index vector which is shared by all empty instances of htd::FilteredHyperedgeCollection.
+ *
+ *  @return The shared empty index vector.
+ */
+static const std::shared_ptr<std::vector<htd::index_t>> & emptyIndexVector(void)
+{
+    static const std::shared_ptr<std::vector<htd::index_t>> ret(std::make_shared<std::vector<htd::index_t>>());
+
+    return ret;
+}
+
+/**
+ *  Create a copy of an index vector. Empty index vectors are not copied but shared.
+ *
+ *  @param[in] indices  The index vector which shall be copied.
+ *
+ *  @return A copy of the index vector.
+ */
+static std::shared_ptr<std::vector<htd::index_t>> copyIndexVector(const std::vector<htd::index_t> & indices)
+{
+    return indices.empty() ? emptyIndexVector() : std::make_shared<std::vector<htd::index_t>>(indices);
+}
+
+htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(void) HTD_NOEXCEPT : baseCollection_(emptyHyperedgeCollection()), relevantIndices_(emptyIndexVector())
 {
 
 }
@@ -59,7 +95,7 @@ htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(std::shared_ptr<ht
 
 }
 
-htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(const htd::FilteredHyperedgeCollection & original) HTD_NOEXCEPT : baseCollection_(original.baseCollection_), relevantIndices_(std::make_shared<std::vector<htd::index_t>>(*(original.relevantIndices_)))
+htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(const htd::FilteredHyperedgeCollection & original) HTD_NOEXCEPT : baseCollection_(original.baseCollection_), relevantIndices_(copyIndexVector(*(original.relevantIndices_)))
 {
 
 }
@@ -85,7 +121,7 @@ htd::FilteredHyperedgeCollection & htd::FilteredHyperedgeCollection::operator=(c
     {
         baseCollection_ = original.baseCollection_;
 
-        *relevantIndices_ = *(original.relevantIndices_);
+        relevantIndices_ = copyIndexVector(*(original.relevantIndices_));
     }
 
     return *this;
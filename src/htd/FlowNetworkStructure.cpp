@@ -22,8 +22,8 @@
  * along with htd.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef HTD_HTD_MULTIGRAPH_CPP
-#define HTD_HTD_MULTIGRAPH_CPP
+#ifndef HTD_HTD_FLOWNETWORKSTRUCTURE_CPP
+#define HTD_HTD_FLOWNETWORKSTRUCTURE_CPP
 
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
@@ -32,10 +32,9 @@
 #include <htd/VectorAdapter.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 #include <utility>
-#include <stack>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::FlowNetworkStructure.
@@ -47,7 +46,7 @@ struct htd::FlowNetworkStructure::Implementation
      *
      *  @param[in] vertexCount  The number of vertices of the flow network structure.
      */
-    Implementation(std::size_t vertexCount) : vertices_(vertexCount), neighborhood_(vertexCount), capacities_(vertexCount, std::vector<std::size_t>(vertexCount))
+    Implementation(std::size_t vertexCount) : vertices_(vertexCount), neighborhood_(vertexCount), capacities_(vertexCount)
     {
         std::iota(vertices_.begin(), vertices_.end(), 0);
     }
@@ -78,9 +77,51 @@ struct htd::FlowNetworkStructure::Implementation
     std::vector<std::vector<htd::vertex_t>> neighborhood_;
 
     /**
-     *  The residual capacities of the flow network.
+     *  The capacities of the outgoing arcs of each of the vertices, stored in the same order as the directed neighborhood.
      */
     std::vector<std::vector<std::size_t>> capacities_;
+
+    /**
+     *  Mark all vertices which are reachable from the given vertex via directed edges.
+     *
+     *  @param[in] vertex   The vertex from which the search starts.
+     *  @param[out] visited The flag for each vertex which indicates whether the vertex is reachable.
+     *
+     *  @return The number of reachable vertices, including the given vertex.
+     */
+    std::size_t markReachableVertices(htd::vertex_t vertex, std::vector<char> & visited) const
+    {
+        std::size_t ret = 1;
+
+        visited.assign(neighborhood_.size(), 0);
+
+        std::vector<htd::vertex_t> originStack;
+
+        visited[vertex] = 1;
+
+        originStack.push_back(vertex);
+
+        while (!originStack.empty())
+        {
+            htd::vertex_t currentVertex = originStack.back();
+
+            originStack.pop_back();
+
+            for (htd::vertex_t neighbor : neighborhood_[currentVertex])
+            {
+                if (visited[neighbor] == 0)
+                {
+                    visited[neighbor] = 1;
+
+                    originStack.push_back(neighbor);
+
+                    ++ret;
+                }
+            }
+        }
+
+        return ret;
+    }
 };
 
 htd::FlowNetworkStructure::FlowNetworkStructure(std::size_t vertexCount) : implementation_(new Implementation(vertexCount))
@@ -142,43 +183,9 @@ bool htd::FlowNetworkStructure::isConnected(void) const
 
     if (!(implementation_->neighborhood_.empty()))
     {
-        std::stack<htd::vertex_t> originStack;
-
-        std::unordered_set<htd::vertex_t> visitedVertices;
-
-        htd::vertex_t currentVertex = 0;
+        std::vector<char> visitedVertices;
 
-        originStack.push(currentVertex);
-
-        while (!originStack.empty())
-        {
-            currentVertex = originStack.top();
-
-            if (visitedVertices.count(currentVertex) == 0)
-            {
-                visitedVertices.insert(currentVertex);
-
-                originStack.pop();
-
-                for (htd::vertex_t neighbor : implementation_->neighborhood_[currentVertex])
-                {
-                    if (visitedVertices.count(neighbor) == 0)
-                    {
-                        originStack.push(neighbor);
-                    }
-                }
-            }
-            else
-            {
-                originStack.pop();
-            }
-        }
-
-        ret = visitedVertices.size() == implementation_->neighborhood_.size();
-    }
-    else
-    {
-        ret = true;
+        ret = implementation_->markReachableVertices(0, visitedVertices) == implementation_->neighborhood_.size();
     }
 
     return ret;
@@ -188,47 +195,15 @@ bool htd::FlowNetworkStructure::isConnected(htd::vertex_t vertex1, htd::vertex_t
 {
     HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
 
-    bool ret = false;
+    bool ret = true;
 
-    if (vertex1 == vertex2)
-    {
-        ret = true;
-    }
-    else
+    if (vertex1 != vertex2)
     {
-        std::stack<htd::vertex_t> originStack;
-
-        std::unordered_set<htd::vertex_t> visitedVertices;
+        std::vector<char> visitedVertices;
 
-        htd::vertex_t currentVertex = vertex1;
+        implementation_->markReachableVertices(vertex1, visitedVertices);
 
-        originStack.push(currentVertex);
-
-        while (!originStack.empty() && visitedVertices.count(vertex2) == 0)
-        {
-            currentVertex = originStack.top();
-
-            if (visitedVertices.count(currentVertex) == 0)
-            {
-                visitedVertices.insert(currentVertex);
-
-                originStack.pop();
-
-                for (htd::vertex_t neighbor : implementation_->neighborhood_[currentVertex])
-                {
-                    if (visitedVertices.count(neighbor) == 0)
-                    {
-                        originStack.push(neighbor);
-                    }
-                }
-            }
-            else
-            {
-                originStack.pop();
-            }
-        }
-
-        ret = visitedVertices.count(vertex2) == 1;
+        ret = visitedVertices[vertex2] != 0;
     }
 
     return ret;
@@ -257,6 +232,15 @@ void htd::FlowNetworkStructure::copyNeighborsTo(htd::vertex_t vertex, std::vecto
     target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::FlowNetworkStructure::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    HTD_UNUSED(buffer)
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighborhood_[vertex]);
+}
+
 htd::vertex_t htd::FlowNetworkStructure::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -278,6 +262,11 @@ void htd::FlowNetworkStructure::copyVerticesTo(std::vector<htd::vertex_t> & targ
     target.insert(target.end(), implementation_->vertices_.begin(), implementation_->vertices_.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::FlowNetworkStructure::vertexSpan(void) const
+{
+    return htd::ConstSpan<htd::vertex_t>(implementation_->vertices_);
+}
+
 htd::vertex_t htd::FlowNetworkStructure::vertexAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->vertices_.size())
@@ -296,21 +285,21 @@ htd::ConstCollection<htd::vertex_t> htd::FlowNetworkStructure::isolatedVertices(
 
     auto & result = ret.container();
 
-    for (htd::vertex_t vertex : implementation_->vertices_)
+    std::vector<char> incidentVertices(implementation_->neighborhood_.size(), 0);
+
+    for (const std::vector<htd::vertex_t> & currentNeighborhood : implementation_->neighborhood_)
     {
-        if (implementation_->neighborhood_[vertex].empty())
+        for (htd::vertex_t neighbor : currentNeighborhood)
         {
-            bool isolated = true;
-
-            for (auto it = implementation_->neighborhood_.begin(); isolated && it != implementation_->neighborhood_.end(); ++it)
-            {
-                isolated = !(std::binary_search(it->begin(), it->end(), vertex));
-            }
+            incidentVertices[neighbor] = 1;
+        }
+    }
 
-            if (isolated)
-            {
-                result.push_back(vertex);
-            }
+    for (htd::vertex_t vertex : implementation_->vertices_)
+    {
+        if (implementation_->neighborhood_[vertex].empty() && incidentVertices[vertex] == 0)
+        {
+            result.push_back(vertex);
         }
     }
 
@@ -353,7 +342,18 @@ std::size_t htd::FlowNetworkStructure::capacity(htd::vertex_t source, htd::verte
 {
     HTD_ASSERT(isVertex(source) && isVertex(target))
 
-    return implementation_->capacities_[source][target];
+    std::size_t ret = 0;
+
+    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[source];
+
+    auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), target);
+
+    if (position != currentNeighborhood.end() && *position == target)
+    {
+        ret = implementation_->capacities_[source][(std::size_t)std::distance(currentNeighborhood.begin(), position)];
+    }
+
+    return ret;
 }
 
 void htd::FlowNetworkStructure::updateCapacity(htd::vertex_t source, htd::vertex_t target, std::size_t capacity)
@@ -362,14 +362,22 @@ void htd::FlowNetworkStructure::updateCapacity(htd::vertex_t source, htd::vertex
 
     std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[source];
 
+    std::vector<std::size_t> & currentCapacities = implementation_->capacities_[source];
+
     auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), target);
 
+    std::size_t index = (std::size_t)std::distance(currentNeighborhood.begin(), position);
+
     if (position == currentNeighborhood.end() || *position != target)
     {
         currentNeighborhood.insert(position, target);
-    }
 
-    implementation_->capacities_[source][target] = capacity;
+        currentCapacities.insert(currentCapacities.begin() + index, capacity);
+    }
+    else
+    {
+        currentCapacities[index] = capacity;
+    }
 }
 
 htd::FlowNetworkStructure * htd::FlowNetworkStructure::clone(void) const
@@ -389,4 +397,4 @@ htd::IFlowNetworkStructure * htd::FlowNetworkStructure::cloneFlowNetworkStructur
 }
 #endif
 
-#endif /* HTD_HTD_MULTIGRAPH_CPP */
+#endif /* HTD_HTD_FLOWNETWORKSTRUCTURE_CPP */
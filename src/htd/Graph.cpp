@@ -163,6 +163,13 @@ void htd::Graph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t
     base_->copyNeighborsTo(vertex, target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Graph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return base_->neighborSpan(vertex, buffer);
+}
+
 htd::vertex_t htd::Graph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return base_->neighborAtPosition(vertex, index);
@@ -178,6 +185,11 @@ void htd::Graph::copyVerticesTo(std::vector<htd::vertex_t> &target) const
     base_->copyVerticesTo(target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Graph::vertexSpan(void) const
+{
+    return base_->vertexSpan();
+}
+
 htd::vertex_t htd::Graph::vertexAtPosition(htd::index_t index) const
 {
     return base_->vertexAtPosition(index);
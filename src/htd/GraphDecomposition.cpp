@@ -33,43 +33,37 @@
 #include <algorithm>
 #include <stdexcept>
 
-htd::GraphDecomposition::GraphDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(manager), bagContent_(), inducedEdges_()
+htd::GraphDecomposition::GraphDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(manager), bagStorage_()
 {
 
 }
 
-htd::GraphDecomposition::GraphDecomposition(const htd::GraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::GraphDecomposition::GraphDecomposition(const htd::GraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagStorage_(original.bagStorage_)
 {
 
 }
 
-htd::GraphDecomposition::GraphDecomposition(const htd::IMultiHypergraph & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(), inducedEdges_()
+htd::GraphDecomposition::GraphDecomposition(const htd::IMultiHypergraph & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
+        bagStorage_.insert(vertex);
     }
 }
 
-htd::GraphDecomposition::GraphDecomposition(const htd::ILabeledMultiHypergraph & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(), inducedEdges_()
+htd::GraphDecomposition::GraphDecomposition(const htd::ILabeledMultiHypergraph & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
+        bagStorage_.insert(vertex);
     }
 }
 
-htd::GraphDecomposition::GraphDecomposition(const htd::IGraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(), inducedEdges_()
+htd::GraphDecomposition::GraphDecomposition(const htd::IGraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
-
-        inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+        bagStorage_.insert(vertex, original.bagContent(vertex), original.inducedHyperedges(vertex));
     }
 }
 
@@ -82,9 +76,7 @@ htd::vertex_t htd::GraphDecomposition::addVertex(void)
 {
     htd::vertex_t ret = htd::LabeledMultiHypergraph::addVertex();
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    bagStorage_.insert(ret);
 
     return ret;
 }
@@ -93,9 +85,7 @@ htd::vertex_t htd::GraphDecomposition::addVertex(const std::vector<htd::vertex_t
 {
     htd::vertex_t ret = htd::LabeledMultiHypergraph::addVertex();
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    bagStorage_.insert(ret, bagContent, inducedEdges);
 
     return ret;
 }
@@ -104,9 +94,7 @@ htd::vertex_t htd::GraphDecomposition::addVertex(std::vector<htd::vertex_t> && b
 {
     htd::vertex_t ret = htd::LabeledMultiHypergraph::addVertex();
 
-    bagContent_.emplace(ret, std::move(bagContent));
-
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
 
     return ret;
 }
@@ -117,9 +105,7 @@ htd::vertex_t htd::GraphDecomposition::addVertices(std::size_t count)
 
     for (htd::index_t index = 0; index < count; ++index)
     {
-        bagContent_.emplace(static_cast<htd::vertex_t>(ret + index), std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(static_cast<htd::vertex_t>(ret + index), htd::FilteredHyperedgeCollection());
+        bagStorage_.insert(static_cast<htd::vertex_t>(ret + index));
     }
 
     return ret;
@@ -129,44 +115,42 @@ void htd::GraphDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::LabeledMultiHypergraph::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
-
-    inducedEdges_.erase(vertex);
+    bagStorage_.erase(vertex);
 }
 
 std::size_t htd::GraphDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagStorage_.bagSize(vertex);
 }
 
 std::vector<htd::vertex_t> & htd::GraphDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagStorage_.bagContent(vertex);
 }
 
 const std::vector<htd::vertex_t> & htd::GraphDecomposition::bagContent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagStorage_.bagContent(vertex);
 }
 
 htd::FilteredHyperedgeCollection & htd::GraphDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return bagStorage_.inducedHyperedges(vertex);
 }
 
 const htd::FilteredHyperedgeCollection & htd::GraphDecomposition::inducedHyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return bagStorage_.inducedHyperedges(vertex);
 }
 
 std::size_t htd::GraphDecomposition::minimumBagSize(void) const
@@ -250,8 +234,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::GraphDec
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
-        bagContent_.clear();
-        inducedEdges_.clear();
+        bagStorage_.clear();
 
         const htd::ConstCollection<htd::vertex_t> & vertices = htd::LabeledMultiHypergraph::vertices();
 
@@ -261,9 +244,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::GraphDec
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = original.bagContent_.at(*it);
-
-            inducedEdges_[*it] = original.inducedEdges_.at(*it);
+            bagStorage_.insert(*it, original.bagStorage_.bagContent(*it), original.bagStorage_.inducedHyperedges(*it));
 
             ++it;
         }
@@ -278,8 +259,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IMultiHy
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
-        bagContent_.clear();
-        inducedEdges_.clear();
+        bagStorage_.clear();
 
         const htd::ConstCollection<htd::vertex_t> & vertices = htd::LabeledMultiHypergraph::vertices();
 
@@ -289,9 +269,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IMultiHy
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = std::vector<htd::vertex_t>();
-
-            inducedEdges_[*it] = htd::FilteredHyperedgeCollection();
+            bagStorage_.insert(*it);
 
             ++it;
         }
@@ -306,8 +284,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::ILabeled
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
-        bagContent_.clear();
-        inducedEdges_.clear();
+        bagStorage_.clear();
 
         const htd::ConstCollection<htd::vertex_t> & vertices = htd::LabeledMultiHypergraph::vertices();
 
@@ -317,9 +294,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::ILabeled
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = std::vector<htd::vertex_t>();
-
-            inducedEdges_[*it] = htd::FilteredHyperedgeCollection();
+            bagStorage_.insert(*it);
 
             ++it;
         }
@@ -334,8 +309,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IGraphDe
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
-        bagContent_.clear();
-        inducedEdges_.clear();
+        bagStorage_.clear();
 
         const htd::ConstCollection<htd::vertex_t> & vertices = htd::LabeledMultiHypergraph::vertices();
 
@@ -345,9 +319,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IGraphDe
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = original.bagContent(*it);
-
-            inducedEdges_[*it] = original.inducedHyperedges(*it);
+            bagStorage_.insert(*it, original.bagContent(*it), original.inducedHyperedges(*it));
 
             ++it;
         }
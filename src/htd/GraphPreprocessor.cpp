@@ -37,11 +37,13 @@
 #include <htd/IConnectedComponentAlgorithm.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
+#include <htd/CancellationScope.hpp>
+#include <htd/ParallelExecution.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <numeric>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace htd
 {
@@ -118,6 +120,11 @@ namespace htd
                 target.insert(target.end(), remainingVertices_.begin(), remainingVertices_.end());
             }
 
+            htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE
+            {
+                return htd::ConstSpan<htd::vertex_t>(remainingVertices_);
+            }
+
             htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(index < remainingVertices_.size())
@@ -205,6 +212,13 @@ namespace htd
                 baseGraph_.copyNeighborsTo(vertex, target);
             }
 
+            htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return baseGraph_.neighborSpan(vertex, buffer);
+            }
+
             htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(isVertex(vertex))
@@ -273,6 +287,12 @@ namespace htd
                 return minTreeWidth_;
             }
 
+            const htd::DenseAdjacencyMatrix * denseAdjacencyMatrix(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                /* The dense adjacency matrix of the base graph covers vertices outside of the component, hence it is not provided here. */
+                return nullptr;
+            }
+
     #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             PreprocessedGraphComponent * clone(void) const HTD_OVERRIDE
             {
@@ -353,8 +373,11 @@ struct htd::GraphPreprocessor::Implementation
                                                                  applyPreprocessing2_(false),
                                                                  applyPreprocessing3_(false),
                                                                  applyPreprocessing4_(false),
+                                                                 applyBiconnectedComponentPreprocessing_(false),
                                                                  iterationCount_(1),
                                                                  nonImprovementLimit_(0),
+                                                                 timeLimit_(0),
+                                                                 threadCount_(1),
                                                                  orderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager))
     {
 
@@ -399,6 +422,14 @@ struct htd::GraphPreprocessor::Implementation
      */
     bool applyPreprocessing4_;
 
+    /**
+     *  A boolean flag indicating whether only the
+     *  largest biconnected component of the remaining
+     *  graph should be retained while the vertices of
+     *  all other components are eliminated.
+     */
+    bool applyBiconnectedComponentPreprocessing_;
+
     /**
      *  The number of iterations of the base ordering algorithm which shall be performed for each component.
      */
@@ -409,6 +440,16 @@ struct htd::GraphPreprocessor::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The wall-clock time limit of the preprocessing (0=unlimited).
+     */
+    std::chrono::milliseconds timeLimit_;
+
+    /**
+     *  The number of threads which shall be used to eliminate the connected components of the remainder of the input graph.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The base ordering algorithm which shall be used to eliminate all but the largest biconnected component.
      */
@@ -495,31 +536,25 @@ struct htd::GraphPreprocessor::Implementation
                 }
                 else
                 {
-                    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+                    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
-                    auto position = vertexCollection.begin();
+                    std::vector<htd::vertex_t> neighborBuffer;
 
                     std::unordered_map<htd::vertex_t, htd::vertex_t> mapping(vertexCollection.size());
 
-                    for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
+                    for (htd::vertex_t vertex : vertexCollection)
                     {
-                        htd::vertex_t vertex = *position;
-
                         htd::vertex_t mappedVertex = registerVertex(vertex, mapping, vertexNames);
 
                         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[mappedVertex];
 
-                        const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
-
-                        auto position2 = neighborCollection.begin();
+                        const htd::ConstSpan<htd::vertex_t> neighborCollection = graph.neighborSpan(vertex, neighborBuffer);
 
                         currentNeighborhood.reserve(neighborCollection.size() + 1);
 
-                        for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
+                        for (htd::vertex_t neighbor : neighborCollection)
                         {
-                            currentNeighborhood.push_back(registerVertex(*position2, mapping, vertexNames));
-
-                            ++position2;
+                            currentNeighborhood.push_back(registerVertex(neighbor, mapping, vertexNames));
                         }
 
                         std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
@@ -530,8 +565,6 @@ struct htd::GraphPreprocessor::Implementation
                         {
                             currentNeighborhood.erase(position3);
                         }
-
-                        ++position;
                     }
                 }
             }
@@ -572,33 +605,292 @@ struct htd::GraphPreprocessor::Implementation
         std::vector<std::vector<htd::vertex_t>> neighborhood;
     };
 
+    /**
+     *  Structure holding the work-lists of the reduction rules.
+     *
+     *  The structure keeps track of the vertices which were not yet eliminated and groups the
+     *  vertices of degree less than four by their degree. Because the vertices are represented
+     *  by their zero-based indices, all information is stored in dense vectors, i.e., looking
+     *  up, moving and erasing a vertex takes constant time and requires no hashing.
+     *
+     *  The data structure may manage only a subset of the vertices, e.g., a connected component.
+     *  In this case, all operations except for the construction touch only the entries of the
+     *  managed vertices, hence a single instance can be reused for many small components.
+     */
+    struct VertexGroups
+    {
+        /**
+         *  The group index of vertices which are not assigned to any group.
+         */
+        static const unsigned char UNASSIGNED = 255;
+
+        /**
+         *  Constructor for the VertexGroups data structure.
+         *
+         *  @param[in] vertexCount  The number of vertices. Initially, all vertices are available and no vertex is assigned to a group.
+         */
+        VertexGroups(std::size_t vertexCount) : members(vertexCount), available(vertexCount, 1), availableCount(vertexCount), groups(4), groupOf(vertexCount, UNASSIGNED), positionOf(vertexCount, 0)
+        {
+            std::iota(members.begin(), members.end(), 0);
+        }
+
+        /**
+         *  Constructor for the VertexGroups data structure.
+         *
+         *  @param[in] vertexCount          The total number of vertices.
+         *  @param[in] availableVertices    The vertices which shall initially be available in ascending order. No vertex is initially assigned to a group.
+         */
+        VertexGroups(std::size_t vertexCount, const std::vector<htd::vertex_t> & availableVertices) : members(), available(vertexCount, 0), availableCount(0), groups(4), groupOf(vertexCount, UNASSIGNED), positionOf(vertexCount, 0)
+        {
+            assign(availableVertices);
+        }
+
+        ~VertexGroups()
+        {
+
+        }
+
+        /**
+         *  Replace the managed vertices by the given ones.
+         *
+         *  Only the entries of the previously managed vertices and of the new vertices are updated,
+         *  i.e., the operation does not depend on the total number of vertices.
+         *
+         *  @param[in] availableVertices    The vertices which shall be available in ascending order. No vertex is assigned to a group.
+         */
+        void assign(const std::vector<htd::vertex_t> & availableVertices)
+        {
+            for (htd::vertex_t vertex : members)
+            {
+                available[vertex] = 0;
+
+                groupOf[vertex] = UNASSIGNED;
+            }
+
+            for (std::vector<htd::vertex_t> & group : groups)
+            {
+                group.clear();
+            }
+
+            members = availableVertices;
+
+            for (htd::vertex_t vertex : members)
+            {
+                available[vertex] = 1;
+            }
+
+            availableCount = members.size();
+        }
+
+        /**
+         *  Check whether all vertices were eliminated.
+         *
+         *  @return True if all vertices were eliminated, false otherwise.
+         */
+        bool empty(void) const
+        {
+            return availableCount == 0;
+        }
+
+        /**
+         *  Check whether the given vertex was not yet eliminated.
+         *
+         *  @param[in] vertex   The vertex.
+         *
+         *  @return True if the given vertex was not yet eliminated, false otherwise.
+         */
+        bool isAvailable(htd::vertex_t vertex) const
+        {
+            return available[vertex] != 0;
+        }
+
+        /**
+         *  Access the group of vertices with the given degree.
+         *
+         *  @param[in] degree   The degree of the vertices. The degree must be less than four.
+         *
+         *  @return The group of vertices with the given degree in unspecified order.
+         */
+        const std::vector<htd::vertex_t> & group(std::size_t degree) const
+        {
+            return groups[degree];
+        }
+
+        /**
+         *  Update the group to which the given vertex belongs.
+         *
+         *  @param[in] vertex   The vertex which shall be assigned to a group.
+         *  @param[in] degree   The new degree of the vertex.
+         */
+        void updateDegree(htd::vertex_t vertex, std::size_t degree)
+        {
+            removeFromGroup(vertex);
+
+            if (degree < groups.size())
+            {
+                std::vector<htd::vertex_t> & targetGroup = groups[degree];
+
+                groupOf[vertex] = static_cast<unsigned char>(degree);
+
+                positionOf[vertex] = static_cast<htd::vertex_t>(targetGroup.size());
+
+                targetGroup.push_back(vertex);
+            }
+        }
+
+        /**
+         *  Remove the given vertex from the group to which it belongs.
+         *
+         *  @param[in] vertex   The vertex which shall be removed from its group.
+         */
+        void removeFromGroup(htd::vertex_t vertex)
+        {
+            unsigned char index = groupOf[vertex];
+
+            if (index != UNASSIGNED)
+            {
+                std::vector<htd::vertex_t> & sourceGroup = groups[index];
+
+                htd::vertex_t lastVertex = sourceGroup.back();
+
+                sourceGroup[positionOf[vertex]] = lastVertex;
+
+                positionOf[lastVertex] = positionOf[vertex];
+
+                sourceGroup.pop_back();
+
+                groupOf[vertex] = UNASSIGNED;
+            }
+        }
+
+        /**
+         *  Mark the given vertex as eliminated and remove it from the group to which it belongs.
+         *
+         *  @param[in] vertex   The vertex which shall be marked as eliminated.
+         */
+        void erase(htd::vertex_t vertex)
+        {
+            if (available[vertex] != 0)
+            {
+                available[vertex] = 0;
+
+                --availableCount;
+            }
+
+            removeFromGroup(vertex);
+        }
+
+        /**
+         *  Write the vertices which were not yet eliminated to the end of the given vector.
+         *
+         *  @param[out] target  The target vector to which the vertices shall be appended in ascending order.
+         */
+        void copyAvailableVerticesTo(std::vector<htd::vertex_t> & target) const
+        {
+            target.reserve(target.size() + availableCount);
+
+            for (htd::vertex_t vertex : members)
+            {
+                if (available[vertex] != 0)
+                {
+                    target.push_back(vertex);
+                }
+            }
+        }
+
+        /**
+         *  The vertices managed by the data structure in ascending order.
+         */
+        std::vector<htd::vertex_t> members;
+
+        /**
+         *  A flag for each vertex indicating whether the vertex was not yet eliminated.
+         */
+        std::vector<unsigned char> available;
+
+        /**
+         *  The number of vertices which were not yet eliminated.
+         */
+        std::size_t availableCount;
+
+        /**
+         *  The groups of vertices with degree 0, 1, 2 and 3.
+         */
+        std::vector<std::vector<htd::vertex_t>> groups;
+
+        /**
+         *  The group to which each vertex belongs.
+         */
+        std::vector<unsigned char> groupOf;
+
+        /**
+         *  The position of each vertex within its group.
+         */
+        std::vector<htd::vertex_t> positionOf;
+    };
+
+    /**
+     *  The result of the elimination of a single connected component of the remainder of the input graph.
+     */
+    struct ComponentResult
+    {
+        /**
+         *  Constructor for the ComponentResult data structure.
+         */
+        ComponentResult(void) : ordering(), eliminatedVertices(), remainingVertices(), minTreeWidth(0), processed(false)
+        {
+
+        }
+
+        /**
+         *  The partial vertex elimination ordering of the component.
+         */
+        std::vector<htd::vertex_t> ordering;
+
+        /**
+         *  The vertices of the component which were eliminated.
+         */
+        std::vector<htd::vertex_t> eliminatedVertices;
+
+        /**
+         *  The vertices of the component which were retained in ascending order.
+         */
+        std::vector<htd::vertex_t> remainingVertices;
+
+        /**
+         *  The lower bound for the treewidth of the component.
+         */
+        std::size_t minTreeWidth;
+
+        /**
+         *  A boolean flag indicating whether the component was processed.
+         */
+        bool processed;
+    };
+
     /**
      *  Eliminate all vertices of degree less than 2 from the graph.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The available vertices of the remaining graph, grouped by degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                     std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateVerticesOfDegreeLessThanTwo(VertexGroups & vertices,
                                                      std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                      std::vector<htd::vertex_t> & ordering);
 
     /**
      *  Eliminate all vertices of degree 2 from the graph.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The available vertices of the remaining graph, grouped by degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool contractPaths(VertexGroups & vertices,
                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
                               std::vector<htd::vertex_t> & ordering);
 
@@ -606,15 +898,13 @@ struct htd::GraphPreprocessor::Implementation
      *  Eliminate all vertices of degree 3 from the graph in
      *  case that at least two of its neighbors are adjacent.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The available vertices of the remaining graph, grouped by degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool shrinkTriangles(VertexGroups & vertices,
                                 std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                 std::vector<htd::vertex_t> & ordering);
 
@@ -623,15 +913,13 @@ struct htd::GraphPreprocessor::Implementation
      *  eliminate both of them and connect the three neighbors so
      *  that they form a triangle.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The available vertices of the remaining graph, grouped by degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool handleBuddies(VertexGroups & vertices,
                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
                               std::vector<htd::vertex_t> & ordering);
 
@@ -639,8 +927,7 @@ struct htd::GraphPreprocessor::Implementation
      *  Eliminate all vertices from the graph for which
      *  it holds that all its neighbors form a clique.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The available vertices of the remaining graph, grouped by degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in] maxDegree        The degree up to which a vertex shall be considered for this preprocessing.
@@ -648,8 +935,7 @@ struct htd::GraphPreprocessor::Implementation
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                            std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateSimplicialVertices(VertexGroups & vertices,
                                             std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                             std::vector<htd::vertex_t> & ordering,
                                             std::size_t maxDegree,
@@ -660,44 +946,18 @@ struct htd::GraphPreprocessor::Implementation
      *  holds that at least all but one of its neighbors
      *  form a clique.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The available vertices of the remaining graph, grouped by degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateAlmostSimplicialVertices(VertexGroups & vertices,
                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                   std::vector<htd::vertex_t> & ordering,
                                                   std::size_t & minTreeWidth);
 
-    /**
-     *  Update the group to which the given vertex belongs.
-     *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     *  @param[in] oldDegree        The old degree of the vertex.
-     */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree,
-                                    std::size_t oldDegree);
-
-    /**
-     *  Update the group to which the given vertex belongs.
-     *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree);
-
     /**
      *  Decompose two sets of vertices into vertices only in the first set and vertices in both sets.
      *
@@ -720,19 +980,46 @@ struct htd::GraphPreprocessor::Implementation
      */
     void applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
                                                 htd::PreprocessedGraph & preprocessedGraph,
-                                                std::unordered_set<htd::vertex_t> & vertices) const;
+                                                VertexGroups & vertices) const;
+
+    /**
+     *  Apply the reduction rules to a connected component of the given preprocessed graph and, if requested, eliminate the remainder of the component.
+     *
+     *  The method modifies only the neighborhoods of the vertices of the given component, i.e., it can be invoked concurrently for disjoint connected components.
+     *
+     *  @param[in] graph                    The graph underlying the operation.
+     *  @param[in] preprocessedGraph        The preprocessed graph to which the component belongs.
+     *  @param[in,out] neighborhood         The neighborhoods of the vertices of the preprocessed graph which shall be updated.
+     *  @param[in,out] componentVertices    The work-lists which shall be used for the component. They may have been used for another component before.
+     *  @param[in] component                The vertices of the connected component in ascending order.
+     *  @param[in] eliminateRemainder       A boolean flag indicating whether the vertices remaining after the application of the reduction rules shall be eliminated, too.
+     *  @param[in] orderingAlgorithm        The ordering algorithm which shall be used to eliminate the remainder of the component.
+     *  @param[out] result                  The result of the elimination of the connected component.
+     */
+    void preprocessComponent(const htd::IMultiHypergraph & graph,
+                             const htd::PreprocessedGraph & preprocessedGraph,
+                             std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                             VertexGroups & componentVertices,
+                             const std::vector<htd::vertex_t> & component,
+                             bool eliminateRemainder,
+                             const htd::IWidthLimitableOrderingAlgorithm & orderingAlgorithm,
+                             ComponentResult & result) const;
 
     /**
-     *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
+     *  Eliminate a connected component from the given preprocessed graph.
      *
      *  @param[in] graph                The graph underlying the operation.
      *  @param[in] vertices             The vertices which shall be eliminated.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
+     *  @param[in] orderingAlgorithm    The ordering algorithm which shall be used to compute the vertex elimination ordering.
+     *  @param[out] ordering            The vertex elimination ordering to which the eliminated vertices shall be appended.
      *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
      */
     void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
-                           htd::PreprocessedGraph & preprocessedGraph,
+                           const VertexGroups & vertices,
+                           const htd::PreprocessedGraph & preprocessedGraph,
+                           const htd::IWidthLimitableOrderingAlgorithm & orderingAlgorithm,
+                           std::vector<htd::vertex_t> & ordering,
                            std::size_t & minTreeWidth) const;
 
     /**
@@ -742,7 +1029,7 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in] vertices             The set of all available vertices.
      */
     void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                           std::unordered_set<htd::vertex_t> & vertices) const;
+                                           VertexGroups & vertices) const;
 };
 
 htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -757,6 +1044,8 @@ htd::GraphPreprocessor::~GraphPreprocessor()
 
 htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::PreprocessedGraph * ret = nullptr;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
@@ -771,9 +1060,7 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
     if (implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_)
     {
-        std::unordered_set<htd::vertex_t> vertices(size);
-
-        std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+        htd::GraphPreprocessor::Implementation::VertexGroups vertices(size);
 
         std::vector<htd::vertex_t> ordering;
         ordering.reserve(size);
@@ -782,52 +1069,50 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
         {
-            vertices.insert(vertex);
-
-            implementation_->assignVertexToGroup(vertex, verticesByDegree, neighborhood[vertex].size());
+            vertices.updateDegree(vertex, neighborhood[vertex].size());
         }
 
-        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
         {
 
         }
 
         bool ok = false;
 
-        if (!vertices.empty() && implementation_->applyPreprocessing2_)
+        if (!vertices.empty() && implementation_->applyPreprocessing2_ && !managementInstance.isTerminated())
         {
             minTreeWidth = 2;
 
-            while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+            while (implementation_->contractPaths(vertices, neighborhood, ordering))
             {
                 ok = true;
             }
 
             if (ok)
             {
-                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                 {
 
                 }
             }
         }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing3_)
+        if (!vertices.empty() && implementation_->applyPreprocessing3_ && !managementInstance.isTerminated())
         {
             minTreeWidth = 3;
 
-            while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+            while (implementation_->shrinkTriangles(vertices, neighborhood, ordering))
             {
                 ok = false;
 
-                while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->contractPaths(vertices, neighborhood, ordering))
                 {
                     ok = true;
                 }
 
                 if (ok)
                 {
-                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                     {
 
                     }
@@ -835,42 +1120,42 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             }
         }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing4_)
+        if (!vertices.empty() && implementation_->applyPreprocessing4_ && !managementInstance.isTerminated())
         {
-            if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
+            if (implementation_->eliminateSimplicialVertices(vertices, neighborhood, ordering, 64, minTreeWidth))
             {
-                while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->shrinkTriangles(vertices, neighborhood, ordering))
                 {
                     ok = false;
 
-                    while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->contractPaths(vertices, neighborhood, ordering))
                     {
                         ok = true;
                     }
 
                     if (ok)
                     {
-                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                         {
 
                         }
                     }
                 }
 
-                while (implementation_->eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth))
+                while (!managementInstance.isTerminated() && implementation_->eliminateAlmostSimplicialVertices(vertices, neighborhood, ordering, minTreeWidth))
                 {
-                    while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->shrinkTriangles(vertices, neighborhood, ordering))
                     {
                         ok = false;
 
-                        while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                        while (implementation_->contractPaths(vertices, neighborhood, ordering))
                         {
                             ok = true;
                         }
 
                         if (ok)
                         {
-                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                             {
 
                             }
@@ -885,17 +1170,19 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             ordering[index] = vertexNames[ordering[index]];
         }
 
-        std::vector<htd::vertex_t> remainingVertices(vertices.begin(), vertices.end());
+        std::vector<htd::vertex_t> remainingVertices;
 
-        std::sort(remainingVertices.begin(), remainingVertices.end());
+        vertices.copyAvailableVerticesTo(remainingVertices);
 
         ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(ordering), std::move(remainingVertices), graph.edgeCount(), minTreeWidth);
 
-        if (implementation_->applyPreprocessing4_)
+        if (implementation_->applyBiconnectedComponentPreprocessing_ && !managementInstance.isTerminated())
         {
-            //TODO
-            //implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
+            implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
+        }
 
+        if (implementation_->applyPreprocessing4_)
+        {
             //TODO
             //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
         }
@@ -909,6 +1196,8 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
         ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), graph.edgeCount(), 0);
     }
 
+    ret->updateDenseAdjacencyMatrix();
+
     return ret;
 }
 
@@ -920,6 +1209,7 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = false;
         implementation_->applyPreprocessing3_ = false;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyBiconnectedComponentPreprocessing_ = false;
     }
     else if (level == 1)
     {
@@ -927,6 +1217,7 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = false;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyBiconnectedComponentPreprocessing_ = false;
     }
     else if (level == 2)
     {
@@ -934,13 +1225,23 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = true;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyBiconnectedComponentPreprocessing_ = false;
     }
-    else if (level > 2)
+    else if (level == 3)
     {
         implementation_->applyPreprocessing1_ = true;
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = true;
         implementation_->applyPreprocessing4_ = true;
+        implementation_->applyBiconnectedComponentPreprocessing_ = false;
+    }
+    else
+    {
+        implementation_->applyPreprocessing1_ = true;
+        implementation_->applyPreprocessing2_ = true;
+        implementation_->applyPreprocessing3_ = true;
+        implementation_->applyPreprocessing4_ = true;
+        implementation_->applyBiconnectedComponentPreprocessing_ = true;
     }
 }
 
@@ -976,6 +1277,28 @@ void htd::GraphPreprocessor::setNonImprovementLimit(std::size_t nonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::chrono::milliseconds htd::GraphPreprocessor::timeLimit(void) const
+{
+    return implementation_->timeLimit_;
+}
+
+void htd::GraphPreprocessor::setTimeLimit(std::chrono::milliseconds timeLimit)
+{
+    implementation_->timeLimit_ = timeLimit;
+}
+
+std::size_t htd::GraphPreprocessor::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::GraphPreprocessor::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAlgorithm * algorithm)
 {
     HTD_ASSERT(algorithm != nullptr)
@@ -987,51 +1310,44 @@ void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAl
 
 htd::GraphPreprocessor * htd::GraphPreprocessor::clone(void) const
 {
-    return new htd::GraphPreprocessor(implementation_->managementInstance_);
-}
+    htd::GraphPreprocessor * ret = new htd::GraphPreprocessor(implementation_->managementInstance_);
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree)
-{
-    if (newDegree < verticesByDegree.size())
-    {
-        verticesByDegree[newDegree].insert(vertex);
-    }
-}
+    ret->implementation_->applyPreprocessing1_ = implementation_->applyPreprocessing1_;
+    ret->implementation_->applyPreprocessing2_ = implementation_->applyPreprocessing2_;
+    ret->implementation_->applyPreprocessing3_ = implementation_->applyPreprocessing3_;
+    ret->implementation_->applyPreprocessing4_ = implementation_->applyPreprocessing4_;
+    ret->implementation_->applyBiconnectedComponentPreprocessing_ = implementation_->applyBiconnectedComponentPreprocessing_;
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree,
-                                                                 std::size_t oldDegree)
-{
-    if (oldDegree < verticesByDegree.size())
-    {
-        verticesByDegree[oldDegree].erase(vertex);
-    }
+    ret->implementation_->iterationCount_ = implementation_->iterationCount_;
+    ret->implementation_->nonImprovementLimit_ = implementation_->nonImprovementLimit_;
+    ret->implementation_->timeLimit_ = implementation_->timeLimit_;
+    ret->implementation_->threadCount_ = implementation_->threadCount_;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    ret->setOrderingAlgorithm(implementation_->orderingAlgorithm_->clone());
+#else
+    ret->setOrderingAlgorithm(implementation_->orderingAlgorithm_->cloneWidthLimitableOrderingAlgorithm());
+#endif
 
-    assignVertexToGroup(vertex, verticesByDegree, newDegree);
+    return ret;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+const unsigned char htd::GraphPreprocessor::Implementation::VertexGroups::UNASSIGNED;
+
+bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(VertexGroups & vertices,
                                                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                   std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
+    ordering.insert(ordering.end(), vertices.group(0).begin(), vertices.group(0).end());
 
-    for (htd::vertex_t vertex : verticesDegree0)
+    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
-        ordering.push_back(vertex);
+        vertices.erase(*it);
     }
 
-    verticesDegree0.clear();
-
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree1.begin(), verticesDegree1.end());
+    std::vector<htd::vertex_t> relevantVertices(vertices.group(1));
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1047,38 +1363,26 @@ bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTw
             // coverity[use_iterator]
             otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-            assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+            vertices.updateDegree(neighbor, otherNeighborhood.size());
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
-
-            verticesDegree1.erase(vertex);
-        }
-        else
-        {
-            verticesDegree0.erase(vertex);
         }
 
-        ordering.push_back(vertex);
-    }
+        vertices.erase(vertex);
 
-    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
-    {
-        vertices.erase(*it);
+        ordering.push_back(vertex);
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::contractPaths(VertexGroups & vertices,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                            std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree2.begin(), verticesDegree2.end());
+    std::vector<htd::vertex_t> relevantVertices(vertices.group(2));
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1104,8 +1408,8 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 
             if (position != otherNeighborhood1.end() && *position == neighbor2)
             {
-                assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), otherNeighborhood1.size() + 1);
-                assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                vertices.updateDegree(neighbor1, otherNeighborhood1.size());
+                vertices.updateDegree(neighbor2, otherNeighborhood2.size());
             }
             else
             {
@@ -1115,27 +1419,22 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
 
-            verticesDegree2.erase(vertex);
+            vertices.erase(vertex);
 
             ordering.push_back(vertex);
-
-            vertices.erase(vertex);
         }
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                                             std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::shrinkTriangles(VertexGroups & vertices,
                                                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                              std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    std::vector<htd::vertex_t> relevantVertices(vertices.group(3));
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1234,26 +1533,24 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
 
                 if (neighborDegree1 != otherNeighborhood1.size())
                 {
-                    assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), neighborDegree1);
+                    vertices.updateDegree(neighbor1, otherNeighborhood1.size());
                 }
 
                 if (neighborDegree2 != otherNeighborhood2.size())
                 {
-                    assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), neighborDegree2);
+                    vertices.updateDegree(neighbor2, otherNeighborhood2.size());
                 }
 
                 if (neighborDegree3 != otherNeighborhood3.size())
                 {
-                    assignVertexToGroup(neighbor3, verticesByDegree, otherNeighborhood3.size(), neighborDegree3);
+                    vertices.updateDegree(neighbor3, otherNeighborhood3.size());
                 }
 
                 std::vector<htd::vertex_t>().swap(currentNeighborhood);
 
-                verticesDegree3.erase(vertex);
+                vertices.erase(vertex);
 
                 ordering.push_back(vertex);
-
-                vertices.erase(vertex);
             }
         }
     }
@@ -1261,16 +1558,13 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::handleBuddies(VertexGroups & vertices,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                            std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    std::vector<htd::vertex_t> relevantVertices(vertices.group(3));
 
     if (relevantVertices.size() > 1)
     {
@@ -1302,14 +1596,6 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                             htd::vertex_t neighbor2 = currentNeighborhood1[1];
                             htd::vertex_t neighbor3 = currentNeighborhood1[2];
 
-                            std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
-                            std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
-                            std::vector<htd::vertex_t> & otherNeighborhood3 = neighborhood[neighbor3];
-
-                            std::size_t neighborDegree1 = otherNeighborhood1.size();
-                            std::size_t neighborDegree2 = otherNeighborhood2.size();
-                            std::size_t neighborDegree3 = otherNeighborhood3.size();
-
                             for (htd::vertex_t vertex : currentNeighborhood1)
                             {
                                 std::vector<htd::vertex_t> & currentNeighborhood3 = neighborhood[vertex];
@@ -1348,9 +1634,9 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                                 }
                             }
 
-                            assignVertexToGroup(neighbor1, verticesByDegree, neighborhood[neighbor1].size(), neighborDegree1);
-                            assignVertexToGroup(neighbor2, verticesByDegree, neighborhood[neighbor2].size(), neighborDegree2);
-                            assignVertexToGroup(neighbor3, verticesByDegree, neighborhood[neighbor3].size(), neighborDegree3);
+                            vertices.updateDegree(neighbor1, neighborhood[neighbor1].size());
+                            vertices.updateDegree(neighbor2, neighborhood[neighbor2].size());
+                            vertices.updateDegree(neighbor3, neighborhood[neighbor3].size());
 
                             std::vector<htd::vertex_t>().swap(currentNeighborhood1);
                             std::vector<htd::vertex_t>().swap(currentNeighborhood2);
@@ -1368,16 +1654,13 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
         for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
         {
             vertices.erase(*it);
-
-            verticesDegree3.erase(*it);
         }
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                         std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(VertexGroups & vertices,
                                                                          std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                          std::vector<htd::vertex_t> & ordering,
                                                                          std::size_t maxDegree,
@@ -1385,11 +1668,11 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    for (htd::vertex_t vertex : vertices)
+    for (htd::vertex_t vertex = 0; vertex < neighborhood.size(); ++vertex)
     {
         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-        if (currentNeighborhood.size() <= maxDegree)
+        if (vertices.isAvailable(vertex) && currentNeighborhood.size() <= maxDegree)
         {
             bool ok = true;
 
@@ -1397,7 +1680,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
             {
                 const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
 
-                ok = htd::set_intersection_size(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end()) == currentNeighborhood.size() - 1;
+                ok = htd::set_intersection_size(otherNeighborhood, currentNeighborhood) == currentNeighborhood.size() - 1;
             }
 
             if (ok)
@@ -1410,7 +1693,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
                     // coverity[use_iterator]
                     otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    vertices.updateDegree(neighbor, otherNeighborhood.size());
                 }
 
                 minTreewidth = std::max(minTreewidth, currentNeighborhood.size());
@@ -1422,37 +1705,26 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
     for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
         vertices.erase(*it);
-
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                               std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(VertexGroups & vertices,
                                                                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                std::vector<htd::vertex_t> & ordering,
                                                                                std::size_t & minTreeWidth)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    for (htd::vertex_t vertex : vertices)
+    for (htd::vertex_t vertex = 0; vertex < neighborhood.size(); ++vertex)
     {
         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-        if (currentNeighborhood.size() > 1 && currentNeighborhood.size() <= minTreeWidth)
+        if (vertices.isAvailable(vertex) && currentNeighborhood.size() > 1 && currentNeighborhood.size() <= minTreeWidth)
         {
             bool ok = true;
 
@@ -1483,7 +1755,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                     // coverity[use_iterator]
                     otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    vertices.updateDegree(neighbor, otherNeighborhood.size());
                 }
 
                 minTreeWidth = std::max(minTreeWidth, currentNeighborhood.size());
@@ -1530,7 +1802,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
 
                                 otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), culprit), culprit);
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() - 1);
+                                vertices.updateDegree(neighbor, otherNeighborhood2.size());
                             }
 
                             std::size_t middle = otherNeighborhood.size();
@@ -1539,7 +1811,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
 
                             std::inplace_merge(otherNeighborhood.begin(), otherNeighborhood.begin() + middle, otherNeighborhood.end());
 
-                            assignVertexToGroup(culprit, verticesByDegree, otherNeighborhood.size(), middle);
+                            vertices.updateDegree(culprit, otherNeighborhood.size());
 
                             for (htd::vertex_t neighbor : currentNeighborhood)
                             {
@@ -1549,7 +1821,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                                 // coverity[use_iterator]
                                 otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                                vertices.updateDegree(neighbor, otherNeighborhood2.size());
                             }
 
                             std::vector<htd::vertex_t>().swap(currentNeighborhood);
@@ -1562,19 +1834,9 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
     for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
         vertices.erase(*it);
-
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
     }
 
     return ordering.size() > oldOrderingSize;
@@ -1622,7 +1884,7 @@ void htd::GraphPreprocessor::Implementation::splitSets(const std::vector<htd::ve
 
 void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
                                                                                     htd::PreprocessedGraph & preprocessedGraph,
-                                                                                    std::unordered_set<htd::vertex_t> & vertices) const
+                                                                                    VertexGroups & vertices) const
 {
     htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
 
@@ -1717,154 +1979,226 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
            return component1.size() < component2.size();
         });
 
-        for (const std::vector<htd::vertex_t> & component : connectedComponents)
-        {
-            std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+        std::size_t componentCount = connectedComponents.size();
 
-            std::size_t oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+        std::vector<ComponentResult> results(componentCount);
 
-            std::unordered_set<htd::vertex_t> componentVertices(component.begin(), component.end());
+        std::size_t workerCount = std::max(std::min(threadCount_, componentCount), (std::size_t)1);
 
-            std::size_t minTreeWidth = 0;
+        std::vector<std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm>> orderingAlgorithms(workerCount);
 
-            for (htd::vertex_t vertex : component)
+        /* Each worker reuses its work-lists for all of its components, hence their size does not multiply with the number of components. */
+        std::vector<std::unique_ptr<VertexGroups>> componentVertices(workerCount);
+
+        /* Obtain the updatable neighborhoods once, the updatable getters of the preprocessed graph must not be called concurrently. */
+        std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
+
+        const htd::PreprocessedGraph & constPreprocessedGraph = preprocessedGraph;
+
+        /* The components are sorted by increasing size, hence they are scheduled in reverse order to balance the load. */
+        htd::seededParallelFor(componentCount, threadCount_, [&](htd::index_t worker, htd::index_t task)
+        {
+            htd::index_t index = componentCount - 1 - task;
+
+            if (!orderingAlgorithms[worker])
             {
-                assignVertexToGroup(vertex, verticesByDegree, preprocessedGraph.neighborhood(vertex).size());
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                orderingAlgorithms[worker].reset(orderingAlgorithm_->clone());
+#else
+                orderingAlgorithms[worker].reset(orderingAlgorithm_->cloneWidthLimitableOrderingAlgorithm());
+#endif
             }
 
-            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+            if (!componentVertices[worker])
             {
-
+                componentVertices[worker].reset(new VertexGroups(neighborhood.size(), connectedComponents[index]));
             }
+            else
+            {
+                componentVertices[worker]->assign(connectedComponents[index]);
+            }
+
+            /* The components are disjoint and not adjacent to each other, hence each task modifies only its own neighborhoods. */
+            preprocessComponent(graph, constPreprocessedGraph, neighborhood, *(componentVertices[worker]), connectedComponents[index], index + 1 < componentCount, *(orderingAlgorithms[worker]), results[index]);
+        });
+
+        std::vector<htd::vertex_t> remainingVertices;
 
-            bool ok = false;
+        /* Merge the results strictly in the order of the components to ensure a deterministic elimination sequence. */
+        for (htd::index_t index = 0; index < componentCount; ++index)
+        {
+            const ComponentResult & result = results[index];
 
-            if (!componentVertices.empty())
+            if (result.processed)
             {
-                minTreeWidth = 2;
+                preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), result.ordering.begin(), result.ordering.end());
 
-                while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                for (htd::vertex_t vertex : result.eliminatedVertices)
                 {
-                    ok = true;
+                    vertices.erase(vertex);
                 }
 
-                if (ok)
-                {
-                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
+                remainingVertices.insert(remainingVertices.end(), result.remainingVertices.begin(), result.remainingVertices.end());
 
-                    }
-                }
+                preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), result.minTreeWidth);
             }
-
-            if (!componentVertices.empty())
+            else
             {
-                minTreeWidth = 3;
+                /* Components which were skipped due to cancellation are retained completely. */
+                remainingVertices.insert(remainingVertices.end(), connectedComponents[index].begin(), connectedComponents[index].end());
+            }
+        }
 
-                while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                {
-                    ok = false;
+        std::sort(remainingVertices.begin(), remainingVertices.end());
 
-                    while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = true;
-                    }
+        preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
+    }
+}
 
-                    if (ok)
-                    {
-                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
+void htd::GraphPreprocessor::Implementation::preprocessComponent(const htd::IMultiHypergraph & graph,
+                                                                 const htd::PreprocessedGraph & preprocessedGraph,
+                                                                 std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                                                 VertexGroups & componentVertices,
+                                                                 const std::vector<htd::vertex_t> & component,
+                                                                 bool eliminateRemainder,
+                                                                 const htd::IWidthLimitableOrderingAlgorithm & orderingAlgorithm,
+                                                                 ComponentResult & result) const
+{
+    std::vector<htd::vertex_t> & ordering = result.ordering;
 
-                        }
-                    }
-                }
-            }
+    std::size_t minTreeWidth = 0;
 
-            if (!componentVertices.empty())
-            {
-                if (eliminateSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
-                {
-                    while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = false;
+    for (htd::vertex_t vertex : component)
+    {
+        componentVertices.updateDegree(vertex, neighborhood[vertex].size());
+    }
 
-                        while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = true;
-                        }
+    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, neighborhood, ordering))
+    {
 
-                        if (ok)
-                        {
-                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
+    }
 
-                            }
-                        }
-                    }
+    bool ok = false;
 
-                    while (eliminateAlmostSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
-                    {
-                        while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = false;
+    if (!componentVertices.empty())
+    {
+        minTreeWidth = 2;
 
-                            while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
-                                ok = true;
-                            }
+        while (contractPaths(componentVertices, neighborhood, ordering))
+        {
+            ok = true;
+        }
 
-                            if (ok)
-                            {
-                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                                {
+        if (ok)
+        {
+            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, neighborhood, ordering))
+            {
 
-                                }
-                            }
-                        }
-                    }
-                }
             }
+        }
+    }
+
+    if (!componentVertices.empty())
+    {
+        minTreeWidth = 3;
 
-            for (auto it = preprocessedGraph.eliminationSequence().begin() + oldOrderingSize; it != preprocessedGraph.eliminationSequence().end(); ++it)
+        while (shrinkTriangles(componentVertices, neighborhood, ordering))
+        {
+            ok = false;
+
+            while (contractPaths(componentVertices, neighborhood, ordering))
             {
-                vertices.erase(*it);
+                ok = true;
+            }
+
+            if (ok)
+            {
+                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, neighborhood, ordering))
+                {
 
-                *it = preprocessedGraph.vertexName(*it);
+                }
             }
+        }
+    }
 
-            if (!std::binary_search(component.begin(), component.end(), selectedComponent[0]))
+    if (!componentVertices.empty())
+    {
+        if (eliminateSimplicialVertices(componentVertices, neighborhood, ordering, 64, minTreeWidth))
+        {
+            while (shrinkTriangles(componentVertices, neighborhood, ordering))
             {
-                oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+                ok = false;
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+                while (contractPaths(componentVertices, neighborhood, ordering))
+                {
+                    ok = true;
+                }
 
-                for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
+                if (ok)
                 {
-                    vertices.erase(*it);
+                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, neighborhood, ordering))
+                    {
+
+                    }
                 }
             }
-            else
+
+            while (eliminateAlmostSimplicialVertices(componentVertices, neighborhood, ordering, minTreeWidth))
             {
-                std::vector<htd::vertex_t> remainingVertices(componentVertices.begin(), componentVertices.end());
+                while (shrinkTriangles(componentVertices, neighborhood, ordering))
+                {
+                    ok = false;
+
+                    while (contractPaths(componentVertices, neighborhood, ordering))
+                    {
+                        ok = true;
+                    }
 
-                std::sort(remainingVertices.begin(), remainingVertices.end());
+                    if (ok)
+                    {
+                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, neighborhood, ordering))
+                        {
 
-                preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
+                        }
+                    }
+                }
             }
-
-            preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
         }
     }
+
+    result.eliminatedVertices = ordering;
+
+    for (htd::vertex_t & vertex : ordering)
+    {
+        vertex = preprocessedGraph.vertexName(vertex);
+    }
+
+    if (eliminateRemainder)
+    {
+        eliminateVertices(graph, componentVertices, preprocessedGraph, orderingAlgorithm, ordering, minTreeWidth);
+
+        componentVertices.copyAvailableVerticesTo(result.eliminatedVertices);
+    }
+    else
+    {
+        componentVertices.copyAvailableVerticesTo(result.remainingVertices);
+    }
+
+    result.minTreeWidth = minTreeWidth;
+
+    result.processed = true;
 }
 
 void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
-                                                               htd::PreprocessedGraph & preprocessedGraph,
+                                                               const VertexGroups & vertices,
+                                                               const htd::PreprocessedGraph & preprocessedGraph,
+                                                               const htd::IWidthLimitableOrderingAlgorithm & orderingAlgorithm,
+                                                               std::vector<htd::vertex_t> & ordering,
                                                                std::size_t & minTreeWidth) const
 {
-    std::vector<htd::vertex_t> remainingComponentVertices(vertices.begin(), vertices.end());
+    std::vector<htd::vertex_t> remainingComponentVertices;
 
-    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
+    vertices.copyAvailableVerticesTo(remainingComponentVertices);
 
     htd::PreprocessedGraphComponent component(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth);
 
@@ -1883,7 +2217,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             remainingIterations = std::min(remainingIterations, nonImprovementLimit_);
         }
 
-        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm_->computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
+        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm.computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
 
         if (currentOrdering->requiredIterations() < nonImprovementLimit_)
         {
@@ -1898,12 +2232,9 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 
         if (!managementInstance_->isTerminated())
         {
-            if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
+            if (optimalOrdering == nullptr || currentMaxBagSize < bestMaxBagSize)
             {
-                if (iteration > 1)
-                {
-                    delete optimalOrdering;
-                }
+                delete optimalOrdering;
 
                 optimalOrdering = currentOrdering;
 
@@ -1922,16 +2253,16 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 
     if (optimalOrdering != nullptr)
     {
-        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
+        ordering.insert(ordering.end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
 
-        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), optimalOrdering->maximumBagSize() - 1);
+        minTreeWidth = std::max(minTreeWidth, optimalOrdering->maximumBagSize() - 1);
 
         delete optimalOrdering;
     }
 }
 
 void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                                                               std::unordered_set<htd::vertex_t> & vertices) const
+                                                                               VertexGroups & vertices) const
 {
     htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
 
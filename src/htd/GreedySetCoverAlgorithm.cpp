@@ -99,7 +99,7 @@ void htd::GreedySetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t>
             {
                 const std::vector<htd::id_t> & container = containers[containerIndex];
 
-                std::size_t currentOverlap = htd::set_intersection_size(relevantElements.begin(), relevantElements.end(), container.begin(), container.end());
+                std::size_t currentOverlap = htd::set_intersection_size(relevantElements, container);
 
                 if (currentOverlap == 0)
                 {
@@ -27,6 +27,595 @@
 
 #include <htd/Helpers.hpp>
 
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HTD_SSE2_SET_KERNELS_AVAILABLE
+
+#include <emmintrin.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define HTD_AVX2_SET_KERNELS_AVAILABLE
+
+#include <immintrin.h>
+#endif
+#endif
+
+namespace htd
+{
+    /**
+     *  The random number generator which is local to the current thread.
+     */
+    struct ThreadLocalRandomNumberGenerator
+    {
+        /**
+         *  A boolean flag indicating whether the generator was seeded and shall be used instead of std::rand().
+         */
+        bool enabled = false;
+
+        /**
+         *  The underlying random number generator.
+         */
+        std::mt19937 generator;
+    };
+
+    /**
+     *  Access the random number generator which is local to the calling thread.
+     *
+     *  @return The random number generator which is local to the calling thread.
+     */
+    static ThreadLocalRandomNumberGenerator & threadLocalRandomNumberGenerator(void)
+    {
+        static thread_local ThreadLocalRandomNumberGenerator ret;
+
+        return ret;
+    }
+
+    /**
+     *  The ratio between the sizes of two sorted sets of vertices starting from which the
+     *  elements of the smaller set are located in the larger set via exponential search.
+     */
+    static const std::size_t GALLOPING_THRESHOLD = 32;
+
+    /**
+     *  The instruction sets which can be used by the kernels for sorted sets of vertices.
+     */
+    enum class SetKernelInstructionSet
+    {
+        /**
+         *  Use plain merge loops only.
+         */
+        Scalar,
+
+        /**
+         *  Compare blocks of four vertices using SSE2 instructions.
+         */
+        SSE2,
+
+        /**
+         *  Compare blocks of eight vertices using AVX2 instructions.
+         */
+        AVX2
+    };
+
+    /**
+     *  Determine the most efficient instruction set for the kernels for sorted sets of vertices which is supported by the current CPU.
+     *
+     *  @note The vectorized kernels are only used if vertices are represented by 32-bit integers.
+     *
+     *  @return The most efficient instruction set for the kernels for sorted sets of vertices which is supported by the current CPU.
+     */
+    static SetKernelInstructionSet detectSetKernelInstructionSet(void)
+    {
+        SetKernelInstructionSet ret = SetKernelInstructionSet::Scalar;
+
+        if (sizeof(htd::vertex_t) == sizeof(std::uint32_t))
+        {
+#ifdef HTD_SSE2_SET_KERNELS_AVAILABLE
+            ret = SetKernelInstructionSet::SSE2;
+#endif
+
+#ifdef HTD_AVX2_SET_KERNELS_AVAILABLE
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx2"))
+            {
+                ret = SetKernelInstructionSet::AVX2;
+            }
+#endif
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Access the instruction set used by the kernels for sorted sets of vertices.
+     *
+     *  @return The instruction set used by the kernels for sorted sets of vertices.
+     */
+    static SetKernelInstructionSet setKernelInstructionSet(void)
+    {
+        static const SetKernelInstructionSet ret = detectSetKernelInstructionSet();
+
+        return ret;
+    }
+
+    /**
+     *  Locate the first vertex within a sorted range which is not less than the given vertex using exponential search.
+     *
+     *  @param[in] first    A pointer to the begin of the sorted range.
+     *  @param[in] last     A pointer to the end of the sorted range.
+     *  @param[in] vertex   The vertex which shall be located.
+     *
+     *  @return A pointer to the first vertex within the given range which is not less than the given vertex or last if there is no such vertex.
+     */
+    static const htd::vertex_t * gallop(const htd::vertex_t * first, const htd::vertex_t * last, htd::vertex_t vertex)
+    {
+        std::size_t count = static_cast<std::size_t>(last - first);
+
+        std::size_t bound = 1;
+
+        while (bound < count && first[bound] < vertex)
+        {
+            bound <<= 1;
+        }
+
+        return std::lower_bound(first + (bound >> 1), first + std::min(bound + 1, count), vertex);
+    }
+
+    /**
+     *  Append a sorted range of vertices to the result vector, skipping the given vertex.
+     *
+     *  @param[in] first            A pointer to the begin of the sorted range.
+     *  @param[in] last             A pointer to the end of the sorted range.
+     *  @param[in] ignoredVertex    The vertex which shall not be appended.
+     *  @param[out] result          The vector to which the vertices shall be appended.
+     */
+    static void appendRange(const htd::vertex_t * first, const htd::vertex_t * last, htd::vertex_t ignoredVertex, std::vector<htd::vertex_t> & result)
+    {
+        if (first != last)
+        {
+            if (*first <= ignoredVertex && ignoredVertex <= *(last - 1))
+            {
+                std::copy_if(first, last, std::back_inserter(result), [&](const htd::vertex_t vertex) { return vertex != ignoredVertex; });
+            }
+            else
+            {
+                result.insert(result.end(), first, last);
+            }
+        }
+    }
+
+    /**
+     *  Output policy for the kernels for sorted sets of vertices which collects the vertices found in both sets.
+     */
+    struct IntersectionOutput
+    {
+        /**
+         *  The vector to which the vertices found in both sets are appended.
+         */
+        std::vector<htd::vertex_t> & result;
+
+        /**
+         *  Constructor for a new output policy.
+         *
+         *  @param[in] target   The vector to which the vertices found in both sets shall be appended.
+         */
+        IntersectionOutput(std::vector<htd::vertex_t> & target) : result(target)
+        {
+
+        }
+
+        /**
+         *  Process a vertex of the first set which is also found in the second set.
+         *
+         *  @param[in] vertex   The vertex.
+         */
+        void matched(htd::vertex_t vertex)
+        {
+            result.push_back(vertex);
+        }
+
+        /**
+         *  Process a vertex of the first set which is not found in the second set.
+         *
+         *  @param[in] vertex   The vertex.
+         */
+        void unmatched(htd::vertex_t vertex)
+        {
+            HTD_UNUSED(vertex)
+        }
+
+        /**
+         *  Process a range of vertices of the first set which are not found in the second set.
+         *
+         *  @param[in] first    A pointer to the begin of the range.
+         *  @param[in] last     A pointer to the end of the range.
+         */
+        void unmatched(const htd::vertex_t * first, const htd::vertex_t * last)
+        {
+            HTD_UNUSED(first)
+            HTD_UNUSED(last)
+        }
+    };
+
+    /**
+     *  Output policy for the kernels for sorted sets of vertices which collects the vertices found only in the first set.
+     */
+    struct DifferenceOutput
+    {
+        /**
+         *  The vector to which the vertices found only in the first set are appended.
+         */
+        std::vector<htd::vertex_t> & result;
+
+        /**
+         *  Constructor for a new output policy.
+         *
+         *  @param[in] target   The vector to which the vertices found only in the first set shall be appended.
+         */
+        DifferenceOutput(std::vector<htd::vertex_t> & target) : result(target)
+        {
+
+        }
+
+        /**
+         *  Process a vertex of the first set which is also found in the second set.
+         *
+         *  @param[in] vertex   The vertex.
+         */
+        void matched(htd::vertex_t vertex)
+        {
+            HTD_UNUSED(vertex)
+        }
+
+        /**
+         *  Process a vertex of the first set which is not found in the second set.
+         *
+         *  @param[in] vertex   The vertex.
+         */
+        void unmatched(htd::vertex_t vertex)
+        {
+            result.push_back(vertex);
+        }
+
+        /**
+         *  Process a range of vertices of the first set which are not found in the second set.
+         *
+         *  @param[in] first    A pointer to the begin of the range.
+         *  @param[in] last     A pointer to the end of the range.
+         */
+        void unmatched(const htd::vertex_t * first, const htd::vertex_t * last)
+        {
+            result.insert(result.end(), first, last);
+        }
+    };
+
+    /**
+     *  Output policy for the kernels for sorted sets of vertices which counts the vertices found in both sets.
+     */
+    struct IntersectionSizeOutput
+    {
+        /**
+         *  The number of vertices found in both sets.
+         */
+        std::size_t count = 0;
+
+        /**
+         *  Process a vertex of the first set which is also found in the second set.
+         *
+         *  @param[in] vertex   The vertex.
+         */
+        void matched(htd::vertex_t vertex)
+        {
+            HTD_UNUSED(vertex)
+
+            ++count;
+        }
+
+        /**
+         *  Process a vertex of the first set which is not found in the second set.
+         *
+         *  @param[in] vertex   The vertex.
+         */
+        void unmatched(htd::vertex_t vertex)
+        {
+            HTD_UNUSED(vertex)
+        }
+
+        /**
+         *  Process a range of vertices of the first set which are not found in the second set.
+         *
+         *  @param[in] first    A pointer to the begin of the range.
+         *  @param[in] last     A pointer to the end of the range.
+         */
+        void unmatched(const htd::vertex_t * first, const htd::vertex_t * last)
+        {
+            HTD_UNUSED(first)
+            HTD_UNUSED(last)
+        }
+    };
+
+    /**
+     *  Forward a block of vertices of the first set to the given output policy.
+     *
+     *  @param[in] block    A pointer to the first vertex of the block.
+     *  @param[in] width    The number of vertices in the block.
+     *  @param[in] mask     The bit mask indicating which vertices of the block are also found in the second set.
+     *  @param[in] output   The output policy.
+     */
+    template < typename Output >
+    static void emitBlock(const htd::vertex_t * block, std::size_t width, unsigned int mask, Output & output)
+    {
+        for (std::size_t index = 0; index < width; ++index)
+        {
+            if (((mask >> index) & 1) != 0)
+            {
+                output.matched(block[index]);
+            }
+            else
+            {
+                output.unmatched(block[index]);
+            }
+        }
+    }
+
+#ifdef HTD_SSE2_SET_KERNELS_AVAILABLE
+    /**
+     *  Compare two sorted sets of 32-bit vertices in blocks of four vertices using SSE2 instructions.
+     *
+     *  The function processes the sets as long as both of them contain at least four more vertices.
+     *  All vertices of the first set before the updated position first1 are forwarded to the output
+     *  policy. All vertices of the second set which are equal to a vertex of the first set at or after
+     *  the updated position first1 are located at or after the updated position first2.
+     *
+     *  @param[in,out] first1   A pointer to the begin of the first set.
+     *  @param[in] last1        A pointer to the end of the first set.
+     *  @param[in,out] first2   A pointer to the begin of the second set.
+     *  @param[in] last2        A pointer to the end of the second set.
+     *  @param[in] output       The output policy.
+     */
+    template < typename Output >
+    static void processBlocksSSE2(const htd::vertex_t * & first1, const htd::vertex_t * last1,
+                                  const htd::vertex_t * & first2, const htd::vertex_t * last2,
+                                  Output & output)
+    {
+        const htd::vertex_t * begin2 = first2;
+
+        unsigned int mask = 0;
+
+        while (last1 - first1 >= 4 && last2 - first2 >= 4)
+        {
+            __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first1));
+            __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first2));
+
+            __m128i matches = _mm_cmpeq_epi32(block1, block2);
+
+            block2 = _mm_shuffle_epi32(block2, _MM_SHUFFLE(0, 3, 2, 1));
+
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi32(block1, block2));
+
+            block2 = _mm_shuffle_epi32(block2, _MM_SHUFFLE(0, 3, 2, 1));
+
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi32(block1, block2));
+
+            block2 = _mm_shuffle_epi32(block2, _MM_SHUFFLE(0, 3, 2, 1));
+
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi32(block1, block2));
+
+            mask |= static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(matches)));
+
+            htd::vertex_t maximum1 = first1[3];
+            htd::vertex_t maximum2 = first2[3];
+
+            if (maximum1 <= maximum2)
+            {
+                emitBlock(first1, 4, mask, output);
+
+                first1 += 4;
+
+                mask = 0;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                first2 += 4;
+            }
+        }
+
+        if (mask != 0)
+        {
+            first2 = std::lower_bound(begin2, first2, *first1);
+        }
+    }
+#endif
+
+#ifdef HTD_AVX2_SET_KERNELS_AVAILABLE
+    /**
+     *  Compare two sorted sets of 32-bit vertices in blocks of eight vertices using AVX2 instructions.
+     *
+     *  The function processes the sets as long as both of them contain at least eight more vertices.
+     *  All vertices of the first set before the updated position first1 are forwarded to the output
+     *  policy. All vertices of the second set which are equal to a vertex of the first set at or after
+     *  the updated position first1 are located at or after the updated position first2.
+     *
+     *  @param[in,out] first1   A pointer to the begin of the first set.
+     *  @param[in] last1        A pointer to the end of the first set.
+     *  @param[in,out] first2   A pointer to the begin of the second set.
+     *  @param[in] last2        A pointer to the end of the second set.
+     *  @param[in] output       The output policy.
+     */
+    template < typename Output >
+    __attribute__((target("avx2")))
+    static void processBlocksAVX2(const htd::vertex_t * & first1, const htd::vertex_t * last1,
+                                  const htd::vertex_t * & first2, const htd::vertex_t * last2,
+                                  Output & output)
+    {
+        const htd::vertex_t * begin2 = first2;
+
+        const __m256i rotation = _mm256_set_epi32(0, 7, 6, 5, 4, 3, 2, 1);
+
+        unsigned int mask = 0;
+
+        while (last1 - first1 >= 8 && last2 - first2 >= 8)
+        {
+            __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first1));
+            __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first2));
+
+            __m256i matches = _mm256_cmpeq_epi32(block1, block2);
+
+            for (int step = 1; step < 8; ++step)
+            {
+                block2 = _mm256_permutevar8x32_epi32(block2, rotation);
+
+                matches = _mm256_or_si256(matches, _mm256_cmpeq_epi32(block1, block2));
+            }
+
+            mask |= static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(matches)));
+
+            htd::vertex_t maximum1 = first1[7];
+            htd::vertex_t maximum2 = first2[7];
+
+            if (maximum1 <= maximum2)
+            {
+                emitBlock(first1, 8, mask, output);
+
+                first1 += 8;
+
+                mask = 0;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                first2 += 8;
+            }
+        }
+
+        if (mask != 0)
+        {
+            first2 = std::lower_bound(begin2, first2, *first1);
+        }
+    }
+#endif
+
+    /**
+     *  Compare two sorted sets of vertices and forward each vertex of the first set to the given output policy.
+     *
+     *  If the first set is considerably smaller than the second one, its vertices are located in the
+     *  second set via exponential search. Otherwise, the sets are compared block-wise using the most
+     *  efficient instruction set supported by the current CPU and the remainder is merged element-wise.
+     *
+     *  @param[in] first1   A pointer to the begin of the first set.
+     *  @param[in] last1    A pointer to the end of the first set.
+     *  @param[in] first2   A pointer to the begin of the second set.
+     *  @param[in] last2    A pointer to the end of the second set.
+     *  @param[in] output   The output policy.
+     */
+    template < typename Output >
+    static void processSortedSets(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                  const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                  Output & output)
+    {
+        if (static_cast<std::size_t>(last1 - first1) * GALLOPING_THRESHOLD <= static_cast<std::size_t>(last2 - first2))
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                first2 = gallop(first2, last2, *first1);
+
+                if (first2 != last2 && *first2 == *first1)
+                {
+                    output.matched(*first1);
+
+                    ++first2;
+                }
+                else
+                {
+                    output.unmatched(*first1);
+                }
+
+                ++first1;
+            }
+        }
+        else
+        {
+            switch (setKernelInstructionSet())
+            {
+#ifdef HTD_AVX2_SET_KERNELS_AVAILABLE
+                case SetKernelInstructionSet::AVX2:
+                {
+                    processBlocksAVX2(first1, last1, first2, last2, output);
+
+                    break;
+                }
+#endif
+#ifdef HTD_SSE2_SET_KERNELS_AVAILABLE
+                case SetKernelInstructionSet::SSE2:
+                {
+                    processBlocksSSE2(first1, last1, first2, last2, output);
+
+                    break;
+                }
+#endif
+                default:
+                {
+                    break;
+                }
+            }
+
+            while (first1 != last1 && first2 != last2)
+            {
+                if (*first1 < *first2)
+                {
+                    output.unmatched(*first1);
+
+                    ++first1;
+                }
+                else if (*first2 < *first1)
+                {
+                    ++first2;
+                }
+                else
+                {
+                    output.matched(*first1);
+
+                    ++first1;
+
+                    //Skip common value in set 2.
+                    ++first2;
+                }
+            }
+        }
+
+        output.unmatched(first1, last1);
+    }
+
+    /**
+     *  Compute the number of vertices which are found in both of the given sorted sets.
+     *
+     *  @param[in] set1 The first set of vertices, sorted in ascending order.
+     *  @param[in] set2 The second set of vertices, sorted in ascending order.
+     *
+     *  @return The number of vertices which are found in both of the given sorted sets.
+     */
+    static std::size_t intersectionSize(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+    {
+        htd::IntersectionSizeOutput output;
+
+        if (set2.size() * GALLOPING_THRESHOLD <= set1.size())
+        {
+            processSortedSets(set2.data(), set2.data() + set2.size(), set1.data(), set1.data() + set1.size(), output);
+        }
+        else
+        {
+            processSortedSets(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size(), output);
+        }
+
+        return output.count;
+    }
+}
+
 htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
     htd::LibraryInstance * ret = new htd::LibraryInstance(id);
@@ -36,6 +625,34 @@ htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
     return ret;
 }
 
+std::size_t htd::randomNumber(void)
+{
+    htd::ThreadLocalRandomNumberGenerator & randomNumberGenerator = htd::threadLocalRandomNumberGenerator();
+
+    if (randomNumberGenerator.enabled)
+    {
+        return static_cast<std::size_t>(randomNumberGenerator.generator());
+    }
+
+    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
+    // coverity[dont_call]
+    return static_cast<std::size_t>(std::rand());
+}
+
+void htd::setThreadLocalRandomSeed(unsigned int seed)
+{
+    htd::ThreadLocalRandomNumberGenerator & randomNumberGenerator = htd::threadLocalRandomNumberGenerator();
+
+    randomNumberGenerator.generator.seed(seed);
+
+    randomNumberGenerator.enabled = true;
+}
+
+void htd::resetThreadLocalRandomSeed(void)
+{
+    htd::threadLocalRandomNumberGenerator().enabled = false;
+}
+
 void htd::print(bool input)
 {
     print(input, std::cout);
@@ -82,6 +699,38 @@ void htd::set_union(const std::vector<htd::vertex_t> & set1,
                     htd::vertex_t ignoredVertex,
                     std::vector<htd::vertex_t> & result)
 {
+    if (set1.size() * htd::GALLOPING_THRESHOLD <= set2.size() || set2.size() * htd::GALLOPING_THRESHOLD <= set1.size())
+    {
+        const std::vector<htd::vertex_t> & smallerSet = set1.size() <= set2.size() ? set1 : set2;
+        const std::vector<htd::vertex_t> & largerSet = set1.size() <= set2.size() ? set2 : set1;
+
+        const htd::vertex_t * position = largerSet.data();
+        const htd::vertex_t * last = largerSet.data() + largerSet.size();
+
+        for (htd::vertex_t vertex : smallerSet)
+        {
+            const htd::vertex_t * next = htd::gallop(position, last, vertex);
+
+            htd::appendRange(position, next, ignoredVertex, result);
+
+            if (vertex != ignoredVertex)
+            {
+                result.push_back(vertex);
+            }
+
+            position = next;
+
+            if (position != last && *position == vertex)
+            {
+                ++position;
+            }
+        }
+
+        htd::appendRange(position, last, ignoredVertex, result);
+
+        return;
+    }
+
     auto first1 = set1.begin();
     auto first2 = set2.begin();
 
@@ -150,109 +799,37 @@ void htd::set_difference(const std::vector<htd::vertex_t> & set1,
                          const std::vector<htd::vertex_t> & set2,
                          std::vector<htd::vertex_t> & result)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    htd::DifferenceOutput output(result);
 
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            result.push_back(*first1);
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            ++first2;
-        }
-        else
-        {
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
-
-    result.insert(result.end(), first1, last1);
+    htd::processSortedSets(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size(), output);
 }
 
 void htd::set_intersection(const std::vector<htd::vertex_t> & set1,
                            const std::vector<htd::vertex_t> & set2,
                            std::vector<htd::vertex_t> & result)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    htd::IntersectionOutput output(result);
 
-    while (first1 != last1 && first2 != last2)
+    if (set2.size() * htd::GALLOPING_THRESHOLD <= set1.size())
     {
-        if (*first1 < *first2)
-        {
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            ++first2;
-        }
-        else
-        {
-            result.push_back(*first1);
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
+        htd::processSortedSets(set2.data(), set2.data() + set2.size(), set1.data(), set1.data() + set1.size(), output);
+    }
+    else
+    {
+        htd::processSortedSets(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size(), output);
     }
 }
 
-std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+std::size_t htd::set_intersection_size(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
-    std::size_t overlap = 0;
-
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
-
-            ++first2;
-        }
-        else
-        {
-            overlap++;
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
+    return htd::intersectionSize(set1, set2);
+}
 
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+{
+    std::size_t overlap = htd::intersectionSize(set1, set2);
 
-    return std::tuple<std::size_t, std::size_t, std::size_t>(onlySet1, overlap, onlySet2);
+    return std::tuple<std::size_t, std::size_t, std::size_t>(set1.size() - overlap, overlap, set2.size() - overlap);
 }
 
 void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
@@ -304,42 +881,9 @@ void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
 
 std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
-
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
-
-            ++first2;
-        }
-        else
-        {
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
-
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+    std::size_t overlap = htd::intersectionSize(set1, set2);
 
-    return std::pair<std::size_t, std::size_t>(onlySet1, onlySet2);
+    return std::pair<std::size_t, std::size_t>(set1.size() - overlap, set2.size() - overlap);
 }
 
 std::vector<htd::vertex_t> * htd::computeJoinVertices(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex)
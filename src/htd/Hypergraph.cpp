@@ -162,6 +162,13 @@ void htd::Hypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::ver
     base_->copyNeighborsTo(vertex, target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Hypergraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return base_->neighborSpan(vertex, buffer);
+}
+
 htd::vertex_t htd::Hypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return base_->neighborAtPosition(vertex, index);
@@ -177,6 +184,11 @@ void htd::Hypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
     base_->copyVerticesTo(target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Hypergraph::vertexSpan(void) const
+{
+    return base_->vertexSpan();
+}
+
 htd::vertex_t htd::Hypergraph::vertexAtPosition(htd::index_t index) const
 {
     return base_->vertexAtPosition(index);
@@ -0,0 +1,108 @@
+/*
+ * File:   IMaxFlowAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_IMAXFLOWALGORITHM_CPP
+#define HTD_HTD_IMAXFLOWALGORITHM_CPP
+
+#include <htd/IMaxFlowAlgorithm.hpp>
+
+#include <htd/ResidualNetwork.hpp>
+
+#include <algorithm>
+#include <vector>
+
+std::size_t htd::IMaxFlowAlgorithm::augmentAlongShortestPaths(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const
+{
+    HTD_ASSERT(source < residualNetwork.vertexCount() && target < residualNetwork.vertexCount())
+
+    std::size_t ret = 0;
+
+    const htd::LibraryInstance * manager = managementInstance();
+
+    std::vector<char> & visited = residualNetwork.marks();
+
+    std::vector<htd::vertex_t> & queue = residualNetwork.vertexQueue();
+
+    /* The arc over which each vertex was reached by the current search. */
+    std::vector<htd::index_t> & predecessorArcs = residualNetwork.currentArcs();
+
+    residualNetwork.reset(residualNetwork.computeCapacityBound(source, target));
+
+    bool augmentingPathFound = source != target;
+
+    while (augmentingPathFound && ret < flowLimit && (manager == nullptr || !manager->isTerminated()))
+    {
+        std::fill(visited.begin(), visited.end(), 0);
+
+        visited[source] = 1;
+
+        queue[0] = source;
+
+        std::size_t queueSize = 1;
+
+        for (htd::index_t queueIndex = 0; queueIndex < queueSize && visited[target] == 0; ++queueIndex)
+        {
+            htd::vertex_t vertex = queue[queueIndex];
+
+            for (htd::index_t arc = residualNetwork.firstArc(vertex); arc < residualNetwork.endArc(vertex); ++arc)
+            {
+                htd::vertex_t next = residualNetwork.arcTarget(arc);
+
+                if (visited[next] == 0 && residualNetwork.residualCapacity(arc) > 0)
+                {
+                    visited[next] = 1;
+
+                    predecessorArcs[next] = arc;
+
+                    queue[queueSize] = next;
+
+                    ++queueSize;
+                }
+            }
+        }
+
+        augmentingPathFound = visited[target] != 0;
+
+        if (augmentingPathFound)
+        {
+            std::size_t amount = flowLimit - ret;
+
+            for (htd::vertex_t vertex = target; vertex != source; vertex = residualNetwork.arcTarget(residualNetwork.oppositeArc(predecessorArcs[vertex])))
+            {
+                amount = std::min(amount, residualNetwork.residualCapacity(predecessorArcs[vertex]));
+            }
+
+            for (htd::vertex_t vertex = target; vertex != source; vertex = residualNetwork.arcTarget(residualNetwork.oppositeArc(predecessorArcs[vertex])))
+            {
+                residualNetwork.push(predecessorArcs[vertex], amount);
+            }
+
+            ret += amount;
+        }
+    }
+
+    return ret;
+}
+
+#endif /* HTD_HTD_IMAXFLOWALGORITHM_CPP */
@@ -119,7 +119,7 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 
         if (decomposition.childCount(vertex) > 0)
         {
-            for (htd::vertex_t child : decomposition.children(vertex))
+            for (htd::vertex_t child : decomposition.childSpan(vertex))
             {
                 std::vector<htd::vertex_t> forgottenVertices;
 
@@ -265,7 +265,7 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 
         if (decomposition.childCount(vertex) > 0)
         {
-            for (htd::vertex_t child : decomposition.children(vertex))
+            for (htd::vertex_t child : decomposition.childSpan(vertex))
             {
                 std::vector<htd::vertex_t> forgottenVertices;
 
@@ -27,10 +27,16 @@
 
 #include <htd/IterativeImprovementTreeDecompositionAlgorithm.hpp>
 
+#include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/ParallelExecution.hpp>
 
+#include <condition_variable>
 #include <cstdarg>
+#include <map>
+#include <mutex>
 
 /**
  *  Private implementation details of class htd::IterativeImprovementTreeDecompositionAlgorithm.
@@ -45,7 +51,7 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @param[in] fitnessFunction  The fitness function which will be used to evaluate the constructed tree decompositions.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction)
-        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
+        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1), widthOnlyEvaluationEnabled_(false), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
     {
 
     }
@@ -82,6 +88,16 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of threads which are used to perform the iterations of the algorithm.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  A boolean flag indicating whether the candidate decompositions are evaluated by their maximum bag size before they are post-processed.
+     */
+    bool widthOnlyEvaluationEnabled_;
+
     /**
      *  The decomposition algorithm which will be called repeatedly.
      */
@@ -102,6 +118,39 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
 
+    /**
+     *  The result of a single iteration of the algorithm.
+     */
+    struct IterationResult
+    {
+        /**
+         *  Constructor for the IterationResult data structure.
+         *
+         *  @param[in] decomposition    The decomposition computed in the iteration.
+         *  @param[in] evaluation       The fitness evaluation of the decomposition.
+         *  @param[in] maxBagSize       The maximum bag size of the decomposition before the manipulation operations were applied.
+         */
+        IterationResult(htd::IMutableTreeDecomposition * decomposition, htd::FitnessEvaluation * evaluation, std::size_t maxBagSize) : decomposition(decomposition), evaluation(evaluation), maxBagSize(maxBagSize)
+        {
+
+        }
+
+        /**
+         *  The decomposition computed in the iteration or nullptr if no (improving) decomposition was found.
+         */
+        htd::IMutableTreeDecomposition * decomposition;
+
+        /**
+         *  The fitness evaluation of the decomposition or nullptr if the decomposition was not evaluated.
+         */
+        htd::FitnessEvaluation * evaluation;
+
+        /**
+         *  The maximum bag size of the decomposition before the manipulation operations were applied.
+         */
+        std::size_t maxBagSize;
+    };
+
     /**
      *  Compute a new mutable tree decompostion of the given graph.
      *
@@ -110,6 +159,56 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @return A mutable tree decompostion of the given graph.
      */
     htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Compute a new candidate decomposition of the given graph.
+     *
+     *  @param[in] algorithm            The instance of the base decomposition algorithm which shall be used.
+     *  @param[in] graph                The input graph to decompose.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] bestMaxBagSize       The maximum bag size of the best decomposition found so far or 0 if no decomposition was found so far.
+     *
+     *  @return The new candidate decomposition or nullptr if the width-only evaluation is enabled and the maximum bag size of the candidate is not smaller than bestMaxBagSize.
+     */
+    htd::IMutableTreeDecomposition * computeCandidateDecomposition(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                                   const htd::IMultiHypergraph & graph,
+                                                                   const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                   std::size_t bestMaxBagSize) const;
+
+    /**
+     *  Apply the given manipulation operations and labeling functions to a decomposition. The manipulation operations are
+     *  applied first, both in the given order.
+     *
+     *  @param[in] graph                    The graph which was decomposed.
+     *  @param[in] decomposition            The decomposition which shall be modified.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied.
+     */
+    static void applyManipulationOperations(const htd::IMultiHypergraph & graph,
+                                            htd::IMutableTreeDecomposition & decomposition,
+                                            const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                            const std::vector<htd::ILabelingFunction *> & labelingFunctions);
+
+    /**
+     *  Perform the iterations of the algorithm using a pool of worker threads.
+     *
+     *  Iteration i is always computed with the seed baseSeed + i, where baseSeed is drawn via htd::randomNumber() by
+     *  the calling thread, and the results are evaluated in the order of the iterations. Hence, for a fixed seed, the
+     *  result does not depend on the number of threads, which is why a single thread uses a worker thread as well.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied to each decomposition. Each worker thread uses its own clones.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied to each decomposition. Each worker thread uses its own clones.
+     *  @param[in] progressCallback         A callback function which is invoked, in the order of the iterations, for each decomposition generated by the algorithm.
+     *
+     *  @return The best decomposition found or nullptr if no decomposition was found before the algorithm was interrupted.
+     */
+    htd::ITreeDecomposition * performIterations(const htd::IMultiHypergraph & graph,
+                                                const htd::IPreprocessedGraph & preprocessedGraph,
+                                                const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const;
 };
 
 htd::IterativeImprovementTreeDecompositionAlgorithm::IterativeImprovementTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction) : implementation_(new Implementation(manager, algorithm, fitnessFunction))
@@ -186,9 +285,9 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
                                                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
-    std::vector<htd::ILabelingFunction *> labelingFunctions;
+    std::vector<htd::ILabelingFunction *> labelingFunctions(implementation_->labelingFunctions_);
 
-    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations(implementation_->postProcessingOperations_);
 
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
     {
@@ -207,155 +306,323 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         }
     }
 
+    htd::ITreeDecomposition * ret = implementation_->performIterations(graph, preprocessedGraph, postProcessingOperations, labelingFunctions, progressCallback);
+
+    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        delete operation;
+    }
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::applyManipulationOperations(const htd::IMultiHypergraph & graph,
+                                                                                                       htd::IMutableTreeDecomposition & decomposition,
+                                                                                                       const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                                                                       const std::vector<htd::ILabelingFunction *> & labelingFunctions)
+{
+    for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+    {
+        operation->apply(graph, decomposition);
+    }
+
+    for (const htd::ILabelingFunction * labelingFunction : labelingFunctions)
+    {
+        for (htd::vertex_t vertex : decomposition.vertices())
+        {
+            htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
+
+            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+
+            delete labelCollection;
+
+            decomposition.setVertexLabel(labelingFunction->name(), vertex, newLabel);
+        }
+    }
+}
+
+htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::performIterations(const htd::IMultiHypergraph & graph,
+                                                                                                                  const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                  const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                                                                                  const std::vector<htd::ILabelingFunction *> & labelingFunctions,
+                                                                                                                  const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
     htd::ITreeDecomposition * ret = nullptr;
 
     htd::FitnessEvaluation * bestEvaluation = nullptr;
 
     std::size_t nonImprovementCount = 0;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    std::size_t bestMaxBagSize = 0;
+
+    /* Iteration i is always computed with seed baseSeed + i, regardless of the thread which executes it. */
+    std::size_t baseSeed = htd::randomNumber();
+
+    htd::index_t nextIteration = 0;
+
+    htd::index_t nextEvaluatedIteration = 0;
 
-    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    bool finished = false;
+
+    /* The results of the iterations which finished before all of their predecessors were evaluated. */
+    std::map<htd::index_t, IterationResult> pendingResults;
+
+    /* Bound the number of pending results in case that a single iteration takes considerably longer than the others. */
+    std::size_t maximumLookahead = 2 * threadCount_;
+
+    std::mutex mutex;
+
+    std::condition_variable condition;
+
+    auto evaluateResult = [&](const IterationResult & result)
     {
-        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
+        htd::IMutableTreeDecomposition * currentDecomposition = result.decomposition;
+
+        htd::FitnessEvaluation * currentEvaluation = result.evaluation;
+
+        if (currentDecomposition == nullptr)
+        {
+            ++nonImprovementCount;
+        }
+        else if (currentEvaluation == nullptr || managementInstance.isTerminated())
+        {
+            delete currentDecomposition;
+
+            delete currentEvaluation;
+        }
+        else if (widthOnlyEvaluationEnabled_ && bestMaxBagSize > 0 && result.maxBagSize >= bestMaxBagSize)
+        {
+            /* The iteration was scheduled before the best decomposition of one of its predecessors was evaluated. */
+            delete currentDecomposition;
 
-        if (currentDecomposition != nullptr)
+            delete currentEvaluation;
+
+            ++nonImprovementCount;
+        }
+        else
         {
-            for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
+            progressCallback(graph, *currentDecomposition, *currentEvaluation);
+
+            if (ret == nullptr || *currentEvaluation > *bestEvaluation)
             {
-                operation->apply(graph, *currentDecomposition);
-            }
+                delete ret;
+
+                delete bestEvaluation;
 
-            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+                ret = currentDecomposition;
+
+                bestEvaluation = currentEvaluation;
+
+                bestMaxBagSize = result.maxBagSize;
+
+                nonImprovementCount = 0;
+            }
+            else
             {
-                operation->apply(graph, *currentDecomposition);
+                delete currentDecomposition;
+
+                delete currentEvaluation;
+
+                ++nonImprovementCount;
             }
+        }
+    };
 
-            for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+    auto worker = [&](htd::index_t workerIndex)
+    {
+        HTD_UNUSED(workerIndex)
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+        std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
 
-                    delete labelCollection;
+        std::unique_ptr<htd::ITreeDecompositionFitnessFunction> fitnessFunction(fitnessFunction_->clone());
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+        std::vector<htd::ITreeDecompositionManipulationOperation *> localPostProcessingOperations;
 
-            for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+        std::vector<htd::ILabelingFunction *> localLabelingFunctions;
+
+        for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : postProcessingOperations)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            localPostProcessingOperations.push_back(postProcessingOperation->clone());
+#else
+            localPostProcessingOperations.push_back(postProcessingOperation->cloneTreeDecompositionManipulationOperation());
+#endif
+        }
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+        for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            localLabelingFunctions.push_back(labelingFunction->clone());
+#else
+            localLabelingFunctions.push_back(labelingFunction->cloneLabelingFunction());
+#endif
+        }
 
-                    delete labelCollection;
+        std::unique_lock<std::mutex> lock(mutex);
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
+        while (true)
+        {
+            condition.wait(lock, [&]{ return finished || nextIteration < nextEvaluatedIteration + maximumLookahead; });
+
+            if (finished || (iterationCount_ != 0 && nextIteration >= iterationCount_) || managementInstance.isTerminated())
+            {
+                break;
             }
 
-            if (!managementInstance.isTerminated())
+            htd::index_t iteration = nextIteration;
+
+            /* The bound may be weaker than the one at evaluation time, hence evaluateResult re-checks it to obtain reproducible results. */
+            std::size_t currentBestMaxBagSize = bestMaxBagSize;
+
+            ++nextIteration;
+
+            lock.unlock();
+
+            htd::setThreadLocalRandomSeed(static_cast<unsigned int>(baseSeed + iteration));
+
+            htd::IMutableTreeDecomposition * currentDecomposition = computeCandidateDecomposition(*algorithm, graph, preprocessedGraph, currentBestMaxBagSize);
+
+            htd::FitnessEvaluation * currentEvaluation = nullptr;
+
+            std::size_t currentMaxBagSize = 0;
+
+            if (currentDecomposition != nullptr)
             {
-                htd::FitnessEvaluation * currentEvaluation = implementation_->fitnessFunction_->fitness(graph, *currentDecomposition);
+                currentMaxBagSize = currentDecomposition->maximumBagSize();
+
+                applyManipulationOperations(graph, *currentDecomposition, localPostProcessingOperations, localLabelingFunctions);
 
                 if (!managementInstance.isTerminated())
                 {
-                    progressCallback(graph, *currentDecomposition, *currentEvaluation);
+                    currentEvaluation = fitnessFunction->fitness(graph, *currentDecomposition);
+                }
+            }
 
-                    if (iteration == 0 || *currentEvaluation > *bestEvaluation)
-                    {
-                        if (iteration > 0)
-                        {
-                            delete ret;
+            lock.lock();
 
-                            delete bestEvaluation;
-                        }
+            pendingResults.emplace(iteration, IterationResult(currentDecomposition, currentEvaluation, currentMaxBagSize));
 
-                        ret = currentDecomposition;
+            /* Evaluate the results strictly in the order of the iterations to ensure reproducible results. */
+            for (auto position = pendingResults.find(nextEvaluatedIteration); !finished && position != pendingResults.end(); position = pendingResults.find(nextEvaluatedIteration))
+            {
+                IterationResult result = position->second;
 
-                        bestEvaluation = currentEvaluation;
+                pendingResults.erase(position);
 
-                        nonImprovementCount = 0;
-                    }
-                    else
-                    {
-                        delete currentDecomposition;
+                ++nextEvaluatedIteration;
 
-                        delete currentEvaluation;
+                evaluateResult(result);
 
-                        ++nonImprovementCount;
-                    }
-                }
-                else
+                if (nonImprovementCount > nonImprovementLimit_ || (iterationCount_ != 0 && nextEvaluatedIteration >= iterationCount_) || managementInstance.isTerminated())
                 {
-                    delete currentDecomposition;
-
-                    delete currentEvaluation;
+                    finished = true;
                 }
             }
-            else
-            {
-                delete currentDecomposition;
-            }
-        }
-        else
-        {
-            ++nonImprovementCount;
-        }
-    }
 
-    for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
-    {
-        delete operation;
-    }
+            condition.notify_all();
+        }
 
-    if (bestEvaluation != nullptr)
-    {
-        delete bestEvaluation;
-    }
+        condition.notify_all();
 
-    return ret;
-}
+        lock.unlock();
 
-htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
-{
-    va_list arguments;
+        for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : localPostProcessingOperations)
+        {
+            delete postProcessingOperation;
+        }
 
-    va_start(arguments, manipulationOperationCount);
+        for (htd::ILabelingFunction * labelingFunction : localLabelingFunctions)
+        {
+            delete labelingFunction;
+        }
+    };
 
-    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+    htd::executeWorkers(threadCount_, worker);
 
-    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    for (auto & pendingResult : pendingResults)
     {
-        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+        delete pendingResult.second.decomposition;
+
+        delete pendingResult.second.evaluation;
     }
 
-    va_end(arguments);
+    delete bestEvaluation;
 
-    return computeDecomposition(graph, manipulationOperations);
+    return ret;
 }
 
-htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+htd::IMutableTreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::computeCandidateDecomposition(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                                                                                                   const htd::IMultiHypergraph & graph,
+                                                                                                                                   const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                                   std::size_t bestMaxBagSize) const
 {
-    va_list arguments;
+    htd::ITreeDecomposition * ret = nullptr;
 
-    va_start(arguments, manipulationOperationCount);
+    if (widthOnlyEvaluationEnabled_ && bestMaxBagSize > 0)
+    {
+        const htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationAlgorithm = dynamic_cast<const htd::BucketEliminationTreeDecompositionAlgorithm *>(&algorithm);
 
-    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+        if (bucketEliminationAlgorithm != nullptr)
+        {
+            /* A single attempt with the width-limited ordering suffices, non-improving orderings are never turned into decompositions. */
+            ret = bucketEliminationAlgorithm->computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>(), bestMaxBagSize - 1, 1).first;
+        }
+        else
+        {
+            ret = algorithm.computeDecomposition(graph, preprocessedGraph);
 
-    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+            if (ret != nullptr && ret->maximumBagSize() >= bestMaxBagSize)
+            {
+                delete ret;
+
+                ret = nullptr;
+            }
+        }
+    }
+    else
     {
-        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+        ret = algorithm.computeDecomposition(graph, preprocessedGraph);
     }
 
-    va_end(arguments);
-
-    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+    return dynamic_cast<htd::IMutableTreeDecomposition *>(ret);
 }
 
 void htd::IterativeImprovementTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
@@ -437,6 +704,28 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setNonImprovementLimit
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::IterativeImprovementTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
+bool htd::IterativeImprovementTreeDecompositionAlgorithm::isWidthOnlyEvaluationEnabled(void) const
+{
+    return implementation_->widthOnlyEvaluationEnabled_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setWidthOnlyEvaluationEnabled(bool widthOnlyEvaluationEnabled)
+{
+    implementation_->widthOnlyEvaluationEnabled_ = widthOnlyEvaluationEnabled;
+}
+
 const htd::LibraryInstance * htd::IterativeImprovementTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -473,6 +762,8 @@ htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementT
 
     ret->setIterationCount(implementation_->iterationCount_);
     ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
+    ret->setWidthOnlyEvaluationEnabled(implementation_->widthOnlyEvaluationEnabled_);
 
     return ret;
 }
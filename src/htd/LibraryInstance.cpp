@@ -27,6 +27,8 @@
 
 #include <htd/LibraryInstance.hpp>
 
+#include <htd/CancellationToken.hpp>
+
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/DirectedGraphFactory.hpp>
 #include <htd/DirectedMultiGraphFactory.hpp>
@@ -56,6 +58,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 
+#include <atomic>
 #include <csignal>
 
 /**
@@ -130,8 +133,10 @@ struct htd::LibraryInstance::Implementation
 
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
+     *
+     *  @note The flag is atomic because it is polled by worker threads of parallel algorithms.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
@@ -296,7 +301,7 @@ htd::id_t htd::LibraryInstance::id(void) const
 
 bool htd::LibraryInstance::isTerminated(void) const
 {
-    return implementation_->terminated_;
+    return implementation_->terminated_.load(std::memory_order_relaxed) || htd::CancellationToken::isCurrentCancelled();
 }
 
 void htd::LibraryInstance::terminate(void)
@@ -31,10 +31,9 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::MaximumCardinalitySearchOrderingAlgorithm.
@@ -46,7 +45,7 @@ struct htd::MaximumCardinalitySearchOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), randomTieBreakingEnabled_(true)
     {
 
     }
@@ -60,6 +59,37 @@ struct htd::MaximumCardinalitySearchOrderingAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  A boolean flag indicating whether ties between vertices of maximum cardinality shall be broken randomly.
+     */
+    bool randomTieBreakingEnabled_;
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+
+    /**
+     *  Compute the maximum bag size of the decomposition which is obtained via bucket elimination using the given graph and elimination ordering.
+     *
+     *  The bag sizes are the column counts of the Cholesky factor of the graph, which are computed without constructing the
+     *  triangulation from the elimination tree and the row subtrees of the vertices (Gilbert, Ng and Peyton, 1994). Hence,
+     *  the running time is almost linear in the size of the graph, regardless of the number of fill edges.
+     *
+     *  @param[in] offsets              The offsets of the neighborhoods within the vector of neighbors. The vector contains one entry more than there are vertices.
+     *  @param[in] neighbors            The neighborhoods of all vertices, each vertex given by its index.
+     *  @param[in] eliminationOrdering  The indices of all vertices in the order of their elimination.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the given graph and elimination ordering.
+     */
+    std::size_t computeMaximumBagSize(const std::vector<htd::index_t> & offsets, const std::vector<htd::index_t> & neighbors, const std::vector<htd::index_t> & eliminationOrdering) const;
 };
 
 htd::MaximumCardinalitySearchOrderingAlgorithm::MaximumCardinalitySearchOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -73,12 +103,17 @@ htd::MaximumCardinalitySearchOrderingAlgorithm::~MaximumCardinalitySearchOrderin
 }
 
 htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
 
-    htd::IVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph);
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
 
     delete preprocessedGraph;
     delete preprocessor;
@@ -88,69 +123,413 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
 htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
 {
-    HTD_UNUSED(graph)
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
 
-    std::size_t size = preprocessedGraph.remainingVertices().size();
+htd::IWidthLimitedVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(graph.vertexCount());
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    std::size_t iterations = 0;
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    std::size_t currentMaxBagSize = (std::size_t)-1;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
+    do
+    {
+        ordering.clear();
 
-    std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
 
-    std::vector<htd::vertex_t> ordering;
-    ordering.reserve(preprocessedGraph.vertexCount());
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+bool htd::MaximumCardinalitySearchOrderingAlgorithm::isRandomTieBreakingEnabled(void) const
+{
+    return implementation_->randomTieBreakingEnabled_;
+}
+
+void htd::MaximumCardinalitySearchOrderingAlgorithm::setRandomTieBreakingEnabled(bool randomTieBreakingEnabled)
+{
+    implementation_->randomTieBreakingEnabled_ = randomTieBreakingEnabled;
+}
+
+std::size_t htd::MaximumCardinalitySearchOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::size_t size = remainingVertices.size();
+
+    std::size_t ret = preprocessedGraph.minTreeWidth() + 1;
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    std::vector<htd::index_t> indices(preprocessedGraph.inputGraphVertexCount(), (htd::index_t)-1);
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        indices[remainingVertices[index]] = index;
+    }
+
+    std::vector<htd::index_t> offsets(1, 0);
+
+    std::vector<htd::index_t> neighbors;
+
+    offsets.reserve(size + 1);
+
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+        {
+            htd::index_t index = indices[neighbor];
+
+            if (index != (htd::index_t)-1 && neighbor != vertex)
+            {
+                neighbors.push_back(index);
+            }
+        }
+
+        offsets.push_back(neighbors.size());
+    }
+
+    /*
+     *  The unnumbered vertices are stored in ascending order of their cardinality, i.e., each bucket of vertices with the same
+     *  cardinality forms a contiguous range of the vector 'bucketedVertices' which starts at position 'bucketBegin[cardinality]'.
+     *  Incrementing the cardinality of a vertex swaps it with the last vertex of its bucket and moves the boundary to the next
+     *  bucket by one position, numbering a vertex swaps it with the last unnumbered vertex. Hence, each update takes constant
+     *  time and a vertex of maximum cardinality can be drawn uniformly at random from the last non-empty bucket.
+     */
+    std::vector<htd::index_t> bucketedVertices(size);
+
+    std::vector<htd::index_t> positions(size);
+
+    std::vector<htd::index_t> bucketBegin(size + 2, 0);
+
+    std::vector<std::size_t> cardinalities(size, 0);
+
+    std::vector<bool> numbered(size, false);
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        bucketedVertices[index] = index;
+
+        positions[index] = index;
+    }
+
+    /* The range of unnumbered vertices ends at position 'bucketBegin[maxCardinality + 1]'. */
+    std::size_t unnumberedVertexCount = size;
+
+    std::size_t maxCardinality = 0;
+
+    bucketBegin[1] = size;
+
+    std::vector<htd::index_t> sequence;
+
+    sequence.reserve(size);
+
+    while (unnumberedVertexCount > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::index_t selectedPosition = bucketBegin[maxCardinality];
+
+        if (randomTieBreakingEnabled_)
+        {
+            selectedPosition += static_cast<htd::index_t>(htd::randomNumber() % (unnumberedVertexCount - bucketBegin[maxCardinality]));
+        }
+
+        htd::index_t selectedVertex = bucketedVertices[selectedPosition];
+
+        htd::index_t lastVertex = bucketedVertices[unnumberedVertexCount - 1];
+
+        bucketedVertices[selectedPosition] = lastVertex;
+
+        positions[lastVertex] = selectedPosition;
+
+        --unnumberedVertexCount;
+
+        numbered[selectedVertex] = true;
+
+        sequence.push_back(selectedVertex);
+
+        /* The numbered neighbors of a vertex remain in its bag when it is eliminated, i.e., its cardinality is a lower bound for the bag size. */
+        if (cardinalities[selectedVertex] + 1 > ret)
+        {
+            ret = cardinalities[selectedVertex] + 1;
+        }
+
+        while (maxCardinality > 0 && bucketBegin[maxCardinality] == unnumberedVertexCount)
+        {
+            --maxCardinality;
+        }
+
+        bucketBegin[maxCardinality + 1] = unnumberedVertexCount;
+
+        for (htd::index_t position = offsets[selectedVertex]; position < offsets[selectedVertex + 1]; ++position)
+        {
+            htd::index_t neighbor = neighbors[position];
+
+            if (!numbered[neighbor])
+            {
+                std::size_t & cardinality = cardinalities[neighbor];
+
+                if (cardinality == maxCardinality)
+                {
+                    bucketBegin[maxCardinality + 2] = unnumberedVertexCount;
+
+                    ++maxCardinality;
+                }
+
+                htd::index_t & boundary = bucketBegin[cardinality + 1];
 
-    ordering.insert(ordering.end(),
-                    preprocessedGraph.eliminationSequence().begin(),
-                    preprocessedGraph.eliminationSequence().end());
+                --boundary;
 
-    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+                htd::index_t swappedVertex = bucketedVertices[boundary];
+
+                bucketedVertices[positions[neighbor]] = swappedVertex;
+
+                positions[swappedVertex] = positions[neighbor];
+
+                bucketedVertices[boundary] = neighbor;
+
+                positions[neighbor] = boundary;
+
+                ++cardinality;
+            }
+        }
+    }
+
+    std::vector<htd::index_t> eliminationOrdering(sequence.rbegin(), sequence.rend());
+
+    if (unnumberedVertexCount == 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        ret = std::max(ret, computeMaximumBagSize(offsets, neighbors, eliminationOrdering));
+    }
+
+    for (htd::index_t vertex : eliminationOrdering)
     {
-        priorityQueue.push(vertex, 0);
+        target.push_back(preprocessedGraph.vertexName(remainingVertices[vertex]));
     }
 
-    while (size > 0 && !managementInstance.isTerminated())
+    return ret;
+}
+
+std::size_t htd::MaximumCardinalitySearchOrderingAlgorithm::Implementation::computeMaximumBagSize(const std::vector<htd::index_t> & offsets, const std::vector<htd::index_t> & neighbors, const std::vector<htd::index_t> & eliminationOrdering) const
+{
+    const htd::index_t UNKNOWN = (htd::index_t)-1;
+
+    std::size_t size = eliminationOrdering.size();
+
+    std::vector<htd::index_t> ranks(size);
+
+    for (htd::index_t rank = 0; rank < size; ++rank)
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        ranks[eliminationOrdering[rank]] = rank;
+    }
+
+    /* Compute the elimination tree, i.e., the parent of each vertex is the first vertex of its bag eliminated after it. */
+    std::vector<htd::index_t> parents(size, UNKNOWN);
 
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+    std::vector<htd::index_t> ancestors(size, UNKNOWN);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        htd::index_t vertex = eliminationOrdering[rank];
 
-        for (htd::vertex_t neighbor : selectedNeighborhood)
+        for (htd::index_t position = offsets[vertex]; position < offsets[vertex + 1]; ++position)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+            htd::index_t current = ranks[neighbors[position]];
+
+            while (current != UNKNOWN && current < rank)
+            {
+                htd::index_t next = ancestors[current];
+
+                ancestors[current] = rank;
 
-            /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
-            // coverity[use_iterator]
-            currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+                if (next == UNKNOWN)
+                {
+                    parents[current] = rank;
+                }
 
-            std::size_t & currentWeight = weights[neighbor];
+                current = next;
+            }
+        }
+    }
+
+    /* Compute a post-order of the elimination tree. The children of each vertex are stored contiguously, sorted by rank. */
+    std::vector<htd::index_t> childOffsets(size + 2, 0);
+
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        if (parents[rank] != UNKNOWN)
+        {
+            ++childOffsets[parents[rank] + 2];
+        }
+    }
+
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        childOffsets[rank + 2] += childOffsets[rank + 1];
+    }
 
-            priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
+    std::vector<htd::index_t> children(size);
 
-            ++currentWeight;
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        if (parents[rank] != UNKNOWN)
+        {
+            children[childOffsets[parents[rank] + 1]++] = rank;
         }
+    }
+
+    /* The position of the next unvisited child of each vertex. */
+    std::vector<htd::index_t> nextChild(size);
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
+    std::copy(childOffsets.begin(), childOffsets.begin() + size, nextChild.begin());
 
-        vertices.erase(selectedVertex);
+    std::vector<htd::index_t> postOrder;
 
-        --size;
+    postOrder.reserve(size);
 
-        ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
+    std::vector<htd::index_t> stack;
+
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        if (parents[rank] == UNKNOWN)
+        {
+            stack.push_back(rank);
+
+            while (!stack.empty())
+            {
+                htd::index_t current = stack.back();
+
+                if (nextChild[current] == childOffsets[current + 1])
+                {
+                    stack.pop_back();
+
+                    postOrder.push_back(current);
+                }
+                else
+                {
+                    stack.push_back(children[nextChild[current]++]);
+                }
+            }
+        }
     }
 
-    std::reverse(ordering.begin() + preprocessedGraph.eliminationSequence().size(), ordering.end());
+    /*
+     *  The bag size of a vertex j is the number of vertices of the subtree of the elimination tree rooted at j whose row
+     *  subtree contains j. It is computed as sum of the differences 'delta' over the subtree, where the differences count the
+     *  leaves of the row subtrees and subtract the least common ancestors of consecutive leaves (in post-order).
+     */
+    std::vector<htd::index_t> first(size, UNKNOWN);
+
+    std::vector<std::size_t> delta(size, 0);
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        htd::index_t current = postOrder[index];
+
+        delta[current] = first[current] == UNKNOWN ? 1 : 0;
 
-    return new htd::VertexOrdering(std::move(ordering), 1);
+        while (current != UNKNOWN && first[current] == UNKNOWN)
+        {
+            first[current] = index;
+
+            current = parents[current];
+        }
+    }
+
+    std::vector<htd::index_t> maxFirst(size, UNKNOWN);
+
+    std::vector<htd::index_t> previousLeaf(size, UNKNOWN);
+
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        ancestors[rank] = rank;
+    }
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        htd::index_t current = postOrder[index];
+
+        htd::index_t vertex = eliminationOrdering[current];
+
+        if (parents[current] != UNKNOWN)
+        {
+            --delta[parents[current]];
+        }
+
+        for (htd::index_t position = offsets[vertex]; position < offsets[vertex + 1]; ++position)
+        {
+            htd::index_t neighbor = ranks[neighbors[position]];
+
+            /* The vertex 'current' is a leaf of the row subtree of 'neighbor' if it is not a descendant of the previous leaf. */
+            if (neighbor > current && (maxFirst[neighbor] == UNKNOWN || first[current] > maxFirst[neighbor]))
+            {
+                maxFirst[neighbor] = first[current];
+
+                htd::index_t previous = previousLeaf[neighbor];
+
+                previousLeaf[neighbor] = current;
+
+                ++delta[current];
+
+                if (previous != UNKNOWN)
+                {
+                    htd::index_t root = previous;
+
+                    while (root != ancestors[root])
+                    {
+                        root = ancestors[root];
+                    }
+
+                    while (previous != root)
+                    {
+                        htd::index_t next = ancestors[previous];
+
+                        ancestors[previous] = root;
+
+                        previous = next;
+                    }
+
+                    --delta[root];
+                }
+            }
+        }
+
+        if (parents[current] != UNKNOWN)
+        {
+            ancestors[current] = parents[current];
+        }
+    }
+
+    std::size_t ret = 0;
+
+    for (htd::index_t rank = 0; rank < size; ++rank)
+    {
+        if (parents[rank] != UNKNOWN)
+        {
+            delta[parents[rank]] += delta[rank];
+        }
+
+        ret = std::max(ret, delta[rank]);
+    }
+
+    return ret;
 }
 
 const htd::LibraryInstance * htd::MaximumCardinalitySearchOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
@@ -167,13 +546,22 @@ void htd::MaximumCardinalitySearchOrderingAlgorithm::setManagementInstance(const
 
 htd::MaximumCardinalitySearchOrderingAlgorithm * htd::MaximumCardinalitySearchOrderingAlgorithm::clone(void) const
 {
-    return new htd::MaximumCardinalitySearchOrderingAlgorithm(managementInstance());
+    htd::MaximumCardinalitySearchOrderingAlgorithm * ret = new htd::MaximumCardinalitySearchOrderingAlgorithm(managementInstance());
+
+    ret->setRandomTieBreakingEnabled(isRandomTieBreakingEnabled());
+
+    return ret;
 }
 
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 htd::IOrderingAlgorithm * htd::MaximumCardinalitySearchOrderingAlgorithm::cloneOrderingAlgorithm(void) const
 {
-    return new htd::MaximumCardinalitySearchOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::MaximumCardinalitySearchOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return clone();
 }
 #endif
 
@@ -31,7 +31,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/BucketQueue.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -71,6 +71,21 @@ struct htd::MinDegreeOrderingAlgorithm::Implementation
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
     std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+
+    /**
+     *  Compute the vertex ordering of a given graph based on its dense adjacency matrix and write it to the end of a given vector.
+     *
+     *  The neighborhoods of the neighbors of an eliminated vertex are merged with word-wide OR operations and the
+     *  updated degrees are obtained via population count.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] adjacencyMatrix      The dense adjacency matrix of the remaining vertices of the input graph.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const htd::DenseAdjacencyMatrix & adjacencyMatrix, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
 };
 
 htd::MinDegreeOrderingAlgorithm::MinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -140,6 +155,13 @@ htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrder
 
 std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
 {
+    const htd::DenseAdjacencyMatrix * denseAdjacencyMatrix = preprocessedGraph.denseAdjacencyMatrix();
+
+    if (denseAdjacencyMatrix != nullptr)
+    {
+        return writeOrderingTo(preprocessedGraph, *denseAdjacencyMatrix, target, maxBagSize);
+    }
+
     std::size_t ret = 0;
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
@@ -152,7 +174,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     std::vector<htd::vertex_t> difference;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::BucketQueue<htd::vertex_t, std::greater<std::size_t>> priorityQueue(preprocessedGraph.inputGraphVertexCount(), size);
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
@@ -190,8 +212,6 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
         {
             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
 
-            std::size_t oldNeighborhoodSize = currentNeighborhood.size();
-
             /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
             // coverity[use_iterator]
             currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
@@ -207,7 +227,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
                 difference.clear();
             }
 
-            priorityQueue.updatePriority(neighbor, oldNeighborhoodSize, currentNeighborhood.size());
+            priorityQueue.updatePriority(neighbor, currentNeighborhood.size());
         }
 
         std::vector<htd::vertex_t>().swap(selectedNeighborhood);
@@ -220,6 +240,87 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
     return ret;
 }
 
+std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const htd::DenseAdjacencyMatrix & adjacencyMatrix, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    typedef htd::DenseAdjacencyMatrix::word_t word_t;
+
+    std::size_t ret = preprocessedGraph.minTreeWidth() + 1;
+
+    std::size_t size = adjacencyMatrix.vertexCount();
+
+    std::size_t wordCount = adjacencyMatrix.wordCount();
+
+    std::vector<word_t> rows(adjacencyMatrix.words());
+
+    std::vector<std::size_t> neighborhoodSize(size);
+
+    std::vector<htd::vertex_t> selectedNeighbors;
+
+    htd::BucketQueue<htd::vertex_t, std::greater<std::size_t>> priorityQueue(size, size);
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        neighborhoodSize[index] = htd::DenseAdjacencyMatrix::count(rows.data() + index * wordCount, wordCount) + 1;
+
+        priorityQueue.push(static_cast<htd::vertex_t>(index), neighborhoodSize[index]);
+    }
+
+    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+
+        priorityQueue.eraseFromTopCollection(selectedVertex);
+
+        if (neighborhoodSize[selectedVertex] > ret)
+        {
+            ret = neighborhoodSize[selectedVertex];
+        }
+
+        word_t * selectedRow = rows.data() + selectedVertex * wordCount;
+
+        selectedNeighbors.clear();
+
+        for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+        {
+            for (word_t word = selectedRow[wordIndex]; word != 0; word &= word - 1)
+            {
+                selectedNeighbors.push_back(static_cast<htd::vertex_t>(wordIndex * htd::DenseAdjacencyMatrix::WORD_SIZE + htd::DenseAdjacencyMatrix::trailingZeroCount(word)));
+            }
+        }
+
+        for (htd::vertex_t neighbor : selectedNeighbors)
+        {
+            word_t * neighborRow = rows.data() + neighbor * wordCount;
+
+            for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            {
+                neighborRow[wordIndex] |= selectedRow[wordIndex];
+            }
+
+            htd::DenseAdjacencyMatrix::reset(neighborRow, neighbor);
+            htd::DenseAdjacencyMatrix::reset(neighborRow, selectedVertex);
+
+            std::size_t currentNeighborhoodSize = htd::DenseAdjacencyMatrix::count(neighborRow, wordCount) + 1;
+
+            priorityQueue.updatePriority(neighbor, currentNeighborhoodSize);
+
+            neighborhoodSize[neighbor] = currentNeighborhoodSize;
+        }
+
+        std::fill(selectedRow, selectedRow + wordCount, 0);
+
+        --size;
+
+        target.push_back(preprocessedGraph.vertexName(adjacencyMatrix.vertexAtPosition(selectedVertex)));
+    }
+
+    return ret;
+}
+
 const htd::LibraryInstance * htd::MinDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
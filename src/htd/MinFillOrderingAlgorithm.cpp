@@ -31,7 +31,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/IndexedPriorityQueue.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -112,6 +112,40 @@ struct htd::MinFillOrderingAlgorithm::Implementation
 
             fillValue.resize(size, 0);
 
+            const htd::DenseAdjacencyMatrix * denseAdjacencyMatrix = preprocessedGraph.denseAdjacencyMatrix();
+
+            if (denseAdjacencyMatrix != nullptr)
+            {
+                std::size_t wordCount = denseAdjacencyMatrix->wordCount();
+
+                for (htd::index_t index = 0; index < denseAdjacencyMatrix->vertexCount(); ++index)
+                {
+                    const htd::DenseAdjacencyMatrix::word_t * currentRow = denseAdjacencyMatrix->row(index);
+
+                    std::size_t neighborCount = htd::DenseAdjacencyMatrix::count(currentRow, wordCount);
+
+                    std::size_t edgeCount = 0;
+
+                    for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+                    {
+                        for (htd::DenseAdjacencyMatrix::word_t word = currentRow[wordIndex]; word != 0; word &= word - 1)
+                        {
+                            htd::index_t neighbor = wordIndex * htd::DenseAdjacencyMatrix::WORD_SIZE + htd::DenseAdjacencyMatrix::trailingZeroCount(word);
+
+                            edgeCount += htd::DenseAdjacencyMatrix::intersectionCount(currentRow, denseAdjacencyMatrix->row(neighbor), wordCount);
+                        }
+                    }
+
+                    std::size_t currentFillValue = ((neighborCount * (neighborCount - 1)) / 2) - (edgeCount / 2);
+
+                    fillValue[denseAdjacencyMatrix->vertexAtPosition(index)] = currentFillValue;
+
+                    totalFill += currentFillValue;
+                }
+
+                return;
+            }
+
             for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
             {
                 const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
@@ -156,6 +190,23 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
     std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+
+    /**
+     *  Compute the vertex ordering of a given graph based on its dense adjacency matrix and write it to the end of a given vector.
+     *
+     *  The fill value of the affected vertices is updated incrementally after each elimination step. Only the rows of
+     *  the eliminated vertex, of its neighbors and of the endpoints of the fill edges are inspected, each of them with
+     *  word-wide AND operations and population count.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] adjacencyMatrix      The dense adjacency matrix of the remaining vertices of the input graph.
+     *  @param[in] input                The preprocessed, algorithm-specific input data.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const htd::DenseAdjacencyMatrix & adjacencyMatrix, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
 };
 
 htd::MinFillOrderingAlgorithm::MinFillOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -227,6 +278,13 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
 
 std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
 {
+    const htd::DenseAdjacencyMatrix * denseAdjacencyMatrix = preprocessedGraph.denseAdjacencyMatrix();
+
+    if (denseAdjacencyMatrix != nullptr)
+    {
+        return writeOrderingTo(preprocessedGraph, *denseAdjacencyMatrix, input, target, maxBagSize);
+    }
+
     std::size_t ret = 0;
 
     std::size_t size = preprocessedGraph.inputGraphVertexCount();
@@ -237,7 +295,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::IndexedPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue(size);
 
     std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
 
@@ -313,7 +371,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -454,7 +512,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill += fillUpdate;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -463,7 +521,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 {
                     totalFill -= tmp;
 
-                    priorityQueue.updatePriority(vertex, fillValue[vertex], 0);
+                    priorityQueue.updatePriority(vertex, 0);
 
                     fillValue[vertex] = 0;
                 }
@@ -518,7 +576,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         totalFill -= fillReduction;
 
-                        priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
+                        priorityQueue.updatePriority(vertex, tmp);
 
                         fillValue[vertex] = tmp;
                     }
@@ -662,6 +720,214 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     return ret;
 }
 
+std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const htd::DenseAdjacencyMatrix & adjacencyMatrix, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    typedef htd::DenseAdjacencyMatrix::word_t word_t;
+
+    const std::size_t wordSize = htd::DenseAdjacencyMatrix::WORD_SIZE;
+
+    std::size_t ret = preprocessedGraph.minTreeWidth() + 1;
+
+    std::size_t size = adjacencyMatrix.vertexCount();
+
+    std::size_t wordCount = adjacencyMatrix.wordCount();
+
+    std::vector<word_t> rows(adjacencyMatrix.words());
+
+    std::vector<std::size_t> fillValue(size);
+
+    std::vector<long> fillUpdate(size, 0);
+
+    std::vector<htd::vertex_t> updatedVertices;
+
+    std::vector<word_t> selectedNeighborhood(wordCount);
+    std::vector<word_t> exclusiveNeighborhood(wordCount);
+
+    std::vector<htd::vertex_t> selectedNeighbors;
+    std::vector<htd::vertex_t> additionalNeighbors;
+
+    htd::IndexedPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue(size);
+
+    std::size_t totalFill = input.totalFill;
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        fillValue[index] = input.fillValue[adjacencyMatrix.vertexAtPosition(index)];
+
+        priorityQueue.push(static_cast<htd::vertex_t>(index), fillValue[index]);
+    }
+
+    while (totalFill > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+
+        priorityQueue.eraseFromTopCollection(selectedVertex);
+
+        word_t * selectedRow = rows.data() + selectedVertex * wordCount;
+
+        std::copy(selectedRow, selectedRow + wordCount, selectedNeighborhood.begin());
+
+        selectedNeighbors.clear();
+
+        for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+        {
+            for (word_t word = selectedNeighborhood[wordIndex]; word != 0; word &= word - 1)
+            {
+                selectedNeighbors.push_back(static_cast<htd::vertex_t>(wordIndex * wordSize + htd::DenseAdjacencyMatrix::trailingZeroCount(word)));
+            }
+        }
+
+        if (selectedNeighbors.size() + 1 > ret)
+        {
+            ret = selectedNeighbors.size() + 1;
+        }
+
+        totalFill -= fillValue[selectedVertex];
+
+        updatedVertices.clear();
+
+        for (htd::vertex_t neighbor : selectedNeighbors)
+        {
+            const word_t * neighborRow = rows.data() + neighbor * wordCount;
+
+            for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            {
+                exclusiveNeighborhood[wordIndex] = neighborRow[wordIndex] & ~selectedNeighborhood[wordIndex];
+            }
+
+            htd::DenseAdjacencyMatrix::reset(exclusiveNeighborhood.data(), selectedVertex);
+
+            /* The edge between 'neighbor' and 'selectedVertex' vanishes, hence all pairs of 'selectedVertex' and a vertex of the exclusive neighborhood are no longer missing. */
+            long currentFillUpdate = -static_cast<long>(htd::DenseAdjacencyMatrix::count(exclusiveNeighborhood.data(), wordCount));
+
+            if (fillValue[selectedVertex] > 0)
+            {
+                additionalNeighbors.clear();
+
+                for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+                {
+                    for (word_t word = selectedNeighborhood[wordIndex] & ~neighborRow[wordIndex]; word != 0; word &= word - 1)
+                    {
+                        htd::vertex_t additionalNeighbor = static_cast<htd::vertex_t>(wordIndex * wordSize + htd::DenseAdjacencyMatrix::trailingZeroCount(word));
+
+                        if (additionalNeighbor != neighbor)
+                        {
+                            additionalNeighbors.push_back(additionalNeighbor);
+                        }
+                    }
+                }
+
+                for (htd::vertex_t additionalNeighbor : additionalNeighbors)
+                {
+                    const word_t * additionalNeighborRow = rows.data() + additionalNeighbor * wordCount;
+
+                    /* Pairs of an additional neighbor and a vertex of the exclusive neighborhood are missing edges unless they are adjacent already. */
+                    currentFillUpdate += static_cast<long>(htd::DenseAdjacencyMatrix::differenceCount(exclusiveNeighborhood.data(), additionalNeighborRow, wordCount));
+
+                    if (neighbor < additionalNeighbor)
+                    {
+                        /* Each vertex adjacent to both endpoints of the new fill edge loses one missing edge in its neighborhood. */
+                        for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+                        {
+                            word_t commonNeighbors = neighborRow[wordIndex] & additionalNeighborRow[wordIndex];
+
+                            if (wordIndex == selectedVertex / wordSize)
+                            {
+                                commonNeighbors &= ~(((word_t)1) << (selectedVertex % wordSize));
+                            }
+
+                            for (; commonNeighbors != 0; commonNeighbors &= commonNeighbors - 1)
+                            {
+                                htd::vertex_t affectedVertex = static_cast<htd::vertex_t>(wordIndex * wordSize + htd::DenseAdjacencyMatrix::trailingZeroCount(commonNeighbors));
+
+                                if (fillUpdate[affectedVertex] == 0)
+                                {
+                                    updatedVertices.push_back(affectedVertex);
+                                }
+
+                                --fillUpdate[affectedVertex];
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (currentFillUpdate != 0)
+            {
+                if (fillUpdate[neighbor] == 0)
+                {
+                    updatedVertices.push_back(neighbor);
+                }
+
+                fillUpdate[neighbor] += currentFillUpdate;
+            }
+        }
+
+        for (htd::vertex_t neighbor : selectedNeighbors)
+        {
+            word_t * neighborRow = rows.data() + neighbor * wordCount;
+
+            for (htd::index_t wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+            {
+                neighborRow[wordIndex] |= selectedNeighborhood[wordIndex];
+            }
+
+            htd::DenseAdjacencyMatrix::reset(neighborRow, neighbor);
+            htd::DenseAdjacencyMatrix::reset(neighborRow, selectedVertex);
+        }
+
+        std::fill(selectedRow, selectedRow + wordCount, 0);
+
+        /* A vertex may be recorded more than once if its accumulated update temporarily returned to zero. */
+        for (htd::vertex_t vertex : updatedVertices)
+        {
+            long currentFillUpdate = fillUpdate[vertex];
+
+            if (currentFillUpdate != 0)
+            {
+                std::size_t tmp = static_cast<std::size_t>(static_cast<long>(fillValue[vertex]) + currentFillUpdate);
+
+                totalFill = static_cast<std::size_t>(static_cast<long>(totalFill) + currentFillUpdate);
+
+                priorityQueue.updatePriority(vertex, tmp);
+
+                fillValue[vertex] = tmp;
+
+                fillUpdate[vertex] = 0;
+            }
+        }
+
+        target.push_back(preprocessedGraph.vertexName(adjacencyMatrix.vertexAtPosition(selectedVertex)));
+
+        --size;
+    }
+
+    /* All remaining vertices are simplicial, i.e., the remaining graph is a disjoint union of cliques. */
+    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+
+        priorityQueue.eraseFromTopCollection(vertex);
+
+        std::size_t neighborhoodSize = htd::DenseAdjacencyMatrix::count(rows.data() + vertex * wordCount, wordCount) + 1;
+
+        if (neighborhoodSize > ret)
+        {
+            ret = neighborhoodSize;
+        }
+
+        target.push_back(preprocessedGraph.vertexName(adjacencyMatrix.vertexAtPosition(vertex)));
+
+        --size;
+    }
+
+    return ret;
+}
+
 const htd::LibraryInstance * htd::MinFillOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
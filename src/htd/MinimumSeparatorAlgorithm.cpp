@@ -27,12 +27,16 @@
 
 #include <htd/MinimumSeparatorAlgorithm.hpp>
 
-#include <htd/FlowNetworkStructure.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
+#include <htd/FlowNetworkStructure.hpp>
+#include <htd/ParallelExecution.hpp>
+#include <htd/ResidualNetwork.hpp>
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::MinimumSeparatorAlgorithm.
@@ -44,7 +48,7 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1), maxFlowAlgorithm_(new htd::DinitzMaxFlowAlgorithm(manager))
     {
 
     }
@@ -58,8 +62,140 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of threads which are used to evaluate the pairs of vertices.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The algorithm which is used to compute the maximum flows.
+     */
+    std::unique_ptr<htd::IMaxFlowAlgorithm> maxFlowAlgorithm_;
+
+    /**
+     *  Compute the positions of the neighbors of each vertex of the given graph.
+     *
+     *  @param[in] graph        The input graph.
+     *  @param[out] neighbors   The positions of the neighbors of each vertex (in ascending order).
+     */
+    static void computeNeighbors(const htd::IGraphStructure & graph, std::vector<std::vector<htd::index_t>> & neighbors);
+
+    /**
+     *  Compute a minimum set of vertices separating the vertices at the given positions.
+     *
+     *  @param[in] residualNetwork  The residual network of the flow network in which the vertex at position k is split into the in-node k and the out-node k + n.
+     *  @param[in] source           The position of the first vertex.
+     *  @param[in] target           The position of the second vertex which must not be adjacent to the first one.
+     *  @param[in] limit            The size from which on a separator is of no interest.
+     *  @param[out] separator       The positions of the vertices of the separator in ascending order.
+     *
+     *  @return True if a separator smaller than limit was found, false otherwise.
+     */
+    bool computeMinimumSeparator(htd::ResidualNetwork & residualNetwork, htd::index_t source, htd::index_t target, std::size_t limit, std::vector<htd::index_t> & separator) const;
 };
 
+void htd::MinimumSeparatorAlgorithm::Implementation::computeNeighbors(const htd::IGraphStructure & graph, std::vector<std::vector<htd::index_t>> & neighbors)
+{
+    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+
+    htd::index_t index = 0;
+
+    for (htd::vertex_t vertex : graph.vertexSpan())
+    {
+        indices.emplace(vertex, index);
+
+        ++index;
+    }
+
+    neighbors.clear();
+
+    neighbors.resize(graph.vertexCount());
+
+    std::vector<htd::vertex_t> neighborBuffer;
+
+    index = 0;
+
+    for (htd::vertex_t vertex : graph.vertexSpan())
+    {
+        std::vector<htd::index_t> & currentNeighbors = neighbors[index];
+
+        for (htd::vertex_t neighbor : graph.neighborSpan(vertex, neighborBuffer))
+        {
+            if (neighbor != vertex)
+            {
+                currentNeighbors.push_back(indices.at(neighbor));
+            }
+        }
+
+        std::sort(currentNeighbors.begin(), currentNeighbors.end());
+
+        currentNeighbors.erase(std::unique(currentNeighbors.begin(), currentNeighbors.end()), currentNeighbors.end());
+
+        ++index;
+    }
+}
+
+bool htd::MinimumSeparatorAlgorithm::Implementation::computeMinimumSeparator(htd::ResidualNetwork & residualNetwork, htd::index_t source, htd::index_t target, std::size_t limit, std::vector<htd::index_t> & separator) const
+{
+    bool ret = false;
+
+    std::size_t n = residualNetwork.vertexCount() / 2;
+
+    separator.clear();
+
+    /* The flow leaves the source vertex via its out-node and enters the target vertex via its in-node. A flow of value limit already rules out a smaller separator, hence the computation stops there. */
+    std::size_t flow = maxFlowAlgorithm_->determineMaximumFlow(residualNetwork, n + source, target, limit);
+
+    /* An interrupted computation does not yield a maximum flow, hence its residual network does not induce a minimum cut. */
+    if (flow < limit && !managementInstance_->isTerminated())
+    {
+        std::vector<char> & reachable = residualNetwork.marks();
+
+        std::vector<htd::vertex_t> & queue = residualNetwork.vertexQueue();
+
+        std::fill(reachable.begin(), reachable.end(), 0);
+
+        reachable[n + source] = 1;
+
+        queue[0] = n + source;
+
+        std::size_t queueSize = 1;
+
+        for (htd::index_t queueIndex = 0; queueIndex < queueSize; ++queueIndex)
+        {
+            htd::vertex_t node = queue[queueIndex];
+
+            for (htd::index_t arc = residualNetwork.firstArc(node); arc < residualNetwork.endArc(node); ++arc)
+            {
+                htd::vertex_t next = residualNetwork.arcTarget(arc);
+
+                if (reachable[next] == 0 && residualNetwork.residualCapacity(arc) > 0)
+                {
+                    reachable[next] = 1;
+
+                    queue[queueSize] = next;
+
+                    ++queueSize;
+                }
+            }
+        }
+
+        /* The minimum cut consists of the arcs connecting a reachable in-node with an unreachable out-node. */
+        for (htd::index_t position = 0; position < n; ++position)
+        {
+            if (reachable[position] != 0 && reachable[n + position] == 0)
+            {
+                separator.push_back(position);
+            }
+        }
+
+        ret = true;
+    }
+
+    return ret;
+}
+
 htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
 {
 
@@ -74,81 +210,159 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
 {
     std::vector<htd::vertex_t> * ret = new std::vector<htd::vertex_t>();
 
-    std::size_t n = graph.vertexCount();
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-    htd::index_t index = 0;
+    std::vector<std::vector<htd::index_t>> neighbors;
 
-    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+    Implementation::computeNeighbors(graph, neighbors);
+
+    std::size_t n = neighbors.size();
+
+    /* Each vertex is split into an in-node and an out-node which are connected by an arc of capacity one. */
+    htd::FlowNetworkStructure flowNetwork(2 * n);
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::index_t position = 0; position < n; ++position)
     {
-        indices.emplace(vertex, index);
+        flowNetwork.updateCapacity(position, n + position, 1);
 
-        ++index;
+        for (htd::index_t neighbor : neighbors[position])
+        {
+            flowNetwork.updateCapacity(n + position, neighbor, (std::size_t)-1);
+        }
     }
 
-    htd::FlowNetworkStructure flowNetwork(n * 2);
+    /*
+     *  The candidates are ranked by their size and then by the pair of vertices they were computed for. The neighborhood
+     *  of a vertex of minimum degree serves as initial upper bound and is preferred among all separators of the same size.
+     */
+    std::vector<htd::index_t> bestSeparator;
 
-    for (htd::vertex_t vertex : graph.vertices())
-    {
-        htd::index_t vertexIndex = indices.at(vertex);
+    std::size_t bestSize = n;
 
-        flowNetwork.updateCapacity(vertexIndex, vertexIndex + n, 1);
+    std::size_t bestRank = 0;
 
-        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+    for (htd::index_t position = 0; position < n; ++position)
+    {
+        std::size_t degree = neighbors[position].size();
+
+        if (degree < bestSize && degree + 1 < n)
         {
-            htd::index_t neighborIndex = indices.at(neighbor);
+            bestSeparator = neighbors[position];
 
-            flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
-            flowNetwork.updateCapacity(neighborIndex + n, vertexIndex, (std::size_t)-1);
+            bestSize = degree;
         }
     }
 
-    graph.copyVerticesTo(*ret);
+    if (bestSize == n)
+    {
+        bestSeparator.resize(n);
 
-    for (htd::index_t i = 0; i < n; ++i)
+        for (htd::index_t position = 0; position < n; ++position)
+        {
+            bestSeparator[position] = position;
+        }
+    }
+
+    std::size_t workerCount = std::max(implementation_->threadCount_, (std::size_t)1);
+
+    /* Each worker reuses its residual network and its separator buffer for all pairs it evaluates. */
+    std::vector<std::unique_ptr<htd::ResidualNetwork>> residualNetworks(workerCount);
+
+    std::vector<std::vector<htd::index_t>> separators(workerCount);
+
+    std::mutex mutex;
+
+    std::vector<bool> adjacent(n, false);
+
+    std::vector<htd::index_t> targets;
+
+    /*
+     *  Every minimum separator S misses one of the vertices at the positions 0, ..., |S|. The vertex at the smallest of
+     *  these positions is separated by S from a vertex at a larger position, hence the vertices at larger positions than
+     *  the size of the best separator found so far never need to be used as source (S. Even, 1975).
+     */
+    for (htd::index_t source = 0; source < n && source <= bestSize && !managementInstance.isTerminated(); ++source)
     {
-        htd::vertex_t vertex1 = graph.vertexAtPosition(i);
+        for (htd::index_t neighbor : neighbors[source])
+        {
+            adjacent[neighbor] = true;
+        }
+
+        targets.clear();
 
-        for (htd::index_t j = i + 1; j < n; ++j)
+        for (htd::index_t target = source + 1; target < n; ++target)
         {
-            htd::vertex_t vertex2 = graph.vertexAtPosition(j);
+            if (!adjacent[target])
+            {
+                targets.push_back(target);
+            }
+        }
 
-            if (!graph.isNeighbor(vertex1, vertex2))
+        htd::parallelFor(targets.size(), implementation_->threadCount_, [&](htd::index_t worker, htd::index_t task)
+        {
+            if (!managementInstance.isTerminated())
             {
-                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(implementation_->managementInstance_);
+                htd::index_t target = targets[task];
+
+                std::size_t rank = 1 + source * n + target;
+
+                std::unique_lock<std::mutex> lock(mutex);
 
-                htd::IFlow * flow = maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j);
+                /* A separator of the same size as the best one found so far is only of interest if it has a smaller rank. */
+                std::size_t limit = rank < bestRank ? bestSize + 1 : bestSize;
 
-                std::unordered_set<htd::vertex_t> candidate;
+                lock.unlock();
 
-                for(htd::index_t k = 0; k < n; ++k)
+                /* The common neighbors of both vertices are contained in every separator, i.e., they form a lower bound for its size. */
+                std::size_t commonNeighborCount = 0;
+
+                for (htd::index_t neighbor : neighbors[target])
                 {
-                    if (k != i && k != j)
+                    if (adjacent[neighbor])
                     {
-                        std::size_t capacity = flowNetwork.capacity(k, k + n);
-
-                        if (static_cast<std::size_t>(flow->flow(k, k + n)) == capacity && capacity > 0 && capacity < (std::size_t)-1)
-                        {
-                            candidate.insert(graph.vertexAtPosition(k));
-                        }
+                        ++commonNeighborCount;
                     }
                 }
 
-                if (candidate.size() < ret->size())
+                if (commonNeighborCount < limit)
                 {
-                    ret->clear();
+                    if (residualNetworks[worker] == nullptr)
+                    {
+                        residualNetworks[worker].reset(new htd::ResidualNetwork(flowNetwork));
+                    }
 
-                    ret->insert(ret->end(), candidate.begin(), candidate.end());
+                    std::vector<htd::index_t> & separator = separators[worker];
 
-                    std::sort(ret->begin(), ret->end());
-                }
+                    if (implementation_->computeMinimumSeparator(*(residualNetworks[worker]), source, target, limit, separator))
+                    {
+                        lock.lock();
+
+                        if (separator.size() < bestSize || (separator.size() == bestSize && rank < bestRank))
+                        {
+                            bestSeparator = separator;
+
+                            bestSize = separator.size();
 
-                delete flow;
+                            bestRank = rank;
+                        }
+                    }
+                }
             }
+        });
+
+        for (htd::index_t neighbor : neighbors[source])
+        {
+            adjacent[neighbor] = false;
         }
     }
 
+    ret->reserve(bestSeparator.size());
+
+    for (htd::index_t position : bestSeparator)
+    {
+        ret->push_back(graph.vertexAtPosition(position));
+    }
+
     return ret;
 }
 
@@ -162,11 +376,38 @@ void htd::MinimumSeparatorAlgorithm::setManagementInstance(const htd::LibraryIns
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    implementation_->maxFlowAlgorithm_->setManagementInstance(manager);
+}
+
+std::size_t htd::MinimumSeparatorAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::MinimumSeparatorAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
+void htd::MinimumSeparatorAlgorithm::setMaxFlowAlgorithm(htd::IMaxFlowAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    implementation_->maxFlowAlgorithm_.reset(algorithm);
 }
 
 htd::MinimumSeparatorAlgorithm * htd::MinimumSeparatorAlgorithm::clone(void) const
 {
-    return new htd::MinimumSeparatorAlgorithm(managementInstance());
+    htd::MinimumSeparatorAlgorithm * ret = new htd::MinimumSeparatorAlgorithm(managementInstance());
+
+    ret->setThreadCount(implementation_->threadCount_);
+
+    ret->setMaxFlowAlgorithm(implementation_->maxFlowAlgorithm_->clone());
+
+    return ret;
 }
 
 #endif /* HTD_HTD_MINIMUMSEPARATORALGORITHM_CPP */
@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/MultiGraph.hpp>
+#include <htd/MultiHypergraph.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
 #include <htd/VectorAdapter.hpp>
 
@@ -193,6 +194,13 @@ void htd::MultiGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::ver
     implementation_->base_->copyNeighborsTo(vertex, target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::MultiGraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->base_->neighborSpan(vertex, buffer);
+}
+
 htd::vertex_t htd::MultiGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     return implementation_->base_->neighborAtPosition(vertex, index);
@@ -208,6 +216,11 @@ void htd::MultiGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
     implementation_->base_->copyVerticesTo(target);
 }
 
+htd::ConstSpan<htd::vertex_t> htd::MultiGraph::vertexSpan(void) const
+{
+    return implementation_->base_->vertexSpan();
+}
+
 htd::vertex_t htd::MultiGraph::vertexAtPosition(htd::index_t index) const
 {
     return implementation_->base_->vertexAtPosition(index);
@@ -313,6 +326,23 @@ htd::id_t htd::MultiGraph::addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
     return implementation_->base_->addEdge(vertex1, vertex2);
 }
 
+void htd::MultiGraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    htd::MultiHypergraph * base = dynamic_cast<htd::MultiHypergraph *>(implementation_->base_);
+
+    if (base != nullptr)
+    {
+        base->addEdges(edges);
+    }
+    else
+    {
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            implementation_->base_->addEdge(edge.first, edge.second);
+        }
+    }
+}
+
 void htd::MultiGraph::removeEdge(htd::id_t edgeId)
 {
     implementation_->base_->removeEdge(edgeId);
@@ -457,6 +457,15 @@ void htd::MultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd
     target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::MultiHypergraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    HTD_UNUSED(buffer)
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighborhood_[vertex - htd::Vertex::FIRST]);
+}
+
 htd::vertex_t htd::MultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -480,6 +489,11 @@ void htd::MultiHypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) c
                   implementation_->vertices_.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::MultiHypergraph::vertexSpan(void) const
+{
+    return htd::ConstSpan<htd::vertex_t>(implementation_->vertices_);
+}
+
 htd::vertex_t htd::MultiHypergraph::vertexAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->vertices_.size())
@@ -780,6 +794,64 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::vertex_t vertex1, htd::vertex_t ver
     return implementation_->next_edge_++;
 }
 
+void htd::MultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = implementation_->neighborhood_;
+
+    std::vector<bool> affectedVertices(neighborhood.size(), false);
+
+    std::vector<htd::vertex_t> affectedVertexList;
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        htd::vertex_t vertex1 = edge.first;
+        htd::vertex_t vertex2 = edge.second;
+
+        HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+        implementation_->edges_->emplace_back(implementation_->next_edge_, vertex1, vertex2);
+
+        ++(implementation_->next_edge_);
+
+        htd::index_t index1 = vertex1 - htd::Vertex::FIRST;
+        htd::index_t index2 = vertex2 - htd::Vertex::FIRST;
+
+        neighborhood[index1].push_back(vertex2);
+
+        if (!affectedVertices[index1])
+        {
+            affectedVertices[index1] = true;
+
+            affectedVertexList.push_back(vertex1);
+        }
+
+        if (vertex1 != vertex2)
+        {
+            neighborhood[index2].push_back(vertex1);
+
+            if (!affectedVertices[index2])
+            {
+                affectedVertices[index2] = true;
+
+                affectedVertexList.push_back(vertex2);
+            }
+        }
+        else
+        {
+            implementation_->selfLoops_.insert(vertex1);
+        }
+    }
+
+    for (htd::vertex_t vertex : affectedVertexList)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex - htd::Vertex::FIRST];
+
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+        currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+    }
+}
+
 htd::id_t htd::MultiHypergraph::addEdge(const std::vector<htd::vertex_t> & elements)
 {
     return addEdge(std::vector<htd::vertex_t>(elements));
@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
 #include <htd/MultiHypergraph.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
 
 htd::MultiHypergraphFactory::MultiHypergraphFactory(const htd::LibraryInstance * const manager) : htd::GraphTypeFactory<htd::IMultiHypergraph, htd::IMutableMultiHypergraph>(new htd::MultiHypergraph(manager))
 {
@@ -57,4 +58,13 @@ htd::IMutableMultiHypergraph * htd::MultiHypergraphFactory::createInstance(std::
     return ret;
 }
 
+htd::IMultiHypergraph * htd::MultiHypergraphFactory::createCompactInstance(const htd::IMultiHypergraph & original) const
+{
+    htd::CompactMultiHypergraph * ret = new htd::CompactMultiHypergraph(original);
+
+    ret->setManagementInstance(managementInstance_);
+
+    return ret;
+}
+
 #endif /* HTD_HTD_MULTIHYPERGRAPHFACTORY_CPP */
@@ -0,0 +1,192 @@
+/*
+ * File:   ParallelExecution.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_PARALLELEXECUTION_CPP
+#define HTD_HTD_PARALLELEXECUTION_CPP
+
+#include <htd/ParallelExecution.hpp>
+
+#include <htd/CancellationScope.hpp>
+#include <htd/Helpers.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  The range of tasks which is currently owned by a worker thread.
+     */
+    struct TaskRange
+    {
+        /**
+         *  The mutex protecting the range.
+         */
+        std::mutex mutex;
+
+        /**
+         *  The first task of the range.
+         */
+        htd::index_t begin;
+
+        /**
+         *  The position after the last task of the range.
+         */
+        htd::index_t end;
+    };
+
+    /**
+     *  Take the next task from the front of the range of the given worker or, if the range is empty, steal the last task of the range of another worker.
+     *
+     *  @param[in] ranges   The task ranges of all workers.
+     *  @param[in] worker   The index of the worker.
+     *  @param[out] task    The task which was taken.
+     *
+     *  @return True if a task was taken, false if no tasks are left.
+     */
+    static bool takeTask(std::vector<TaskRange> & ranges, htd::index_t worker, htd::index_t & task)
+    {
+        bool ret = false;
+
+        std::size_t workerCount = ranges.size();
+
+        for (htd::index_t offset = 0; !ret && offset < workerCount; ++offset)
+        {
+            TaskRange & range = ranges[(worker + offset) % workerCount];
+
+            std::lock_guard<std::mutex> lock(range.mutex);
+
+            if (range.begin < range.end)
+            {
+                if (offset == 0)
+                {
+                    task = range.begin;
+
+                    ++(range.begin);
+                }
+                else
+                {
+                    --(range.end);
+
+                    task = range.end;
+                }
+
+                ret = true;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Execute the given tasks on worker threads using work-stealing.
+     *
+     *  @param[in] taskCount    The number of tasks.
+     *  @param[in] workerCount  The number of worker threads.
+     *  @param[in] task         The function which is called for each task with the index of the executing worker and the index of the task.
+     */
+    static void distributeTasks(std::size_t taskCount, std::size_t workerCount, const std::function<void(htd::index_t, htd::index_t)> & task)
+    {
+        std::vector<TaskRange> ranges(workerCount);
+
+        for (htd::index_t worker = 0; worker < workerCount; ++worker)
+        {
+            ranges[worker].begin = static_cast<htd::index_t>((taskCount * worker) / workerCount);
+            ranges[worker].end = static_cast<htd::index_t>((taskCount * (worker + 1)) / workerCount);
+        }
+
+        htd::executeWorkers(workerCount, [&](htd::index_t worker)
+        {
+            htd::index_t currentTask = 0;
+
+            while (!htd::CancellationToken::isCurrentCancelled() && takeTask(ranges, worker, currentTask))
+            {
+                task(worker, currentTask);
+            }
+        });
+    }
+}
+
+void htd::executeWorkers(std::size_t workerCount, const std::function<void(htd::index_t)> & worker)
+{
+    std::shared_ptr<htd::CancellationToken> cancellationToken = htd::CancellationToken::current();
+
+    std::vector<std::thread> threads;
+
+    threads.reserve(workerCount);
+
+    for (htd::index_t index = 0; index < workerCount; ++index)
+    {
+        threads.emplace_back([&, index](void)
+        {
+            htd::CancellationScope cancellationScope(cancellationToken);
+
+            worker(index);
+
+            htd::resetThreadLocalRandomSeed();
+        });
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void htd::parallelFor(std::size_t taskCount, std::size_t threadCount, const std::function<void(htd::index_t, htd::index_t)> & task)
+{
+    std::size_t workerCount = std::min(threadCount, taskCount);
+
+    if (workerCount <= 1)
+    {
+        for (htd::index_t index = 0; index < taskCount && !htd::CancellationToken::isCurrentCancelled(); ++index)
+        {
+            task(0, index);
+        }
+    }
+    else
+    {
+        htd::distributeTasks(taskCount, workerCount, task);
+    }
+}
+
+void htd::seededParallelFor(std::size_t taskCount, std::size_t threadCount, const std::function<void(htd::index_t, htd::index_t)> & task)
+{
+    unsigned int baseSeed = static_cast<unsigned int>(htd::randomNumber());
+
+    std::size_t workerCount = std::max(std::min(threadCount, taskCount), static_cast<std::size_t>(1));
+
+    htd::distributeTasks(taskCount, workerCount, [&](htd::index_t worker, htd::index_t index)
+    {
+        htd::setThreadLocalRandomSeed(baseSeed + static_cast<unsigned int>(index));
+
+        task(worker, index);
+    });
+}
+
+#endif /* HTD_HTD_PARALLELEXECUTION_CPP */
@@ -458,6 +458,17 @@ void htd::Path::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
     std::sort(target.begin() + size, target.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Path::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    buffer.clear();
+
+    copyNeighborsTo(vertex, buffer);
+
+    return htd::ConstSpan<htd::vertex_t>(buffer);
+}
+
 htd::vertex_t htd::Path::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -486,6 +497,11 @@ void htd::Path::copyVerticesTo(std::vector<htd::vertex_t> & target) const
                   implementation_->vertices_.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Path::vertexSpan(void) const
+{
+    return htd::ConstSpan<htd::vertex_t>(implementation_->vertices_);
+}
+
 htd::vertex_t htd::Path::vertexAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->vertices_.size())
@@ -706,6 +722,15 @@ void htd::Path::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
     }
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Path::childSpan(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const htd::vertex_t & child = implementation_->nodes_.at(vertex)->child;
+
+    return htd::ConstSpan<htd::vertex_t>(&child, child != htd::Vertex::UNKNOWN ? 1 : 0);
+}
+
 htd::vertex_t htd::Path::child(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -35,32 +35,31 @@
 #include <algorithm>
 #include <stdexcept>
 
-htd::PathDecomposition::PathDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledPath::LabeledPath(manager), bagContent_(), inducedEdges_()
+htd::PathDecomposition::PathDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledPath::LabeledPath(manager), bagStorage_()
 {
 
 }
 
-htd::PathDecomposition::PathDecomposition(const htd::PathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::PathDecomposition::PathDecomposition(const htd::PathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagStorage_(original.bagStorage_)
 {
 
 }
 
-htd::PathDecomposition::PathDecomposition(const htd::IPath & original) : htd::LabeledPath::LabeledPath(original), bagContent_(), inducedEdges_()
+htd::PathDecomposition::PathDecomposition(const htd::IPath & original) : htd::LabeledPath::LabeledPath(original), bagStorage_()
 {
 
 }
 
-htd::PathDecomposition::PathDecomposition(const htd::ILabeledPath & original) : htd::LabeledPath::LabeledPath(original), bagContent_(), inducedEdges_()
+htd::PathDecomposition::PathDecomposition(const htd::ILabeledPath & original) : htd::LabeledPath::LabeledPath(original), bagStorage_()
 {
 
 }
 
-htd::PathDecomposition::PathDecomposition(const htd::IPathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagContent_(), inducedEdges_()
+htd::PathDecomposition::PathDecomposition(const htd::IPathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
-        inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+        bagStorage_.insert(vertex, original.bagContent(vertex), original.inducedHyperedges(vertex));
     }
 }
 
@@ -73,9 +72,7 @@ void htd::PathDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::Path::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
-
-    inducedEdges_.erase(vertex);
+    bagStorage_.erase(vertex);
 }
 
 void htd::PathDecomposition::removeSubpath(htd::vertex_t subpathRoot)
@@ -89,9 +86,7 @@ void htd::PathDecomposition::removeSubpath(htd::vertex_t subpathRoot)
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        bagContent_.erase(vertex);
-
-        inducedEdges_.erase(vertex);
+        bagStorage_.erase(vertex);
     }, subpathRoot);
 
     htd::Path::removeSubpath(subpathRoot);
@@ -105,9 +100,7 @@ htd::vertex_t htd::PathDecomposition::insertRoot(void)
 
     if (inserted)
     {
-        bagContent_[ret] = std::vector<htd::vertex_t>();
-
-        inducedEdges_[ret] = htd::FilteredHyperedgeCollection();
+        bagStorage_.insert(ret);
     }
 
     return ret;
@@ -121,9 +114,7 @@ htd::vertex_t htd::PathDecomposition::insertRoot(const std::vector<htd::vertex_t
 
     if (inserted)
     {
-        bagContent_[ret] = bagContent;
-
-        inducedEdges_[ret] = inducedEdges;
+        bagStorage_.insert(ret, bagContent, inducedEdges);
     }
 
     return ret;
@@ -137,9 +128,7 @@ htd::vertex_t htd::PathDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::move(bagContent));
-
-        inducedEdges_.emplace(ret, std::move(inducedEdges));
+        bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
     }
 
     return ret;
@@ -149,9 +138,7 @@ htd::vertex_t htd::PathDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Path::addChild(vertex);
 
-    bagContent_[ret] = std::vector<htd::vertex_t>();
-
-    inducedEdges_[ret] = htd::FilteredHyperedgeCollection();
+    bagStorage_.insert(ret);
 
     return ret;
 }
@@ -160,9 +147,7 @@ htd::vertex_t htd::PathDecomposition::addChild(htd::vertex_t vertex, const std::
 {
     htd::vertex_t ret = htd::Path::addChild(vertex);
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    bagStorage_.insert(ret, bagContent, inducedEdges);
 
     return ret;
 }
@@ -171,9 +156,7 @@ htd::vertex_t htd::PathDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Path::addChild(vertex);
 
-    bagContent_[ret] = std::move(bagContent);
-
-    inducedEdges_[ret] = std::move(inducedEdges);
+    bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
 
     return ret;
 }
@@ -182,9 +165,7 @@ htd::vertex_t htd::PathDecomposition::addParent(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Path::addParent(vertex);
 
-    bagContent_[ret] = std::vector<htd::vertex_t>();
-
-    inducedEdges_[ret] = htd::FilteredHyperedgeCollection();
+    bagStorage_.insert(ret);
 
     return ret;
 }
@@ -193,9 +174,7 @@ htd::vertex_t htd::PathDecomposition::addParent(htd::vertex_t vertex, const std:
 {
     htd::vertex_t ret = htd::Path::addParent(vertex);
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    bagStorage_.insert(ret, bagContent, inducedEdges);
 
     return ret;
 }
@@ -204,9 +183,7 @@ htd::vertex_t htd::PathDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Path::addParent(vertex);
 
-    bagContent_[ret] = std::move(bagContent);
-
-    inducedEdges_[ret] = std::move(inducedEdges);
+    bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
 
     return ret;
 }
@@ -219,9 +196,7 @@ void htd::PathDecomposition::removeChild(htd::vertex_t vertex)
 
         htd::Path::removeChild(vertex, childVertex);
 
-        bagContent_.erase(childVertex);
-
-        inducedEdges_.erase(childVertex);
+        bagStorage_.erase(childVertex);
     }
 }
 
@@ -229,9 +204,7 @@ void htd::PathDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
 {
     htd::Path::removeChild(vertex, child);
 
-    bagContent_.erase(child);
-
-    inducedEdges_.erase(child);
+    bagStorage_.erase(child);
 }
 
 std::size_t htd::PathDecomposition::joinNodeCount(void) const
@@ -529,35 +502,35 @@ std::size_t htd::PathDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagStorage_.bagSize(vertex);
 }
 
 std::vector<htd::vertex_t> & htd::PathDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagStorage_.bagContent(vertex);
 }
 
 const std::vector<htd::vertex_t> & htd::PathDecomposition::bagContent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagStorage_.bagContent(vertex);
 }
 
 htd::FilteredHyperedgeCollection & htd::PathDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return bagStorage_.inducedHyperedges(vertex);
 }
 
 const htd::FilteredHyperedgeCollection & htd::PathDecomposition::inducedHyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return bagStorage_.inducedHyperedges(vertex);
 }
 
 std::size_t htd::PathDecomposition::minimumBagSize(void) const
@@ -876,7 +849,7 @@ std::size_t htd::PathDecomposition::rememberedVertexCount(htd::vertex_t vertex)
     const std::vector<htd::vertex_t> & bag = bagContent(vertex);
     const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
 
-    return htd::set_intersection_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
+    return htd::set_intersection_size(bag, childBag);
 }
 
 std::size_t htd::PathDecomposition::rememberedVertexCount(htd::vertex_t vertex, htd::vertex_t child) const
@@ -887,7 +860,7 @@ std::size_t htd::PathDecomposition::rememberedVertexCount(htd::vertex_t vertex,
     const std::vector<htd::vertex_t> & bag = bagContent(vertex);
     const std::vector<htd::vertex_t> & childBag = bagContent(child);
 
-    return htd::set_intersection_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
+    return htd::set_intersection_size(bag, childBag);
 }
 
 htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::rememberedVertices(htd::vertex_t vertex) const
@@ -57,7 +57,7 @@ struct htd::PreprocessedGraph::Implementation
                    std::vector<htd::vertex_t> && remainingVertices,
                    std::size_t inputGraphEdgeCount,
                    std::size_t minTreeWidth)
-        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
+        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount), denseAdjacencyMatrix_()
     {
         updateEdgeCount();
     }
@@ -68,8 +68,12 @@ struct htd::PreprocessedGraph::Implementation
      *  @param[in] original  The original implementation details structure.
      */
     Implementation(const Implementation & original)
-        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
+        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_), denseAdjacencyMatrix_()
     {
+        if (original.denseAdjacencyMatrix_)
+        {
+            denseAdjacencyMatrix_.reset(new htd::DenseAdjacencyMatrix(*(original.denseAdjacencyMatrix_)));
+        }
 
     }
 
@@ -113,6 +117,11 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::size_t inputGraphEdgeCount_;
 
+    /**
+     *  The dense adjacency matrix of the remaining vertices.
+     */
+    std::unique_ptr<htd::DenseAdjacencyMatrix> denseAdjacencyMatrix_;
+
     /**
      *  Recompute the number of edges in the graph to update the result of the function edgeCount().
      */
@@ -192,6 +201,11 @@ void htd::PreprocessedGraph::copyVerticesTo(std::vector<htd::vertex_t> & target)
                   implementation_->remainingVertices_.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::PreprocessedGraph::vertexSpan(void) const
+{
+    return htd::ConstSpan<htd::vertex_t>(implementation_->remainingVertices_);
+}
+
 htd::vertex_t htd::PreprocessedGraph::vertexAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->remainingVertices_.size())
@@ -281,6 +295,15 @@ void htd::PreprocessedGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<h
     target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::PreprocessedGraph::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    HTD_UNUSED(buffer)
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->neighborhood_[vertex]);
+}
+
 htd::vertex_t htd::PreprocessedGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -409,6 +432,8 @@ void htd::PreprocessedGraph::removeVertex(htd::vertex_t vertex)
 
     std::vector<htd::vertex_t> & selectedNeighborhood = implementation_->neighborhood_[vertex];
 
+    implementation_->denseAdjacencyMatrix_.reset();
+
     implementation_->edgeCount_ -= selectedNeighborhood.size();
 
     for (htd::vertex_t neighbor : selectedNeighborhood)
@@ -441,6 +466,8 @@ htd::vertex_t htd::PreprocessedGraph::vertexName(htd::vertex_t vertex) const
 
 std::vector<std::vector<htd::vertex_t>> & htd::PreprocessedGraph::neighborhood(void) HTD_NOEXCEPT
 {
+    implementation_->denseAdjacencyMatrix_.reset();
+
     return implementation_->neighborhood_;
 }
 
@@ -453,6 +480,8 @@ std::vector<htd::vertex_t> & htd::PreprocessedGraph::neighborhood(htd::vertex_t
 {
     HTD_ASSERT(vertex < implementation_->names_.size());
 
+    implementation_->denseAdjacencyMatrix_.reset();
+
     return implementation_->neighborhood_[vertex];
 }
 
@@ -485,6 +514,8 @@ const std::vector<htd::vertex_t> & htd::PreprocessedGraph::remainingVertices(voi
 
 void htd::PreprocessedGraph::setRemainingVertices(const std::vector<htd::vertex_t> & remainingVertices)
 {
+    implementation_->denseAdjacencyMatrix_.reset();
+
     implementation_->remainingVertices_ = remainingVertices;
 
     implementation_->updateEdgeCount();
@@ -492,6 +523,8 @@ void htd::PreprocessedGraph::setRemainingVertices(const std::vector<htd::vertex_
 
 void htd::PreprocessedGraph::setRemainingVertices(std::vector<htd::vertex_t> && remainingVertices)
 {
+    implementation_->denseAdjacencyMatrix_.reset();
+
     implementation_->remainingVertices_ = std::move(remainingVertices);
 
     implementation_->updateEdgeCount();
@@ -507,6 +540,30 @@ std::size_t htd::PreprocessedGraph::minTreeWidth(void) const HTD_NOEXCEPT
     return implementation_->minTreeWidth_;
 }
 
+const htd::DenseAdjacencyMatrix * htd::PreprocessedGraph::denseAdjacencyMatrix(void) const HTD_NOEXCEPT
+{
+    return implementation_->denseAdjacencyMatrix_.get();
+}
+
+void htd::PreprocessedGraph::updateDenseAdjacencyMatrix(void)
+{
+    implementation_->updateEdgeCount();
+
+    if (htd::DenseAdjacencyMatrix::isRecommended(implementation_->remainingVertices_.size(), implementation_->edgeCount_))
+    {
+        implementation_->denseAdjacencyMatrix_.reset(new htd::DenseAdjacencyMatrix(implementation_->neighborhood_, implementation_->remainingVertices_));
+    }
+    else
+    {
+        implementation_->denseAdjacencyMatrix_.reset();
+    }
+}
+
+void htd::PreprocessedGraph::releaseDenseAdjacencyMatrix(void)
+{
+    implementation_->denseAdjacencyMatrix_.reset();
+}
+
 htd::PreprocessedGraph * htd::PreprocessedGraph::clone(void) const
 {
     return new htd::PreprocessedGraph(*this);
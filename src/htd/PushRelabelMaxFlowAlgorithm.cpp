@@ -0,0 +1,307 @@
+/*
+ * File:   PushRelabelMaxFlowAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_PUSHRELABELMAXFLOWALGORITHM_CPP
+#define HTD_HTD_PUSHRELABELMAXFLOWALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/PushRelabelMaxFlowAlgorithm.hpp>
+#include <htd/ResidualNetwork.hpp>
+
+#include <algorithm>
+
+/**
+ *  Private implementation details of class htd::PushRelabelMaxFlowAlgorithm.
+ */
+struct htd::PushRelabelMaxFlowAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Set the label of each vertex to its distance to the target vertex in the residual network. The vertices which
+     *  cannot reach the target vertex get the number of vertices plus their distance to the source vertex as label.
+     *
+     *  @param[in] residualNetwork  The residual network. Its label buffer is updated and its current arcs are reset.
+     *  @param[in] source           The source vertex.
+     *  @param[in] target           The target vertex.
+     */
+    void performGlobalRelabeling(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target) const;
+
+    /**
+     *  Assign labels to the vertices which can reach the given root in the residual network and which have no label yet by a backward breadth-first search.
+     *
+     *  @param[in] residualNetwork  The residual network.
+     *  @param[in] root             The root of the breadth-first search.
+     *  @param[in] rootLabel        The label of the root.
+     */
+    void assignLabels(htd::ResidualNetwork & residualNetwork, htd::vertex_t root, std::size_t rootLabel) const;
+};
+
+htd::PushRelabelMaxFlowAlgorithm::PushRelabelMaxFlowAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::PushRelabelMaxFlowAlgorithm::~PushRelabelMaxFlowAlgorithm()
+{
+
+}
+
+htd::IFlow * htd::PushRelabelMaxFlowAlgorithm::determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const
+{
+    htd::ResidualNetwork residualNetwork(flowNetwork);
+
+    determineMaximumFlow(residualNetwork, source, target, (std::size_t)-1);
+
+    return residualNetwork.createFlow(source, target);
+}
+
+std::size_t htd::PushRelabelMaxFlowAlgorithm::determineMaximumFlow(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t flowLimit) const
+{
+    HTD_ASSERT(source < residualNetwork.vertexCount() && target < residualNetwork.vertexCount())
+
+    std::size_t vertexCount = residualNetwork.vertexCount();
+
+    residualNetwork.reset(residualNetwork.computeCapacityBound(source, target));
+
+    std::vector<std::size_t> & labels = residualNetwork.labels();
+
+    std::vector<std::size_t> & excesses = residualNetwork.excesses();
+
+    std::vector<htd::index_t> & currentArcs = residualNetwork.currentArcs();
+
+    std::vector<htd::vertex_t> & queue = residualNetwork.vertexQueue();
+
+    std::vector<char> & active = residualNetwork.marks();
+
+    std::fill(excesses.begin(), excesses.end(), 0);
+
+    std::fill(active.begin(), active.end(), 0);
+
+    /* The queue of active vertices is a ring buffer, each vertex is contained at most once. */
+    htd::index_t queueBegin = 0;
+
+    std::size_t queueSize = 0;
+
+    auto activate = [&](htd::vertex_t vertex)
+    {
+        if (!active[vertex] && vertex != source && vertex != target)
+        {
+            active[vertex] = 1;
+
+            queue[(queueBegin + queueSize) % vertexCount] = vertex;
+
+            ++queueSize;
+        }
+    };
+
+    if (source != target)
+    {
+        for (htd::index_t arc = residualNetwork.firstArc(source); arc < residualNetwork.endArc(source); ++arc)
+        {
+            std::size_t delta = residualNetwork.residualCapacity(arc);
+
+            if (delta > 0)
+            {
+                htd::vertex_t next = residualNetwork.arcTarget(arc);
+
+                residualNetwork.push(arc, delta);
+
+                excesses[next] += delta;
+
+                activate(next);
+            }
+        }
+
+        implementation_->performGlobalRelabeling(residualNetwork, source, target);
+    }
+
+    std::size_t relabelCount = 0;
+
+    /* Once the excess of the target reaches the limit, the value of the maximum flow is known to be at least the limit. */
+    while (queueSize > 0 && excesses[target] < flowLimit && !implementation_->managementInstance_->isTerminated())
+    {
+        htd::vertex_t vertex = queue[queueBegin];
+
+        queueBegin = (queueBegin + 1) % vertexCount;
+
+        --queueSize;
+
+        active[vertex] = 0;
+
+        /* Discharge the vertex, i.e., push its excess to neighbors with smaller labels and relabel it if necessary. */
+        while (excesses[vertex] > 0)
+        {
+            htd::index_t & currentArc = currentArcs[vertex];
+
+            if (currentArc == residualNetwork.endArc(vertex))
+            {
+                std::size_t newLabel = 2 * vertexCount;
+
+                for (htd::index_t arc = residualNetwork.firstArc(vertex); arc < residualNetwork.endArc(vertex); ++arc)
+                {
+                    if (residualNetwork.residualCapacity(arc) > 0)
+                    {
+                        newLabel = std::min(newLabel, labels[residualNetwork.arcTarget(arc)] + 1);
+                    }
+                }
+
+                labels[vertex] = newLabel;
+
+                currentArc = residualNetwork.firstArc(vertex);
+
+                ++relabelCount;
+            }
+            else
+            {
+                htd::vertex_t next = residualNetwork.arcTarget(currentArc);
+
+                std::size_t residualCapacity = residualNetwork.residualCapacity(currentArc);
+
+                if (residualCapacity > 0 && labels[vertex] == labels[next] + 1)
+                {
+                    std::size_t delta = std::min(excesses[vertex], residualCapacity);
+
+                    residualNetwork.push(currentArc, delta);
+
+                    excesses[vertex] -= delta;
+
+                    excesses[next] += delta;
+
+                    activate(next);
+                }
+                else
+                {
+                    ++currentArc;
+                }
+            }
+        }
+
+        if (relabelCount >= vertexCount)
+        {
+            implementation_->performGlobalRelabeling(residualNetwork, source, target);
+
+            relabelCount = 0;
+        }
+    }
+
+    return excesses[target];
+}
+
+const htd::LibraryInstance * htd::PushRelabelMaxFlowAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::PushRelabelMaxFlowAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::PushRelabelMaxFlowAlgorithm * htd::PushRelabelMaxFlowAlgorithm::clone(void) const
+{
+    return new htd::PushRelabelMaxFlowAlgorithm(managementInstance());
+}
+
+void htd::PushRelabelMaxFlowAlgorithm::Implementation::performGlobalRelabeling(htd::ResidualNetwork & residualNetwork, htd::vertex_t source, htd::vertex_t target) const
+{
+    std::size_t vertexCount = residualNetwork.vertexCount();
+
+    std::vector<std::size_t> & labels = residualNetwork.labels();
+
+    std::vector<htd::index_t> & currentArcs = residualNetwork.currentArcs();
+
+    std::fill(labels.begin(), labels.end(), 2 * vertexCount);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        currentArcs[vertex] = residualNetwork.firstArc(vertex);
+    }
+
+    /* The source vertex keeps its label, hence it is not entered by the first search. */
+    labels[source] = vertexCount;
+
+    assignLabels(residualNetwork, target, 0);
+
+    labels[source] = 2 * vertexCount;
+
+    assignLabels(residualNetwork, source, vertexCount);
+}
+
+void htd::PushRelabelMaxFlowAlgorithm::Implementation::assignLabels(htd::ResidualNetwork & residualNetwork, htd::vertex_t root, std::size_t rootLabel) const
+{
+    std::size_t vertexCount = residualNetwork.vertexCount();
+
+    std::vector<std::size_t> & labels = residualNetwork.labels();
+
+    std::vector<htd::index_t> & queue = residualNetwork.arcPath();
+
+    queue.clear();
+
+    queue.push_back(root);
+
+    labels[root] = rootLabel;
+
+    for (htd::index_t queueIndex = 0; queueIndex < queue.size(); ++queueIndex)
+    {
+        htd::vertex_t vertex = static_cast<htd::vertex_t>(queue[queueIndex]);
+
+        for (htd::index_t arc = residualNetwork.firstArc(vertex); arc < residualNetwork.endArc(vertex); ++arc)
+        {
+            htd::vertex_t previous = residualNetwork.arcTarget(arc);
+
+            /* The vertex can be reached from its neighbor if the opposite arc has positive residual capacity. */
+            if (labels[previous] == 2 * vertexCount && residualNetwork.residualCapacity(residualNetwork.oppositeArc(arc)) > 0)
+            {
+                labels[previous] = labels[vertex] + 1;
+
+                queue.push_back(previous);
+            }
+        }
+    }
+}
+
+#endif /* HTD_HTD_PUSHRELABELMAXFLOWALGORITHM_CPP */
@@ -44,7 +44,7 @@ htd::RandomVertexSelectionStrategy::~RandomVertexSelectionStrategy()
 
 void htd::RandomVertexSelectionStrategy::selectVertices(const htd::IMultiHypergraph & graph, std::vector<htd::vertex_t> & target) const
 {
-    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
     if (graph.vertexCount() > limit_)
     {
@@ -0,0 +1,286 @@
+/*
+ * File:   ResidualNetwork.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_RESIDUALNETWORK_CPP
+#define HTD_HTD_RESIDUALNETWORK_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/ResidualNetwork.hpp>
+
+#include <algorithm>
+
+namespace htd
+{
+    /**
+     *  Implementation of the htd::IFlow interface storing the flow on the arcs of a residual network.
+     */
+    class ResidualNetworkFlow : public htd::IFlow
+    {
+        public:
+            /**
+             *  Constructor of a new flow data structure.
+             *
+             *  @param[in] arcOffsets   The position of the first arc of each vertex.
+             *  @param[in] arcTargets   The target vertex of each arc.
+             *  @param[in] flows        The flow on each arc.
+             *  @param[in] source       The source vertex.
+             *  @param[in] target       The target vertex.
+             */
+            ResidualNetworkFlow(const std::vector<htd::index_t> & arcOffsets, const std::vector<htd::vertex_t> & arcTargets, std::vector<long long> && flows, htd::vertex_t source, htd::vertex_t target) : arcOffsets_(arcOffsets), arcTargets_(arcTargets), flows_(std::move(flows)), source_(source), target_(target)
+            {
+
+            }
+
+            /**
+             *  Copy constructor of a new flow data structure.
+             *
+             *  @param[in] original The original flow data structure.
+             */
+            ResidualNetworkFlow(const ResidualNetworkFlow & original) : arcOffsets_(original.arcOffsets_), arcTargets_(original.arcTargets_), flows_(original.flows_), source_(original.source_), target_(original.target_)
+            {
+
+            }
+
+            std::size_t vertexCount(void) const HTD_OVERRIDE
+            {
+                return arcOffsets_.size() - 1;
+            }
+
+            htd::vertex_t source(void) const HTD_OVERRIDE
+            {
+                return source_;
+            }
+
+            htd::vertex_t target(void) const HTD_OVERRIDE
+            {
+                return target_;
+            }
+
+            std::size_t value(void) const HTD_OVERRIDE
+            {
+                long long ret = 0;
+
+                for (htd::index_t arc = arcOffsets_[target_]; arc < arcOffsets_[target_ + 1]; ++arc)
+                {
+                    ret -= flows_[arc];
+                }
+
+                return static_cast<std::size_t>(ret);
+            }
+
+            long long flow(htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(source < vertexCount() && target < vertexCount())
+
+                long long ret = 0;
+
+                auto first = arcTargets_.begin() + arcOffsets_[source];
+                auto last = arcTargets_.begin() + arcOffsets_[source + 1];
+
+                auto position = std::lower_bound(first, last, target);
+
+                if (position != last && *position == target)
+                {
+                    ret = flows_[static_cast<htd::index_t>(position - arcTargets_.begin())];
+                }
+
+                return ret;
+            }
+
+            ResidualNetworkFlow * clone(void) const HTD_OVERRIDE
+            {
+                return new ResidualNetworkFlow(*this);
+            }
+
+        private:
+            /**
+             *  The position of the first arc of each vertex.
+             */
+            std::vector<htd::index_t> arcOffsets_;
+
+            /**
+             *  The target vertex of each arc.
+             */
+            std::vector<htd::vertex_t> arcTargets_;
+
+            /**
+             *  The flow on each arc.
+             */
+            std::vector<long long> flows_;
+
+            /**
+             *  The source vertex.
+             */
+            htd::vertex_t source_;
+
+            /**
+             *  The target vertex.
+             */
+            htd::vertex_t target_;
+    };
+}
+
+htd::ResidualNetwork::ResidualNetwork(const htd::IFlowNetworkStructure & flowNetwork) : arcOffsets_(flowNetwork.vertexCount() + 1, 0), arcTargets_(), oppositeArcs_(), capacities_(), effectiveCapacities_(), residualCapacities_(), labels_(flowNetwork.vertexCount(), 0), excesses_(flowNetwork.vertexCount(), 0), currentArcs_(flowNetwork.vertexCount(), 0), vertexQueue_(flowNetwork.vertexCount(), 0), arcPath_(), marks_(flowNetwork.vertexCount(), 0)
+{
+    std::size_t vertexCount = flowNetwork.vertexCount();
+
+    std::vector<htd::vertex_t> neighborBuffer;
+
+    /* Each edge of the flow network leads to an arc in each direction, hence the neighbors are combined with the predecessors. */
+    std::vector<std::vector<htd::vertex_t>> adjacencies(vertexCount);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        for (htd::vertex_t neighbor : flowNetwork.neighborSpan(vertex, neighborBuffer))
+        {
+            if (neighbor != vertex)
+            {
+                adjacencies[vertex].push_back(neighbor);
+                adjacencies[neighbor].push_back(vertex);
+            }
+        }
+    }
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        std::vector<htd::vertex_t> & adjacency = adjacencies[vertex];
+
+        std::sort(adjacency.begin(), adjacency.end());
+
+        adjacency.erase(std::unique(adjacency.begin(), adjacency.end()), adjacency.end());
+
+        arcOffsets_[vertex + 1] = arcOffsets_[vertex] + adjacency.size();
+    }
+
+    std::size_t arcCount = arcOffsets_[vertexCount];
+
+    arcTargets_.reserve(arcCount);
+    oppositeArcs_.resize(arcCount);
+    capacities_.reserve(arcCount);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        for (htd::vertex_t neighbor : adjacencies[vertex])
+        {
+            const std::vector<htd::vertex_t> & neighborAdjacency = adjacencies[neighbor];
+
+            oppositeArcs_[arcTargets_.size()] = arcOffsets_[neighbor] + static_cast<htd::index_t>(std::lower_bound(neighborAdjacency.begin(), neighborAdjacency.end(), vertex) - neighborAdjacency.begin());
+
+            arcTargets_.push_back(neighbor);
+
+            capacities_.push_back(flowNetwork.capacity(vertex, neighbor));
+        }
+    }
+
+    effectiveCapacities_ = capacities_;
+
+    residualCapacities_ = capacities_;
+
+    arcPath_.reserve(vertexCount);
+}
+
+htd::ResidualNetwork::~ResidualNetwork()
+{
+
+}
+
+void htd::ResidualNetwork::reset(std::size_t capacityLimit)
+{
+    for (htd::index_t arc = 0; arc < capacities_.size(); ++arc)
+    {
+        std::size_t capacity = std::min(capacities_[arc], capacityLimit);
+
+        effectiveCapacities_[arc] = capacity;
+
+        residualCapacities_[arc] = capacity;
+    }
+}
+
+std::size_t htd::ResidualNetwork::computeCapacityBound(htd::vertex_t source, htd::vertex_t target) const
+{
+    HTD_ASSERT(source < vertexCount() && target < vertexCount())
+
+    const std::size_t infinity = (std::size_t)-1;
+
+    std::size_t outgoingCapacity = 0;
+    std::size_t incomingCapacity = 0;
+    std::size_t finiteCapacity = 0;
+
+    /* Sum up the capacities with saturation at (std::size_t)-1. */
+    auto add = [&](std::size_t value1, std::size_t value2)
+    {
+        return value1 > infinity - value2 ? infinity : value1 + value2;
+    };
+
+    for (htd::index_t arc = arcOffsets_[source]; arc < arcOffsets_[source + 1]; ++arc)
+    {
+        outgoingCapacity = add(outgoingCapacity, capacities_[arc]);
+    }
+
+    for (htd::index_t arc = arcOffsets_[target]; arc < arcOffsets_[target + 1]; ++arc)
+    {
+        incomingCapacity = add(incomingCapacity, capacities_[oppositeArcs_[arc]]);
+    }
+
+    for (std::size_t capacity : capacities_)
+    {
+        if (capacity != infinity)
+        {
+            finiteCapacity = add(finiteCapacity, capacity);
+        }
+    }
+
+    return std::min(std::min(outgoingCapacity, incomingCapacity), finiteCapacity);
+}
+
+long long htd::ResidualNetwork::inflow(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(vertex < vertexCount())
+
+    long long ret = 0;
+
+    for (htd::index_t arc = arcOffsets_[vertex]; arc < arcOffsets_[vertex + 1]; ++arc)
+    {
+        ret -= flow(arc);
+    }
+
+    return ret;
+}
+
+htd::IFlow * htd::ResidualNetwork::createFlow(htd::vertex_t source, htd::vertex_t target) const
+{
+    HTD_ASSERT(source < vertexCount() && target < vertexCount())
+
+    std::vector<long long> flows(arcCount());
+
+    for (htd::index_t arc = 0; arc < flows.size(); ++arc)
+    {
+        flows[arc] = flow(arc);
+    }
+
+    return new htd::ResidualNetworkFlow(arcOffsets_, arcTargets_, std::move(flows), source, target);
+}
+
+#endif /* HTD_HTD_RESIDUALNETWORK_CPP */
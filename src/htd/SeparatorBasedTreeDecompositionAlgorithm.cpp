@@ -29,21 +29,24 @@
 #include <htd/Helpers.hpp>
 
 #include <htd/SeparatorBasedTreeDecompositionAlgorithm.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/GraphLabeling.hpp>
 #include <htd/ILabelingFunction.hpp>
 #include <htd/IMutableTreeDecomposition.hpp>
-#include <htd/GraphPreprocessorFactory.hpp>
-#include <htd/IGraphPreprocessor.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
-#include <htd/TrivialTreeDecompositionAlgorithm.hpp>
+#include <htd/ParallelExecution.hpp>
 #include <htd/WidthReductionOperation.hpp>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdarg>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -58,7 +61,7 @@ struct htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), separatorAlgorithm_(manager->graphSeparatorAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), separatorAlgorithm_(manager->graphSeparatorAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), recursiveDecompositionEnabled_(false), threadCount_(1), computeInducedEdges_(true)
     {
 
     }
@@ -68,7 +71,7 @@ struct htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), separatorAlgorithm_(original.separatorAlgorithm_->clone()), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), separatorAlgorithm_(original.separatorAlgorithm_->clone()), labelingFunctions_(), postProcessingOperations_(), recursiveDecompositionEnabled_(original.recursiveDecompositionEnabled_), threadCount_(original.threadCount_), computeInducedEdges_(original.computeInducedEdges_)
     {
         for (htd::ILabelingFunction * labelingFunction : original.labelingFunctions_)
         {
@@ -124,20 +127,261 @@ struct htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation
      */
     std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
 
+    /**
+     *  A boolean flag indicating whether the input graph shall be decomposed recursively instead of refining a trivial decomposition.
+     */
+    bool recursiveDecompositionEnabled_;
+
+    /**
+     *  The number of threads which are used to decompose the subgraphs resulting from the separators.
+     */
+    std::size_t threadCount_;
+
     /**
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
     bool computeInducedEdges_;
 
+    /**
+     *  A node of the decomposition tree which is computed by the recursive decomposition of the input graph.
+     */
+    struct DecompositionNode
+    {
+        /**
+         *  Constructor for the DecompositionNode data structure.
+         */
+        DecompositionNode(void) : vertices(), cliques(), seed(0), index(0), bag(), children()
+        {
+
+        }
+
+        /**
+         *  The vertices of the subgraph which shall be decomposed, given by their positions within the vertices of the input graph (in ascending order).
+         */
+        std::vector<htd::index_t> vertices;
+
+        /**
+         *  The cliques which were created by the separators of the ancestors, restricted to the vertices of the subgraph.
+         */
+        std::vector<std::vector<htd::index_t>> cliques;
+
+        /**
+         *  The seed of the random number generator which is used while the subgraph is decomposed.
+         */
+        unsigned int seed;
+
+        /**
+         *  The index of the node within the decomposition tree.
+         */
+        htd::index_t index;
+
+        /**
+         *  The bag of the node, i.e., the separator of the subgraph or all its vertices if the subgraph is not separated any further.
+         */
+        std::vector<htd::index_t> bag;
+
+        /**
+         *  The children of the node, one for each component of the subgraph after the removal of the separator.
+         */
+        std::vector<std::unique_ptr<DecompositionNode>> children;
+    };
+
+    /**
+     *  Work-stealing scheduler distributing the decomposition tasks to the worker threads.
+     *
+     *  Each worker owns a double-ended queue. New tasks are added to the back of the queue of the worker which created
+     *  them and the owner also takes its tasks from the back, i.e., each worker proceeds depth-first. An idle worker
+     *  steals the oldest task, i.e., usually the largest remaining subgraph, from the front of the queue of another worker.
+     */
+    class TaskScheduler
+    {
+        public:
+            /**
+             *  Constructor for a new task scheduler.
+             *
+             *  @param[in] workerCount  The number of worker threads.
+             */
+            TaskScheduler(std::size_t workerCount) : queues_(workerCount), mutex_(), condition_(), queuedTaskCount_(0), pendingTaskCount_(0)
+            {
+
+            }
+
+            /**
+             *  Add a new task to the queue of the given worker.
+             *
+             *  @param[in] worker   The index of the worker which created the task.
+             *  @param[in] task     The new task.
+             */
+            void push(htd::index_t worker, DecompositionNode * task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    queues_[worker].push_back(task);
+
+                    ++queuedTaskCount_;
+
+                    ++pendingTaskCount_;
+                }
+
+                condition_.notify_one();
+            }
+
+            /**
+             *  Take the next task for the given worker and wait until a task is available if necessary.
+             *
+             *  @param[in] worker   The index of the worker.
+             *  @param[out] task    The task which was taken.
+             *
+             *  @return True if a task was taken, false if all tasks are finished.
+             */
+            bool pop(htd::index_t worker, DecompositionNode *& task)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                condition_.wait(lock, [&](void) { return queuedTaskCount_ > 0 || pendingTaskCount_ == 0; });
+
+                bool ret = queuedTaskCount_ > 0;
+
+                if (ret)
+                {
+                    takeTask(worker, task);
+
+                    --queuedTaskCount_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Mark a task which was taken via pop() as finished.
+             *
+             *  @note The children of the task must be added before the task is marked as finished.
+             */
+            void finish(void)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                --pendingTaskCount_;
+
+                if (pendingTaskCount_ == 0)
+                {
+                    condition_.notify_all();
+                }
+            }
+
+        private:
+            /**
+             *  The queues of the worker threads.
+             */
+            std::vector<std::deque<DecompositionNode *>> queues_;
+
+            /**
+             *  The mutex protecting the queues and the task counters.
+             */
+            std::mutex mutex_;
+
+            /**
+             *  The condition variable on which idle workers wait for new tasks.
+             */
+            std::condition_variable condition_;
+
+            /**
+             *  The number of tasks which were added but not yet taken.
+             */
+            std::size_t queuedTaskCount_;
+
+            /**
+             *  The number of tasks which were added but not yet finished.
+             */
+            std::size_t pendingTaskCount_;
+
+            /**
+             *  Take a task from the back of the queue of the given worker or, if the queue is empty, steal one from the front of another queue.
+             *
+             *  @param[in] worker   The index of the worker.
+             *  @param[out] task    The task which was taken.
+             *
+             *  @note The mutex of the scheduler must be locked and at least one of the queues must contain a task.
+             */
+            void takeTask(htd::index_t worker, DecompositionNode *& task)
+            {
+                bool found = false;
+
+                std::size_t workerCount = queues_.size();
+
+                for (htd::index_t offset = 0; !found && offset < workerCount; ++offset)
+                {
+                    std::deque<DecompositionNode *> & queue = queues_[(worker + offset) % workerCount];
+
+                    if (!queue.empty())
+                    {
+                        if (offset == 0)
+                        {
+                            task = queue.back();
+
+                            queue.pop_back();
+                        }
+                        else
+                        {
+                            task = queue.front();
+
+                            queue.pop_front();
+                        }
+
+                        found = true;
+                    }
+                }
+
+                HTD_ASSERT(found)
+            }
+    };
+
     /**
      *  Compute a new mutable tree decompostion of the given graph.
      *
-     *  @param[in] graph                The graph which shall be decomposed.
-     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] graph    The graph which shall be decomposed.
      *
      *  @return A mutable tree decompostion of the given graph.
      */
-    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const;
+    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Compute a new mutable tree decompostion of the given graph by refining a trivial decomposition via htd::WidthReductionOperation.
+     *
+     *  @param[in] graph    The graph which shall be decomposed.
+     *
+     *  @return A mutable tree decompostion of the given graph.
+     */
+    htd::IMutableTreeDecomposition * computeWidthReducedDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Compute a new mutable tree decompostion of the given graph by decomposing the subgraphs resulting from the separators recursively.
+     *
+     *  @param[in] graph    The graph which shall be decomposed.
+     *
+     *  @return A mutable tree decompostion of the given graph.
+     */
+    htd::IMutableTreeDecomposition * computeRecursiveDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Decompose the subgraph of the given node, i.e., determine the bag of the node and create one child for each subgraph resulting from the separator.
+     *
+     *  @param[in] neighborhoods        The neighborhoods of the vertices of the input graph, given by their positions (in ascending order).
+     *  @param[in] separatorAlgorithm   The separator algorithm which shall be used.
+     *  @param[in,out] node             The node whose subgraph shall be decomposed.
+     */
+    void decomposeSubgraph(const std::vector<std::vector<htd::index_t>> & neighborhoods, const htd::IGraphSeparatorAlgorithm & separatorAlgorithm, DecompositionNode & node) const;
+
+    /**
+     *  Find a node in the subtree rooted at the given node whose bag contains all given vertices.
+     *
+     *  @param[in] start    The root of the subtree.
+     *  @param[in] vertices The vertices which shall be contained in the bag (in ascending order).
+     *
+     *  @return The index of a node in the subtree whose bag contains all given vertices.
+     */
+    htd::index_t findContainingNode(const DecompositionNode & start, const std::vector<htd::index_t> & vertices) const;
 };
 
 htd::SeparatorBasedTreeDecompositionAlgorithm::SeparatorBasedTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -165,20 +409,6 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
     return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>());
 }
 
-htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
-{
-    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
-
-    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
-
-    htd::ITreeDecomposition * ret = computeDecomposition(graph, *preprocessedGraph, manipulationOperations);
-
-    delete preprocessedGraph;
-    delete preprocessor;
-
-    return ret;
-}
-
 htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
 {
     return computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>());
@@ -186,7 +416,14 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
 
 htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
 {
-    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph);
+    HTD_UNUSED(preprocessedGraph)
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::IMutableTreeDecomposition * ret = implementation_->computeMutableDecomposition(graph);
 
     if (ret != nullptr)
     {
@@ -303,6 +540,28 @@ void htd::SeparatorBasedTreeDecompositionAlgorithm::setGraphSeparatorAlgorithm(h
     implementation_->separatorAlgorithm_ = algorithm;
 }
 
+bool htd::SeparatorBasedTreeDecompositionAlgorithm::isRecursiveDecompositionEnabled(void) const
+{
+    return implementation_->recursiveDecompositionEnabled_;
+}
+
+void htd::SeparatorBasedTreeDecompositionAlgorithm::setRecursiveDecompositionEnabled(bool recursiveDecompositionEnabled)
+{
+    implementation_->recursiveDecompositionEnabled_ = recursiveDecompositionEnabled;
+}
+
+std::size_t htd::SeparatorBasedTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::SeparatorBasedTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::SeparatorBasedTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
 {
     for (auto & labelingFunction : implementation_->labelingFunctions_)
@@ -390,23 +649,48 @@ htd::SeparatorBasedTreeDecompositionAlgorithm * htd::SeparatorBasedTreeDecomposi
     return new htd::SeparatorBasedTreeDecompositionAlgorithm(*this);
 }
 
-htd::IMutableTreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+htd::IMutableTreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    htd::IMutableTreeDecomposition * ret = nullptr;
+
+    if (recursiveDecompositionEnabled_)
+    {
+        ret = computeRecursiveDecomposition(graph);
+    }
+    else
+    {
+        ret = computeWidthReducedDecomposition(graph);
+    }
+
+    return ret;
+}
+
+htd::IMutableTreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation::computeWidthReducedDecomposition(const htd::IMultiHypergraph & graph) const
 {
-    TrivialTreeDecompositionAlgorithm baseAlgorithm(managementInstance_);
+    htd::IMutableTreeDecomposition * ret = managementInstance_->treeDecompositionFactory().createInstance();
+
+    HTD_ASSERT(ret != nullptr)
+
+    std::vector<htd::vertex_t> bagContent;
+
+    bagContent.reserve(graph.vertexCount());
 
-    htd::IMutableTreeDecomposition * ret = dynamic_cast<htd::IMutableTreeDecomposition *>(baseAlgorithm.computeDecomposition(graph, preprocessedGraph));
+    graph.copyVerticesTo(bagContent);
+
+    std::vector<htd::index_t> positions(graph.edgeCount());
+
+    std::iota(positions.begin(), positions.end(), 0);
+
+    /* The trivial decomposition is built directly, the preprocessing performed by htd::TrivialTreeDecompositionAlgorithm would be discarded anyway. */
+    ret->insertRoot(std::move(bagContent), graph.hyperedgesAtPositions(std::move(positions)));
 
     if (!managementInstance_->isTerminated())
     {
-        HTD_ASSERT(ret != nullptr)
-
         WidthReductionOperation operation(managementInstance_);
 
         operation.setGraphSeparatorAlgorithm(separatorAlgorithm_->clone());
 
-        htd::ITreeDecomposition & decomposition = *ret;
-
-        operation.apply(graph, managementInstance_->treeDecompositionFactory().accessMutableInstance(decomposition));
+        operation.apply(graph, *ret);
     }
     else
     {
@@ -418,4 +702,448 @@ htd::IMutableTreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::
     return ret;
 }
 
+htd::IMutableTreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation::computeRecursiveDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    htd::IMutableTreeDecomposition * ret = nullptr;
+
+    std::vector<htd::vertex_t> vertices;
+
+    graph.copyVerticesTo(vertices);
+
+    std::size_t vertexCount = vertices.size();
+
+    /* The workers only access the neighborhoods which are computed in advance and never the input graph itself. */
+    std::vector<std::vector<htd::index_t>> neighborhoods(vertexCount);
+
+    std::vector<htd::vertex_t> neighborBuffer;
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        std::vector<htd::index_t> & neighborhood = neighborhoods[index];
+
+        for (htd::vertex_t neighbor : graph.neighborSpan(vertices[index], neighborBuffer))
+        {
+            if (neighbor != vertices[index])
+            {
+                neighborhood.push_back(static_cast<htd::index_t>(std::distance(vertices.begin(), std::lower_bound(vertices.begin(), vertices.end(), neighbor))));
+            }
+        }
+
+        std::sort(neighborhood.begin(), neighborhood.end());
+
+        neighborhood.erase(std::unique(neighborhood.begin(), neighborhood.end()), neighborhood.end());
+    }
+
+    DecompositionNode root;
+
+    root.vertices.resize(vertexCount);
+
+    std::iota(root.vertices.begin(), root.vertices.end(), 0);
+
+    /* The seeds of the tasks are derived from a single number drawn by the calling thread to obtain reproducible results. */
+    root.seed = static_cast<unsigned int>(htd::randomNumber());
+
+    TaskScheduler scheduler(threadCount_);
+
+    scheduler.push(0, &root);
+
+    htd::executeWorkers(threadCount_, [&](htd::index_t worker)
+    {
+        std::unique_ptr<htd::IGraphSeparatorAlgorithm> separatorAlgorithm(separatorAlgorithm_->clone());
+
+        DecompositionNode * task = nullptr;
+
+        while (scheduler.pop(worker, task))
+        {
+            htd::setThreadLocalRandomSeed(task->seed);
+
+            decomposeSubgraph(neighborhoods, *separatorAlgorithm, *task);
+
+            for (std::unique_ptr<DecompositionNode> & child : task->children)
+            {
+                scheduler.push(worker, child.get());
+            }
+
+            scheduler.finish();
+        }
+    });
+
+    if (!managementInstance_->isTerminated())
+    {
+        /* Number the nodes in breadth-first order, i.e., each node is numbered before its descendants. */
+        std::vector<DecompositionNode *> nodes(1, &root);
+
+        for (htd::index_t index = 0; index < nodes.size(); ++index)
+        {
+            nodes[index]->index = index;
+
+            for (std::unique_ptr<DecompositionNode> & child : nodes[index]->children)
+            {
+                nodes.push_back(child.get());
+            }
+        }
+
+        /*
+         *  Each subtree is attached to its parent via a node whose bag contains the separator of the parent. As the
+         *  bag of the parent is a subset of this bag, the parent is merged into the subtree of its first child, i.e.,
+         *  only the leaves of the recursion remain and the bags of the resulting decomposition are subset-maximal.
+         */
+        std::vector<htd::index_t> representatives(nodes.size());
+
+        std::vector<std::vector<htd::index_t>> treeNeighbors(nodes.size());
+
+        for (htd::index_t index = nodes.size(); index > 0; --index)
+        {
+            const DecompositionNode & node = *(nodes[index - 1]);
+
+            if (node.children.empty())
+            {
+                representatives[index - 1] = index - 1;
+            }
+            else
+            {
+                htd::index_t representative = representatives[findContainingNode(*(node.children[0]), node.bag)];
+
+                representatives[index - 1] = representative;
+
+                for (auto it = node.children.begin() + 1; it != node.children.end(); ++it)
+                {
+                    htd::index_t childRepresentative = representatives[findContainingNode(**it, node.bag)];
+
+                    treeNeighbors[representative].push_back(childRepresentative);
+                    treeNeighbors[childRepresentative].push_back(representative);
+                }
+            }
+        }
+
+        std::vector<std::vector<htd::index_t>> inducedEdgePositions(nodes.size());
+
+        if (computeInducedEdges_)
+        {
+            std::vector<std::vector<htd::index_t>> occurrences(vertexCount);
+
+            for (htd::index_t index = 0; index < nodes.size(); ++index)
+            {
+                if (representatives[index] == index)
+                {
+                    for (htd::index_t vertex : nodes[index]->bag)
+                    {
+                        occurrences[vertex].push_back(index);
+                    }
+                }
+            }
+
+            std::vector<htd::index_t> edgeElements;
+
+            htd::index_t edgePosition = 0;
+
+            for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+            {
+                edgeElements.clear();
+
+                const std::vector<htd::vertex_t> & sortedElements = hyperedge.sortedElements();
+
+                for (htd::vertex_t vertex : sortedElements)
+                {
+                    edgeElements.push_back(static_cast<htd::index_t>(std::distance(vertices.begin(), std::lower_bound(vertices.begin(), vertices.end(), vertex))));
+                }
+
+                if (!edgeElements.empty())
+                {
+                    /* Only the bags containing the least frequent endpoint of the hyperedge need to be checked. */
+                    htd::index_t rarestElement = *std::min_element(edgeElements.begin(), edgeElements.end(), [&](htd::index_t element1, htd::index_t element2)
+                    {
+                        return occurrences[element1].size() < occurrences[element2].size();
+                    });
+
+                    for (htd::index_t candidate : occurrences[rarestElement])
+                    {
+                        const std::vector<htd::index_t> & bag = nodes[candidate]->bag;
+
+                        if (std::includes(bag.begin(), bag.end(), edgeElements.begin(), edgeElements.end()))
+                        {
+                            inducedEdgePositions[candidate].push_back(edgePosition);
+                        }
+                    }
+                }
+
+                ++edgePosition;
+            }
+        }
+
+        ret = managementInstance_->treeDecompositionFactory().createInstance();
+
+        auto createVertex = [&](htd::index_t index, htd::vertex_t parent)
+        {
+            const std::vector<htd::index_t> & bag = nodes[index]->bag;
+
+            std::vector<htd::vertex_t> bagContent;
+
+            bagContent.reserve(bag.size());
+
+            for (htd::index_t vertex : bag)
+            {
+                bagContent.push_back(vertices[vertex]);
+            }
+
+            htd::vertex_t decompositionVertex = htd::Vertex::UNKNOWN;
+
+            if (parent == htd::Vertex::UNKNOWN)
+            {
+                decompositionVertex = ret->insertRoot(std::move(bagContent), graph.hyperedgesAtPositions(std::move(inducedEdgePositions[index])));
+            }
+            else
+            {
+                decompositionVertex = ret->addChild(parent, std::move(bagContent), graph.hyperedgesAtPositions(std::move(inducedEdgePositions[index])));
+            }
+
+            return decompositionVertex;
+        };
+
+        std::vector<bool> visitedNodes(nodes.size(), false);
+
+        std::vector<std::pair<htd::index_t, htd::vertex_t>> originStack;
+
+        visitedNodes[representatives[0]] = true;
+
+        originStack.emplace_back(representatives[0], createVertex(representatives[0], htd::Vertex::UNKNOWN));
+
+        while (!originStack.empty())
+        {
+            std::pair<htd::index_t, htd::vertex_t> current = originStack.back();
+
+            originStack.pop_back();
+
+            for (htd::index_t neighbor : treeNeighbors[current.first])
+            {
+                if (!visitedNodes[neighbor])
+                {
+                    visitedNodes[neighbor] = true;
+
+                    originStack.emplace_back(neighbor, createVertex(neighbor, current.second));
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+void htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation::decomposeSubgraph(const std::vector<std::vector<htd::index_t>> & neighborhoods, const htd::IGraphSeparatorAlgorithm & separatorAlgorithm, DecompositionNode & node) const
+{
+    const std::vector<htd::index_t> & vertices = node.vertices;
+
+    std::size_t vertexCount = vertices.size();
+
+    /* Within the subgraph, each vertex is identified by its position within the vertices of the subgraph. */
+    std::vector<std::vector<htd::index_t>> localNeighborhoods(vertexCount);
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        std::vector<htd::index_t> & localNeighborhood = localNeighborhoods[index];
+
+        auto position = vertices.begin();
+
+        for (htd::index_t neighbor : neighborhoods[vertices[index]])
+        {
+            position = std::lower_bound(position, vertices.end(), neighbor);
+
+            if (position != vertices.end() && *position == neighbor)
+            {
+                localNeighborhood.push_back(static_cast<htd::index_t>(std::distance(vertices.begin(), position)));
+            }
+        }
+    }
+
+    std::vector<htd::index_t> localClique;
+
+    for (const std::vector<htd::index_t> & clique : node.cliques)
+    {
+        localClique.clear();
+
+        for (htd::index_t vertex : clique)
+        {
+            localClique.push_back(static_cast<htd::index_t>(std::distance(vertices.begin(), std::lower_bound(vertices.begin(), vertices.end(), vertex))));
+        }
+
+        for (htd::index_t vertex1 : localClique)
+        {
+            for (htd::index_t vertex2 : localClique)
+            {
+                if (vertex1 != vertex2)
+                {
+                    localNeighborhoods[vertex1].push_back(vertex2);
+                }
+            }
+        }
+    }
+
+    bool complete = true;
+
+    for (std::vector<htd::index_t> & localNeighborhood : localNeighborhoods)
+    {
+        std::sort(localNeighborhood.begin(), localNeighborhood.end());
+
+        localNeighborhood.erase(std::unique(localNeighborhood.begin(), localNeighborhood.end()), localNeighborhood.end());
+
+        complete = complete && localNeighborhood.size() + 1 == vertexCount;
+    }
+
+    std::vector<htd::index_t> localSeparator;
+
+    std::vector<std::vector<htd::index_t>> components;
+
+    if (!complete && !managementInstance_->isTerminated())
+    {
+        std::vector<htd::index_t> edgeOffsets(1, 0);
+
+        std::vector<htd::vertex_t> edgeElements;
+
+        for (htd::index_t index = 0; index < vertexCount; ++index)
+        {
+            for (htd::index_t neighbor : localNeighborhoods[index])
+            {
+                if (index < neighbor)
+                {
+                    edgeElements.push_back(htd::Vertex::FIRST + index);
+                    edgeElements.push_back(htd::Vertex::FIRST + neighbor);
+
+                    edgeOffsets.push_back(edgeElements.size());
+                }
+            }
+        }
+
+        htd::CompactMultiHypergraph subgraph(managementInstance_, vertexCount, std::move(edgeOffsets), std::move(edgeElements));
+
+        std::unique_ptr<std::vector<htd::vertex_t>> separator(separatorAlgorithm.computeSeparator(subgraph));
+
+        std::vector<bool> visitedVertices(vertexCount, false);
+
+        for (htd::vertex_t vertex : *separator)
+        {
+            localSeparator.push_back(vertex - htd::Vertex::FIRST);
+
+            visitedVertices[vertex - htd::Vertex::FIRST] = true;
+        }
+
+        std::sort(localSeparator.begin(), localSeparator.end());
+
+        for (htd::index_t start = 0; start < vertexCount; ++start)
+        {
+            if (!visitedVertices[start])
+            {
+                components.emplace_back(1, start);
+
+                std::vector<htd::index_t> & component = components.back();
+
+                visitedVertices[start] = true;
+
+                for (htd::index_t position = 0; position < component.size(); ++position)
+                {
+                    for (htd::index_t neighbor : localNeighborhoods[component[position]])
+                    {
+                        if (!visitedVertices[neighbor])
+                        {
+                            visitedVertices[neighbor] = true;
+
+                            component.push_back(neighbor);
+                        }
+                    }
+                }
+
+                std::sort(component.begin(), component.end());
+            }
+        }
+    }
+
+    /* A subgraph is not split any further if it is complete or if the separator algorithm did not separate it. */
+    if (components.size() < 2)
+    {
+        node.bag = vertices;
+    }
+    else
+    {
+        for (htd::index_t vertex : localSeparator)
+        {
+            node.bag.push_back(vertices[vertex]);
+        }
+
+        std::vector<htd::index_t> localVertices;
+
+        for (const std::vector<htd::index_t> & component : components)
+        {
+            std::unique_ptr<DecompositionNode> child(new DecompositionNode());
+
+            localVertices.clear();
+
+            std::set_union(component.begin(), component.end(), localSeparator.begin(), localSeparator.end(), std::back_inserter(localVertices));
+
+            for (htd::index_t vertex : localVertices)
+            {
+                child->vertices.push_back(vertices[vertex]);
+            }
+
+            for (const std::vector<htd::index_t> & clique : node.cliques)
+            {
+                std::vector<htd::index_t> remainder;
+
+                std::set_intersection(clique.begin(), clique.end(), child->vertices.begin(), child->vertices.end(), std::back_inserter(remainder));
+
+                if (remainder.size() > 1)
+                {
+                    child->cliques.push_back(std::move(remainder));
+                }
+            }
+
+            /* The separator is turned into a clique to ensure that it is contained in a bag of the decomposition of the child. */
+            if (node.bag.size() > 1)
+            {
+                child->cliques.push_back(node.bag);
+            }
+
+            child->seed = static_cast<unsigned int>(htd::randomNumber());
+
+            node.children.push_back(std::move(child));
+        }
+    }
+
+    std::vector<htd::index_t>().swap(node.vertices);
+
+    std::vector<std::vector<htd::index_t>>().swap(node.cliques);
+}
+
+htd::index_t htd::SeparatorBasedTreeDecompositionAlgorithm::Implementation::findContainingNode(const DecompositionNode & start, const std::vector<htd::index_t> & vertices) const
+{
+    htd::index_t ret = start.index;
+
+    bool found = false;
+
+    std::vector<const DecompositionNode *> originStack(1, &start);
+
+    while (!found && !originStack.empty())
+    {
+        const DecompositionNode & current = *(originStack.back());
+
+        originStack.pop_back();
+
+        if (std::includes(current.bag.begin(), current.bag.end(), vertices.begin(), vertices.end()))
+        {
+            ret = current.index;
+
+            found = true;
+        }
+        else
+        {
+            for (const std::unique_ptr<DecompositionNode> & child : current.children)
+            {
+                originStack.push_back(child.get());
+            }
+        }
+    }
+
+    HTD_ASSERT(found)
+
+    return ret;
+}
+
 #endif /* HTD_HTD_SEPARATORBASEDTREEDECOMPOSITIONALGORITHM_CPP */
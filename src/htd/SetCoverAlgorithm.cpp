@@ -150,7 +150,7 @@ void htd::SetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_
 
     for (htd::index_t index = 0; index < containers.size(); index++)
     {
-        std::size_t coverage = htd::set_intersection_size(remainder.begin(), remainder.end(), containers[index].begin(), containers[index].end());
+        std::size_t coverage = htd::set_intersection_size(remainder, containers[index]);
 
         if (coverage > 0)
         {
@@ -254,7 +254,7 @@ void htd::SetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_
                     htd::print(containers[container], false);
                     std::cout << std::endl;)
 
-                    std::size_t coverage = htd::set_intersection_size(remainder.begin(), remainder.end(), containers[container].begin(), containers[container].end());
+                    std::size_t coverage = htd::set_intersection_size(remainder, containers[container]);
 
                     if (index > selected && coverage > 0)
                     {
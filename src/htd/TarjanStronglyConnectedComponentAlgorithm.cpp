@@ -248,7 +248,7 @@ void htd::TarjanStronglyConnectedComponentAlgorithm::determineComponents(const h
 
     std::unordered_set<htd::vertex_t> stackMembers;
 
-    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
     auto it = vertexCollection.begin();
 
@@ -334,7 +334,7 @@ void htd::TarjanStronglyConnectedComponentAlgorithm::determineComponent(const ht
 
     std::unordered_set<htd::vertex_t> stackMembers;
 
-    const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+    const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
     auto it = vertexCollection.begin();
 
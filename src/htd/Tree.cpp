@@ -31,8 +31,7 @@
 #include <htd/VectorAdapter.hpp>
 #include <htd/PreOrderTreeTraversal.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
-#include <htd/HyperedgePointerDeque.hpp>
-#include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/HyperedgeDeque.hpp>
 
 #include <htd/Algorithm.hpp>
 
@@ -41,7 +40,6 @@
 #include <iterator>
 #include <memory>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 
 /**
@@ -55,7 +53,7 @@ struct htd::Tree::Implementation
     struct Node
     {
         /**
-         *  The ID of the tree node.
+         *  The ID of the tree node. The ID htd::Vertex::UNKNOWN marks a slot which does not hold a tree node.
          */
         htd::id_t id;
 
@@ -104,6 +102,36 @@ struct htd::Tree::Implementation
         {
 
         }
+
+        /**
+         *  Copy assignment operator for a tree node.
+         *
+         *  @param[in] original  The original tree node.
+         */
+        Node & operator=(const Node & original)
+        {
+            id = original.id;
+            parent = original.parent;
+            edges = original.edges;
+            children = original.children;
+
+            return *this;
+        }
+
+        /**
+         *  Move assignment operator for a tree node.
+         *
+         *  @param[in] original  The original tree node.
+         */
+        Node & operator=(Node && original)
+        {
+            id = original.id;
+            parent = original.parent;
+            edges = std::move(original.edges);
+            children = std::move(original.children);
+
+            return *this;
+        }
     };
 
     /**
@@ -111,22 +139,14 @@ struct htd::Tree::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge>>())
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
     }
 
     /**
@@ -141,20 +161,10 @@ struct htd::Tree::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          nodes_(original.nodes_),
+          edges_(std::make_shared<std::deque<htd::Hyperedge>>(*(original.edges_)))
     {
-        nodes_.reserve(original.nodes_.size());
 
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
-
-        for (const htd::Hyperedge * edge : *(original.edges_))
-        {
-            edges_->emplace_back(new htd::Hyperedge(*edge));
-        }
     }
 
     /**
@@ -162,18 +172,8 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         nodes_.clear();
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
-
         edges_->clear();
 
         size_ = 0;
@@ -187,6 +187,73 @@ struct htd::Tree::Implementation
         vertices_.clear();
     }
 
+    /**
+     *  Check whether a given vertex has a slot in the node storage which holds a tree node.
+     *
+     *  @param[in] vertex   The vertex which shall be checked.
+     *
+     *  @return True if the vertex is a node of the tree, false otherwise.
+     */
+    bool containsNode(htd::vertex_t vertex) const
+    {
+        return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < nodes_.size() && nodes_[vertex - htd::Vertex::FIRST].id != htd::Vertex::UNKNOWN;
+    }
+
+    /**
+     *  Access the node information of a given vertex.
+     *
+     *  @param[in] vertex   The vertex whose node information shall be returned.
+     *
+     *  @return The node information of the given vertex.
+     */
+    Node & node(htd::vertex_t vertex)
+    {
+        HTD_ASSERT(containsNode(vertex))
+
+        return nodes_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the node information of a given vertex.
+     *
+     *  @param[in] vertex   The vertex whose node information shall be returned.
+     *
+     *  @return The node information of the given vertex.
+     */
+    const Node & node(htd::vertex_t vertex) const
+    {
+        HTD_ASSERT(containsNode(vertex))
+
+        return nodes_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Create the node information of a new vertex.
+     *
+     *  @param[in] vertex   The new vertex.
+     *  @param[in] parent   The parent of the new vertex.
+     *
+     *  @return The node information of the new vertex.
+     */
+    Node & createNode(htd::vertex_t vertex, htd::vertex_t parent)
+    {
+        HTD_ASSERT(vertex >= htd::Vertex::FIRST)
+
+        std::size_t index = vertex - htd::Vertex::FIRST;
+
+        while (nodes_.size() <= index)
+        {
+            nodes_.emplace_back(htd::Vertex::UNKNOWN, htd::Vertex::UNKNOWN);
+        }
+
+        Node & ret = nodes_[index];
+
+        ret.id = vertex;
+        ret.parent = parent;
+
+        return ret;
+    }
+
     /**
      *  The management instance to which the current object instance belongs.
      */
@@ -218,21 +285,23 @@ struct htd::Tree::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  The node information of all tree nodes. The node information of vertex v is stored at position v - htd::Vertex::FIRST.
+     *
+     *  @note A deque is used because references to its elements stay valid when new nodes are appended.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::deque<Node> nodes_;
 
     /**
      *  The collection of all hyperedges which exist in the tree.
      */
-    std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
+    std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
 
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
-     *  @param[in] node The node of the tree which shall be removed.
+     *  @param[in] treeNode The node of the tree which shall be removed.
      */
-    void deleteNode(Node * node);
+    void deleteNode(Node & treeNode);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
@@ -303,7 +372,7 @@ std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Tree::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return vertex < implementation_->next_vertex_ && implementation_->containsNode(vertex);
 }
 
 bool htd::Tree::isEdge(htd::id_t edgeId) const
@@ -397,7 +466,7 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->node(vertex);
 
     const auto & children = node.children;
 
@@ -445,7 +514,7 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->node(vertex);
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
@@ -472,7 +541,7 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->node(vertex);
 
     const auto & children = node.children;
 
@@ -486,6 +555,17 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
     std::sort(target.begin() + size, target.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Tree::neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    buffer.clear();
+
+    copyNeighborsTo(vertex, buffer);
+
+    return htd::ConstSpan<htd::vertex_t>(buffer);
+}
+
 htd::vertex_t htd::Tree::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -514,6 +594,11 @@ void htd::Tree::copyVerticesTo(std::vector<htd::vertex_t> & target) const
                   implementation_->vertices_.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Tree::vertexSpan(void) const
+{
+    return htd::ConstSpan<htd::vertex_t>(implementation_->vertices_);
+}
+
 htd::vertex_t htd::Tree::vertexAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->vertices_.size())
@@ -563,8 +648,7 @@ bool htd::Tree::isIsolatedVertex(htd::vertex_t vertex) const
 
 htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(void) const
 {
-    return htd::ConstCollection<htd::Hyperedge>(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->begin())),
-                                                static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->end())));
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->edges_));
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex) const
@@ -577,9 +661,9 @@ htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex)
 
     for (auto & edge : *(implementation_->edges_))
     {
-        if (edge->contains(vertex))
+        if (edge.contains(vertex))
         {
-            result.emplace_back(*edge);
+            result.emplace_back(edge);
         }
     }
 
@@ -588,28 +672,28 @@ htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex)
 
 const htd::Hyperedge & htd::Tree::hyperedge(htd::id_t edgeId) const
 {
-    auto it = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), edgeId);
+    auto it = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), edgeId);
 
     if (it == implementation_->edges_->end())
     {
         throw std::logic_error("const htd::Hyperedge & htd::Tree::hyperedge(htd::id_t) const");
     }
 
-    return **it;
+    return *it;
 }
 
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index) const
 {
     HTD_ASSERT(index < implementation_->edges_->size())
 
-    return *(implementation_->edges_->at(index));
+    return implementation_->edges_->at(index);
 }
 
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
     for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
     {
-        const htd::Hyperedge & hyperedge = **it;
+        const htd::Hyperedge & hyperedge = *it;
 
         if (hyperedge.contains(vertex))
         {
@@ -634,7 +718,7 @@ htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(const std::vec
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), indices);
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), indices);
 }
 
 htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
@@ -646,7 +730,7 @@ htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(std::vector<ht
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), std::move(indices));
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), std::move(indices));
 }
 
 htd::vertex_t htd::Tree::root(void) const
@@ -665,7 +749,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->node(vertex).parent;
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,37 +761,44 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->node(vertex).parent == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->node(vertex).children.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->node(vertex).children);
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->node(vertex).children;
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
 
+htd::ConstSpan<htd::vertex_t> htd::Tree::childSpan(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return htd::ConstSpan<htd::vertex_t>(implementation_->node(vertex).children);
+}
+
 htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t index) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->node(vertex).children;
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +810,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->node(vertex).children;
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +848,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->node(vertex).parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->node(currentVertex).parent;
     }
 
     return ret;
@@ -783,19 +874,19 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->node(vertex);
 
     auto end = implementation_->edges_->end();
 
     for (auto it = node.edges.rbegin(); it != node.edges.rend(); ++it)
     {
-        auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), end, *it);
+        auto position = htd::hyperedgePosition(implementation_->edges_->begin(), end, *it);
 
-        for (htd::vertex_t currentVertex : (*position)->sortedElements())
+        for (htd::vertex_t currentVertex : position->sortedElements())
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->node(currentVertex).edges;
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -805,8 +896,6 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        delete *position;
-
         end = implementation_->edges_->erase(position);
     }
 
@@ -814,7 +903,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        Implementation::Node & parentNode = implementation_->node(node.parent);
 
         auto & siblings = parentNode.children;
 
@@ -828,7 +917,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 htd::vertex_t child = children[0];
 
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                Implementation::Node & childNode = implementation_->node(child);
 
                 childNode.parent = node.parent;
 
@@ -841,11 +930,11 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
                 if (node.parent < child)
                 {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
+                    implementation_->edges_->emplace_back(implementation_->next_edge_, node.parent, child);
                 }
                 else
                 {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
+                    implementation_->edges_->emplace_back(implementation_->next_edge_, child, node.parent);
                 }
 
                 childNode.edges.emplace_back(implementation_->next_edge_);
@@ -860,7 +949,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 for (htd::vertex_t child : children)
                 {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->node(child);
 
                     childNode.parent = node.parent;
 
@@ -873,11 +962,11 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
                     if (node.parent < child)
                     {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
+                        implementation_->edges_->emplace_back(implementation_->next_edge_, node.parent, child);
                     }
                     else
                     {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
+                        implementation_->edges_->emplace_back(implementation_->next_edge_, child, node.parent);
                     }
 
                     childNode.edges.emplace_back(implementation_->next_edge_);
@@ -891,7 +980,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(implementation_->node(vertex));
     }
     else
     {
@@ -914,9 +1003,9 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+                implementation_->node(implementation_->root_).parent = htd::Vertex::UNKNOWN;
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(implementation_->node(vertex));
 
                 break;
             }
@@ -924,7 +1013,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                Implementation::Node & rootNode = implementation_->node(implementation_->root_);
 
                 rootNode.parent = htd::Vertex::UNKNOWN;
 
@@ -934,7 +1023,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                 {
                     htd::vertex_t child = *it;
 
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->node(child);
 
                     childNode.parent = implementation_->root_;
 
@@ -947,11 +1036,11 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
                     if (implementation_->root_ < child)
                     {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, implementation_->root_, child));
+                        implementation_->edges_->emplace_back(implementation_->next_edge_, implementation_->root_, child);
                     }
                     else
                     {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, implementation_->root_));
+                        implementation_->edges_->emplace_back(implementation_->next_edge_, child, implementation_->root_);
                     }
 
                     childNode.edges.emplace_back(implementation_->next_edge_);
@@ -961,7 +1050,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                     implementation_->next_edge_++;
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(implementation_->node(vertex));
 
                 break;
             }
@@ -995,7 +1084,7 @@ htd::vertex_t htd::Tree::insertRoot(void)
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
         implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->createNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1018,7 +1107,7 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 
         while (vertex != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & node = *(implementation_->nodes_[vertex]);
+            Implementation::Node & node = implementation_->node(vertex);
 
             nextVertex = node.parent;
 
@@ -1049,15 +1138,13 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->node(vertex);
 
     ret = implementation_->next_vertex_;
 
     node.children.emplace_back(ret);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
-
-    implementation_->nodes_.emplace(ret, newNode);
+    Implementation::Node & newNode = implementation_->createNode(ret, vertex);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -1065,11 +1152,11 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     implementation_->size_++;
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
+    implementation_->edges_->emplace_back(implementation_->next_edge_, vertex, ret);
 
     node.edges.push_back(implementation_->next_edge_);
 
-    newNode->edges.push_back(implementation_->next_edge_);
+    newNode.edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1081,7 +1168,7 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->node(vertex);
 
     auto & children = node.children;
 
@@ -1112,17 +1199,15 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = implementation_->nodes_.at(vertex);
+        auto & node = implementation_->node(vertex);
 
         ret = implementation_->next_vertex_;
 
-        node->parent = ret;
-
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        node.parent = ret;
 
-        newRootNode->children.emplace_back(vertex);
+        Implementation::Node & newRootNode = implementation_->createNode(ret, htd::Vertex::UNKNOWN);
 
-        implementation_->nodes_.emplace(ret, newRootNode);
+        newRootNode.children.emplace_back(vertex);
 
         implementation_->vertices_.emplace_back(ret);
 
@@ -1136,8 +1221,8 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
+        Implementation::Node & parentNode = implementation_->node(parentVertex);
+        Implementation::Node & selectedNode = implementation_->node(vertex);
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
@@ -1145,15 +1230,13 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         while (it != selectedNode.edges.end())
         {
-            auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
+            auto position = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
             HTD_ASSERT(position != implementation_->edges_->end())
 
-            if ((*position)->contains(parentVertex))
+            if (position->contains(parentVertex))
             {
-                oldHyperedge = (*position)->id();
-
-                delete *position;
+                oldHyperedge = position->id();
 
                 implementation_->edges_->erase(position);
 
@@ -1170,7 +1253,7 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
+        auto & intermediateNode = implementation_->node(ret);
 
         intermediateNode.parent = parentVertex;
 
@@ -1186,10 +1269,10 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
         selectedNode.parent = ret;
     }
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
+    implementation_->edges_->emplace_back(implementation_->next_edge_, vertex, ret);
 
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
+    implementation_->node(vertex).edges.push_back(implementation_->next_edge_);
+    implementation_->node(ret).edges.push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1202,17 +1285,17 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->node(vertex);
 
     htd::vertex_t oldParent = node.parent;
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
+        auto & newParentNode = implementation_->node(newParent);
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            auto & oldParentNode = implementation_->node(oldParent);
 
             oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
 
@@ -1222,15 +1305,13 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
 
             while (it != oldParentNode.edges.end())
             {
-                auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
+                auto position = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
                 HTD_ASSERT(position != implementation_->edges_->end())
 
-                if ((*position)->contains(vertex))
+                if (position->contains(vertex))
                 {
-                    oldHyperedge = (*position)->id();
-
-                    delete *position;
+                    oldHyperedge = position->id();
 
                     implementation_->edges_->erase(position);
 
@@ -1249,16 +1330,16 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->node(relevantVertex).parent != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->node(relevantVertex).parent;
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            auto & relevantNode = implementation_->node(relevantVertex);
 
             relevantNode.parent = htd::Vertex::UNKNOWN;
 
@@ -1270,15 +1351,13 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
 
             while (it != relevantNode.edges.end())
             {
-                auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
+                auto position = htd::hyperedgePosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
                 HTD_ASSERT(position != implementation_->edges_->end())
 
-                if ((*position)->contains(vertex))
+                if (position->contains(vertex))
                 {
-                    oldHyperedge = (*position)->id();
-
-                    delete *position;
+                    oldHyperedge = position->id();
 
                     implementation_->edges_->erase(position);
 
@@ -1306,11 +1385,11 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
 
         if (vertex < newParent)
         {
-            implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, newParent));
+            implementation_->edges_->emplace_back(implementation_->next_edge_, vertex, newParent);
         }
         else
         {
-            implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, newParent, vertex));
+            implementation_->edges_->emplace_back(implementation_->next_edge_, newParent, vertex);
         }
 
         implementation_->next_edge_++;
@@ -1323,7 +1402,7 @@ std::size_t htd::Tree::leafCount(void) const HTD_NOEXCEPT
 
     for (const auto & node : implementation_->nodes_)
     {
-        if (node.second->children.empty())
+        if (node.id != htd::Vertex::UNKNOWN && node.children.empty())
         {
             ret++;
         }
@@ -1345,9 +1424,9 @@ void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
     for (const auto & node : implementation_->nodes_)
     {
-        if (node.second->children.empty())
+        if (node.id != htd::Vertex::UNKNOWN && node.children.empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(node.id);
         }
     }
 
@@ -1371,20 +1450,20 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->node(vertex).children.empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->node(vertex);
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = implementation_->node(parent);
 
     node.parent = parentNode.parent;
 
@@ -1402,7 +1481,7 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = implementation_->node(grandParent);
 
         implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
 
@@ -1412,26 +1491,26 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     }
 }
 
-void htd::Tree::Implementation::deleteNode(Node * node)
+void htd::Tree::Implementation::deleteNode(Node & treeNode)
 {
-    HTD_ASSERT(node != nullptr)
+    htd::vertex_t parent = treeNode.parent;
 
-    auto & parent = node->parent;
-
-    htd::vertex_t vertex = node->id;
+    htd::vertex_t vertex = treeNode.id;
 
     if (parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        auto & children = node(parent).children;
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
 
     vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
 
-    nodes_.erase(vertex);
+    treeNode.id = htd::Vertex::UNKNOWN;
+    treeNode.parent = htd::Vertex::UNKNOWN;
 
-    delete node;
+    std::vector<htd::id_t>().swap(treeNode.edges);
+    std::vector<htd::vertex_t>().swap(treeNode.children);
 
     size_--;
 }
@@ -1496,12 +1575,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->nodes_ = original.implementation_->nodes_;
 
         implementation_->root_ = original.implementation_->root_;
 
@@ -1520,10 +1594,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
             implementation_->next_vertex_ = htd::Vertex::FIRST;
         }
 
-        for (htd::Hyperedge * edge : *(original.implementation_->edges_))
-        {
-            implementation_->edges_->push_back(new htd::Hyperedge(*edge));
-        }
+        *(implementation_->edges_) = *(original.implementation_->edges_);
 
         implementation_->next_edge_ = original.implementation_->next_edge_;
     }
@@ -1551,22 +1622,11 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
-                if (original.isRoot(vertex))
-                {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
-                }
-                else
-                {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
-                }
+                Implementation::Node & newNode = implementation_->createNode(vertex, original.isRoot(vertex) ? htd::Vertex::UNKNOWN : original.parent(vertex));
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
-                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
-
-                implementation_->nodes_.emplace(vertex, newNode);
+                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode.children));
 
                 if (vertex > maximumVertex)
                 {
@@ -1587,12 +1647,12 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             for (auto it = originalEdges.begin(); it != originalEdges.end(); ++it)
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(*it));
+                implementation_->edges_->emplace_back(*it);
             }
 
             if (!implementation_->edges_->empty())
             {
-                implementation_->next_edge_ = (*(implementation_->edges_->rbegin()))->id() + 1;
+                implementation_->next_edge_ = implementation_->edges_->rbegin()->id() + 1;
             }
         }
     }
@@ -1617,15 +1677,15 @@ void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node
 
     for (auto it = grandParentNode.edges.begin(); it != grandParentNode.edges.end() && relevantEdgePosition == edges_->end(); ++it)
     {
-        auto edgePosition = htd::hyperedgePointerPosition(edges_->begin(), edges_->end(), *it);
+        auto edgePosition = htd::hyperedgePosition(edges_->begin(), edges_->end(), *it);
 
-        if ((*edgePosition)->contains(parent))
+        if (edgePosition->contains(parent))
         {
             relevantEdgePosition = edgePosition;
         }
     }
 
-    htd::id_t oldEdgeId = (*relevantEdgePosition)->id();
+    htd::id_t oldEdgeId = relevantEdgePosition->id();
 
     parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldEdgeId));
 
@@ -1635,15 +1695,15 @@ void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node
 
     grandParentNode.edges.emplace_back(next_edge_);
 
-    (*relevantEdgePosition)->setId(next_edge_);
+    relevantEdgePosition->setId(next_edge_);
 
     if (vertex < grandParent)
     {
-        (*relevantEdgePosition)->setElements(vertex, grandParent);
+        relevantEdgePosition->setElements(vertex, grandParent);
     }
     else
     {
-        (*relevantEdgePosition)->setElements(grandParent, vertex);
+        relevantEdgePosition->setElements(grandParent, vertex);
     }
 
     ++next_edge_;
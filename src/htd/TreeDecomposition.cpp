@@ -36,43 +36,37 @@
 #include <stdexcept>
 #include <unordered_set>
 
-htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledTree::LabeledTree(manager), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const manager) : htd::LabeledTree::LabeledTree(manager), bagStorage_()
 {
 
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagStorage_(original.bagStorage_)
 {
 
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::LabeledTree::LabeledTree(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
+        bagStorage_.insert(vertex);
     }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) : htd::LabeledTree::LabeledTree(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
+        bagStorage_.insert(vertex);
     }
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(), inducedEdges_()
+htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagStorage_()
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
-
-        inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+        bagStorage_.insert(vertex, original.bagContent(vertex), original.inducedHyperedges(vertex));
     }
 }
 
@@ -85,9 +79,7 @@ void htd::TreeDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::Tree::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
-
-    inducedEdges_.erase(vertex);
+    bagStorage_.erase(vertex);
 }
 
 void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
@@ -101,9 +93,7 @@ void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        bagContent_.erase(vertex);
-
-        inducedEdges_.erase(vertex);
+        bagStorage_.erase(vertex);
     }, subtreeRoot);
 
     htd::Tree::removeSubtree(subtreeRoot);
@@ -117,9 +107,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(void)
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-        inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+        bagStorage_.insert(ret);
     }
 
     return ret;
@@ -133,9 +121,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(const std::vector<htd::vertex_t
 
     if (inserted)
     {
-        bagContent_[ret] = bagContent;
-
-        inducedEdges_[ret] = inducedEdges;
+        bagStorage_.insert(ret, bagContent, inducedEdges);
     }
 
     return ret;
@@ -149,9 +135,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::move(bagContent));
-
-        inducedEdges_.emplace(ret, std::move(inducedEdges));
+        bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
     }
 
     return ret;
@@ -161,9 +145,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    bagStorage_.insert(ret);
 
     return ret;
 }
@@ -172,9 +154,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, const std::
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    bagStorage_.insert(ret, bagContent, inducedEdges);
 
     return ret;
 }
@@ -183,9 +163,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
-
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
 
     return ret;
 }
@@ -194,9 +172,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
-
-    inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
+    bagStorage_.insert(ret);
 
     return ret;
 }
@@ -205,9 +181,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, const std:
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_[ret] = bagContent;
-
-    inducedEdges_[ret] = inducedEdges;
+    bagStorage_.insert(ret, bagContent, inducedEdges);
 
     return ret;
 }
@@ -216,9 +190,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
-
-    inducedEdges_.emplace(ret, std::move(inducedEdges));
+    bagStorage_.insert(ret, std::move(bagContent), std::move(inducedEdges));
 
     return ret;
 }
@@ -227,9 +199,7 @@ void htd::TreeDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
 {
     htd::Tree::removeChild(vertex, child);
 
-    bagContent_.erase(child);
-
-    inducedEdges_.erase(child);
+    bagStorage_.erase(child);
 }
 
 std::size_t htd::TreeDecomposition::joinNodeCount(void) const
@@ -516,35 +486,35 @@ std::size_t htd::TreeDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagStorage_.bagSize(vertex);
 }
 
 std::vector<htd::vertex_t> & htd::TreeDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagStorage_.bagContent(vertex);
 }
 
 const std::vector<htd::vertex_t> & htd::TreeDecomposition::bagContent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagStorage_.bagContent(vertex);
 }
 
 htd::FilteredHyperedgeCollection & htd::TreeDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return bagStorage_.inducedHyperedges(vertex);
 }
 
 const htd::FilteredHyperedgeCollection & htd::TreeDecomposition::inducedHyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return inducedEdges_.at(vertex);
+    return bagStorage_.inducedHyperedges(vertex);
 }
 
 std::size_t htd::TreeDecomposition::minimumBagSize(void) const
@@ -1087,11 +1057,11 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
     {
         htd::LabeledTree::operator=(original);
 
+        bagStorage_.clear();
+
         for (htd::vertex_t vertex : original.vertexVector())
         {
-            bagContent_[vertex] = original.bagContent(vertex);
-
-            inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+            bagStorage_.insert(vertex, original.bagContent(vertex), original.inducedHyperedges(vertex));
         }
     }
 
@@ -1104,11 +1074,11 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITree & or
     {
         htd::LabeledTree::operator=(original);
 
+        bagStorage_.clear();
+
         for (htd::vertex_t vertex : original.vertices())
         {
-            bagContent_[vertex] = std::vector<htd::vertex_t>();
-
-            inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
+            bagStorage_.insert(vertex);
         }
     }
 
@@ -1121,11 +1091,11 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ILabeledTr
     {
         htd::LabeledTree::operator=(original);
 
+        bagStorage_.clear();
+
         for (htd::vertex_t vertex : original.vertices())
         {
-            bagContent_[vertex] = std::vector<htd::vertex_t>();
-
-            inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
+            bagStorage_.insert(vertex);
         }
     }
 
@@ -1138,11 +1108,11 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITreeDecom
     {
         htd::LabeledTree::operator=(original);
 
+        bagStorage_.clear();
+
         for (htd::vertex_t vertex : original.vertices())
         {
-            bagContent_[vertex] = original.bagContent(vertex);
-
-            inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+            bagStorage_.insert(vertex, original.bagContent(vertex), original.inducedHyperedges(vertex));
         }
     }
 
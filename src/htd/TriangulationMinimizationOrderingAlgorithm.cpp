@@ -30,9 +30,8 @@
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
-#include <htd/IMutableGraph.hpp>
 #include <htd/IMutableMultiHypergraph.hpp>
-#include <htd/GraphFactory.hpp>
+#include <htd/CompactMultiHypergraph.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/VectorAdapter.hpp>
@@ -56,7 +55,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), triangulationAlgorithm_(new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(manager))
     {
 
     }
@@ -67,7 +66,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->clone())
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->clone()), triangulationAlgorithm_(original.triangulationAlgorithm_->clone())
     {
 
     }
@@ -77,7 +76,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->cloneOrderingAlgorithm())
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->cloneOrderingAlgorithm()), triangulationAlgorithm_(original.triangulationAlgorithm_->clone())
     {
 
     }
@@ -86,6 +85,7 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     virtual ~Implementation()
     {
         delete orderingAlgorithm_;
+        delete triangulationAlgorithm_;
     }
 
     /**
@@ -98,6 +98,11 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
      */
     htd::IOrderingAlgorithm * orderingAlgorithm_;
 
+    /**
+     *  The algorithm which shall be used to compute the minimal triangulations of the local graphs.
+     */
+    htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm * triangulationAlgorithm_;
+
     /**
      *  Internal data structure representing a triangulated graph.
      */
@@ -162,6 +167,11 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                 target.insert(target.end(), vertices_.begin(), vertices_.end());
             }
 
+            htd::ConstSpan<htd::vertex_t> vertexSpan(void) const HTD_OVERRIDE
+            {
+                return htd::ConstSpan<htd::vertex_t>(vertices_);
+            }
+
             htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(index < vertices_.size())
@@ -249,6 +259,15 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                 target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
             }
 
+            htd::ConstSpan<htd::vertex_t> neighborSpan(htd::vertex_t vertex, std::vector<htd::vertex_t> & buffer) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                HTD_UNUSED(buffer)
+
+                return htd::ConstSpan<htd::vertex_t>(neighborhood_[vertex]);
+            }
+
             htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
             {
                 HTD_ASSERT(isVertex(vertex))
@@ -660,29 +679,23 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                     }
                     else
                     {
-                        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+                        const htd::ConstSpan<htd::vertex_t> vertexCollection = graph.vertexSpan();
 
-                        auto position = vertexCollection.begin();
+                        std::vector<htd::vertex_t> neighborBuffer;
 
-                        for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
+                        for (htd::vertex_t vertex : vertexCollection)
                         {
-                            htd::vertex_t vertex = *position;
-
                             htd::vertex_t mappedVertex = registerVertex(vertex);
 
                             std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
 
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
-
-                            auto position2 = neighborCollection.begin();
+                            const htd::ConstSpan<htd::vertex_t> neighborCollection = graph.neighborSpan(vertex, neighborBuffer);
 
                             currentNeighborhood.reserve(neighborCollection.size() + 1);
 
-                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
+                            for (htd::vertex_t neighbor : neighborCollection)
                             {
-                                currentNeighborhood.push_back(registerVertex(*position2));
-
-                                ++position2;
+                                currentNeighborhood.push_back(registerVertex(neighbor));
                             }
 
                             std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
@@ -693,8 +706,6 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
                             {
                                 currentNeighborhood.erase(position3);
                             }
-
-                            ++position;
                         }
                     }
                 }
@@ -792,29 +803,23 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     /**
      *  Compute the set of fill edges which can be safely removed.
      *
-     *  @param[in] graph                    The input graph.
+     *  @param[in] graph                    The input graph. Its vertices must be htd::Vertex::FIRST, ..., htd::Vertex::FIRST + vertices.size() - 1.
      *  @param[in] candidateFillEdges       The fill edges which shall be checked.
      *  @param[in] vertices                 The actual identifier (as used for the candidate fill edges) of the vertices of the input graph.
      *  @param[in,out] redundantFillEdges   The vector of redundant fill edges which shall be updated.
      */
-    void computeRedundantFillEdges(const htd::IGraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & candidateFillEdges, const std::vector<htd::vertex_t> & vertices, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & redundantFillEdges) const
+    void computeRedundantFillEdges(const htd::IGraphStructure & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & candidateFillEdges, const std::vector<htd::vertex_t> & vertices, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & redundantFillEdges) const
     {
-        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(managementInstance_);
-
-        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
-
-        TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
-
-        delete ordering;
+        std::vector<htd::vertex_t> ordering;
 
         std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
+        triangulationAlgorithm_->computeMinimalTriangulation(graph, ordering, fillEdges);
+
+        for (std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
         {
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
-            {
-                fillEdges.push_back(std::make_pair(vertices[fillEdge.first], vertices[fillEdge.second]));
-            }
+            fillEdge.first = vertices[fillEdge.first - htd::Vertex::FIRST];
+            fillEdge.second = vertices[fillEdge.second - htd::Vertex::FIRST];
         }
 
         std::sort(fillEdges.begin(), fillEdges.end());
@@ -895,35 +900,42 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
             std::sort(relevantVertices.begin(), relevantVertices.end());
 
-            htd::IMutableGraph * localGraph = implementation_->managementInstance_->graphFactory().createInstance(relevantVertices.size());
+            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> localCandidateEdges;
 
-            std::unordered_map<htd::vertex_t, htd::vertex_t> localMapping;
-
-            htd::index_t localPosition = 1;
-
-            for (htd::vertex_t relevantVertex : relevantVertices)
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
             {
-                localMapping.emplace(relevantVertex, localPosition);
+                htd::vertex_t vertex1 = static_cast<htd::vertex_t>(std::distance(relevantVertices.begin(), std::lower_bound(relevantVertices.begin(), relevantVertices.end(), candidate.first)));
+                htd::vertex_t vertex2 = static_cast<htd::vertex_t>(std::distance(relevantVertices.begin(), std::lower_bound(relevantVertices.begin(), relevantVertices.end(), candidate.second)));
 
-                ++localPosition;
+                localCandidateEdges.emplace_back(std::min(vertex1, vertex2), std::max(vertex1, vertex2));
             }
 
-            for (auto it2 = relevantVertices.begin(); it2 != relevantVertices.end(); ++it2)
+            std::sort(localCandidateEdges.begin(), localCandidateEdges.end());
+
+            /* The local graph is the complete graph on the relevant vertices without the candidate edges. */
+            std::vector<htd::index_t> edgeOffsets(1, 0);
+
+            std::vector<htd::vertex_t> edgeElements;
+
+            for (htd::vertex_t vertex1 = 0; vertex1 < relevantVertices.size(); ++vertex1)
             {
-                for (auto it3 = it2 + 1; it3 != relevantVertices.end(); ++it3)
+                for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 < relevantVertices.size(); ++vertex2)
                 {
-                    localGraph->addEdge(localMapping.at(*it2), localMapping.at(*it3));
+                    if (!std::binary_search(localCandidateEdges.begin(), localCandidateEdges.end(), std::make_pair(vertex1, vertex2)))
+                    {
+                        edgeElements.push_back(vertex1 + htd::Vertex::FIRST);
+                        edgeElements.push_back(vertex2 + htd::Vertex::FIRST);
+
+                        edgeOffsets.push_back(edgeElements.size());
+                    }
                 }
             }
 
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
-            {
-                localGraph->removeEdge(localMapping.at(candidate.first), localMapping.at(candidate.second));
-            }
+            htd::CompactMultiHypergraph localGraph(implementation_->managementInstance_, relevantVertices.size(), std::move(edgeOffsets), std::move(edgeElements));
 
             std::vector<std::pair<htd::vertex_t, htd::vertex_t>> redundantFillEdges;
 
-            implementation_->computeRedundantFillEdges(*localGraph, candidateEdges, relevantVertices, redundantFillEdges);
+            implementation_->computeRedundantFillEdges(localGraph, candidateEdges, relevantVertices, redundantFillEdges);
 
             for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : redundantFillEdges)
             {
@@ -931,8 +943,6 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
                 fillEdgeRemoved = true;
             }
-
-            delete localGraph;
         }
 
         --position;
@@ -992,6 +1002,15 @@ void htd::TriangulationMinimizationOrderingAlgorithm::setOrderingAlgorithm(htd::
     implementation_->orderingAlgorithm_ = algorithm;
 }
 
+void htd::TriangulationMinimizationOrderingAlgorithm::setMinimalTriangulationAlgorithm(htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->triangulationAlgorithm_;
+
+    implementation_->triangulationAlgorithm_ = algorithm;
+}
+
 htd::TriangulationMinimizationOrderingAlgorithm * htd::TriangulationMinimizationOrderingAlgorithm::clone(void) const
 {
     return new htd::TriangulationMinimizationOrderingAlgorithm(*this);
@@ -344,7 +344,7 @@ void htd::TrivialTreeDecompositionAlgorithm::addManipulationOperations(const std
 
 bool htd::TrivialTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
 {
-    return false;
+    return implementation_->postProcessingOperations_.empty();
 }
 
 const htd::LibraryInstance * htd::TrivialTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
@@ -28,6 +28,7 @@
 #include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
 
+#include <htd/CancellationScope.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
@@ -45,7 +46,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1), timeLimit_(0)
     {
 
     }
@@ -57,7 +58,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
      */
     Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1), timeLimit_(0)
     {
 
     }
@@ -67,7 +68,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), timeLimit_(original.timeLimit_)
     {
 
     }
@@ -96,6 +97,11 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  The maximum number of iterations without improvement after which the algorithm shall terminate.
      */
     std::size_t nonImprovementLimit_;
+
+    /**
+     *  The wall-clock time limit of the algorithm (0=unlimited).
+     */
+    std::chrono::milliseconds timeLimit_;
 };
 
 htd::WidthMinimizingTreeDecompositionAlgorithm::WidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -139,6 +145,8 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -235,6 +243,8 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -271,6 +281,8 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::CancellationScope cancellationScope(implementation_->timeLimit_);
+
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
@@ -434,6 +446,16 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLimit(std:
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::chrono::milliseconds htd::WidthMinimizingTreeDecompositionAlgorithm::timeLimit(void) const
+{
+    return implementation_->timeLimit_;
+}
+
+void htd::WidthMinimizingTreeDecompositionAlgorithm::setTimeLimit(std::chrono::milliseconds timeLimit)
+{
+    implementation_->timeLimit_ = timeLimit;
+}
+
 bool htd::WidthMinimizingTreeDecompositionAlgorithm::isCompressionEnabled(void) const
 {
     return implementation_->algorithm_->isCompressionEnabled();
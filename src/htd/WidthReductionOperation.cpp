@@ -119,13 +119,15 @@ struct htd::WidthReductionOperation::Implementation
                     ++index;
                 }
 
+                std::vector<htd::vertex_t> neighborBuffer;
+
                 for (auto it = relevantVertices.begin(); it != relevantVertices.end();)
                 {
                     htd::vertex_t vertex = *it;
 
                     htd::vertex_t mappedVertex = baseGraphToInducedGraphMapping_.at(vertex) + 1;
 
-                    const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(vertex);
+                    const htd::ConstSpan<htd::vertex_t> currentNeighborhood = graph.neighborSpan(vertex, neighborBuffer);
 
                     std::vector<htd::vertex_t> relevantNeighbors;
 
@@ -666,9 +668,11 @@ bool htd::WidthReductionOperation::Implementation::isComplete(const htd::IGraphS
     std::vector<htd::vertex_t> vertices;
     graph.copyVerticesTo(vertices);
 
+    std::vector<htd::vertex_t> neighborBuffer;
+
     for (auto it = vertices.begin(); ret && it != vertices.end(); ++it)
     {
-        const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(*it);
+        const htd::ConstSpan<htd::vertex_t> currentNeighborhood = graph.neighborSpan(*it, neighborBuffer);
 
         ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
     }
@@ -0,0 +1,228 @@
+/*
+ * File:   BinaryTdFormatExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATEXPORTER_CPP
+#define HTD_IO_BINARYTDFORMATEXPORTER_CPP
+
+#include <htd_io/BinaryTdFormatExporter.hpp>
+#include <htd_io/BinaryTreeDecomposition.hpp>
+#include <htd_io/OutputBuffer.hpp>
+
+#include <htd/PostOrderTreeTraversal.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd_io::BinaryTdFormatExporter.
+ */
+struct htd_io::BinaryTdFormatExporter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : inducedEdgeExportEnabled_(false)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  A boolean flag indicating whether the IDs of the edges induced by the bags shall be written.
+     */
+    bool inducedEdgeExportEnabled_;
+
+    /**
+     *  Append the binary representation of a value to the given output buffer.
+     *
+     *  @param[in] value    The value which shall be appended.
+     *  @param[in] output   The output buffer.
+     */
+    template <typename T>
+    static void appendValue(T value, htd_io::OutputBuffer & output)
+    {
+        output.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    /**
+     *  Write a tree decomposition in the binary tree decomposition format 'btd' to the given output stream.
+     *
+     *  @param[in] decomposition    The tree decomposition which shall be written.
+     *  @param[in] vertexCount      The number of vertices of the decomposed graph.
+     *  @param[in] outputStream     The output stream to which the tree decomposition shall be written.
+     */
+    void write(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream) const
+    {
+        htd_io::OutputBuffer output(outputStream);
+
+        std::vector<htd::vertex_t> nodes;
+
+        std::vector<htd::vertex_t> parentNodes;
+
+        nodes.reserve(decomposition.vertexCount());
+
+        parentNodes.reserve(decomposition.vertexCount());
+
+        htd::PostOrderTreeTraversal traversal;
+
+        traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
+        {
+            HTD_UNUSED(distanceToRoot)
+
+            nodes.push_back(vertex);
+
+            parentNodes.push_back(parent);
+        });
+
+        HTD_ASSERT(nodes.size() < htd_io::BinaryTdFormatHeader::NO_PARENT)
+
+        std::vector<std::uint32_t> indices(nodes.empty() ? 0 : *std::max_element(nodes.begin(), nodes.end()) + 1, htd_io::BinaryTdFormatHeader::NO_PARENT);
+
+        htd_io::BinaryTdFormatHeader header;
+
+        std::memcpy(header.magic, htd_io::BinaryTdFormatHeader::MAGIC, sizeof(header.magic));
+
+        header.version = htd_io::BinaryTdFormatHeader::VERSION;
+        header.flags = inducedEdgeExportEnabled_ ? htd_io::BinaryTdFormatHeader::FLAG_INDUCED_EDGES : 0;
+        header.nodeCount = nodes.size();
+        header.vertexCount = vertexCount;
+        header.maximumBagSize = 0;
+        header.bagEntryCount = 0;
+        header.inducedEdgeEntryCount = 0;
+        header.reserved = 0;
+
+        for (htd::index_t index = 0; index < nodes.size(); ++index)
+        {
+            std::size_t bagSize = decomposition.bagSize(nodes[index]);
+
+            indices[nodes[index]] = static_cast<std::uint32_t>(index);
+
+            header.bagEntryCount += bagSize;
+
+            header.maximumBagSize = std::max(header.maximumBagSize, static_cast<std::uint64_t>(bagSize));
+
+            if (inducedEdgeExportEnabled_)
+            {
+                header.inducedEdgeEntryCount += decomposition.inducedHyperedges(nodes[index]).size();
+            }
+        }
+
+        output.append(reinterpret_cast<const char *>(&header), sizeof(header));
+
+        std::uint64_t offset = 0;
+
+        appendValue(offset, output);
+
+        for (htd::vertex_t node : nodes)
+        {
+            offset += decomposition.bagSize(node);
+
+            appendValue(offset, output);
+        }
+
+        if (inducedEdgeExportEnabled_)
+        {
+            offset = 0;
+
+            appendValue(offset, output);
+
+            for (htd::vertex_t node : nodes)
+            {
+                offset += decomposition.inducedHyperedges(node).size();
+
+                appendValue(offset, output);
+            }
+        }
+
+        for (htd::vertex_t parent : parentNodes)
+        {
+            appendValue(parent == htd::Vertex::UNKNOWN ? htd_io::BinaryTdFormatHeader::NO_PARENT : indices[parent], output);
+        }
+
+        for (htd::vertex_t node : nodes)
+        {
+            for (htd::vertex_t vertex : decomposition.bagContent(node))
+            {
+                HTD_ASSERT(vertex <= std::numeric_limits<std::uint32_t>::max())
+
+                appendValue(static_cast<std::uint32_t>(vertex), output);
+            }
+        }
+
+        if (inducedEdgeExportEnabled_)
+        {
+            for (htd::vertex_t node : nodes)
+            {
+                for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+                {
+                    HTD_ASSERT(hyperedge.id() <= std::numeric_limits<std::uint32_t>::max())
+
+                    appendValue(static_cast<std::uint32_t>(hyperedge.id()), output);
+                }
+            }
+        }
+
+        output.flush();
+    }
+};
+
+htd_io::BinaryTdFormatExporter::BinaryTdFormatExporter(void) : implementation_(new Implementation())
+{
+
+}
+
+htd_io::BinaryTdFormatExporter::~BinaryTdFormatExporter()
+{
+
+}
+
+void htd_io::BinaryTdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    implementation_->write(decomposition, graph.vertexCount(), outputStream);
+}
+
+void htd_io::BinaryTdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    implementation_->write(decomposition, graph.vertexCount(), outputStream);
+}
+
+bool htd_io::BinaryTdFormatExporter::isInducedEdgeExportEnabled(void) const
+{
+    return implementation_->inducedEdgeExportEnabled_;
+}
+
+void htd_io::BinaryTdFormatExporter::setInducedEdgeExportEnabled(bool inducedEdgeExportEnabled)
+{
+    implementation_->inducedEdgeExportEnabled_ = inducedEdgeExportEnabled;
+}
+
+#endif /* HTD_IO_BINARYTDFORMATEXPORTER_CPP */
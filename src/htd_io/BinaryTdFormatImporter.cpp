@@ -0,0 +1,149 @@
+/*
+ * File:   BinaryTdFormatImporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTDFORMATIMPORTER_CPP
+#define HTD_IO_BINARYTDFORMATIMPORTER_CPP
+
+#include <htd_io/BinaryTdFormatImporter.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HTD_IO_MEMORY_MAPPED_INPUT
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ *  Copy the content of a stream into a new storage block aligned to an 8-byte boundary
+ *  and create a binary tree decomposition on top of it.
+ *
+ *  @param[in] stream   The stream from which the decomposition shall be read.
+ *
+ *  @return A new decomposition object representing the content of the stream or nullptr if the stream does not contain a valid decomposition.
+ */
+static htd_io::BinaryTreeDecomposition * importBinaryTreeDecomposition(std::istream & stream)
+{
+    htd_io::BinaryTreeDecomposition * ret = nullptr;
+
+    std::vector<char> content;
+
+    char block[1 << 16];
+
+    while (stream.read(block, sizeof(block)) || stream.gcount() > 0)
+    {
+        content.insert(content.end(), block, block + stream.gcount());
+    }
+
+    std::size_t size = content.size();
+
+    if (size > 0)
+    {
+        std::uint64_t * data = new std::uint64_t[size / sizeof(std::uint64_t) + 1];
+
+        std::memcpy(data, content.data(), size);
+
+        if (htd_io::BinaryTreeDecomposition::isValid(data, size))
+        {
+            ret = new htd_io::BinaryTreeDecomposition(data, size, [](const void * storage, std::size_t storageSize)
+            {
+                HTD_UNUSED(storageSize)
+
+                delete[] static_cast<const std::uint64_t *>(storage);
+            });
+        }
+        else
+        {
+            delete[] data;
+        }
+    }
+
+    return ret;
+}
+
+htd_io::BinaryTdFormatImporter::BinaryTdFormatImporter(void)
+{
+
+}
+
+htd_io::BinaryTdFormatImporter::~BinaryTdFormatImporter()
+{
+
+}
+
+htd_io::BinaryTreeDecomposition * htd_io::BinaryTdFormatImporter::import(const std::string & path) const
+{
+#ifdef HTD_IO_MEMORY_MAPPED_INPUT
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor >= 0)
+    {
+        struct stat fileInformation;
+
+        if (fstat(fileDescriptor, &fileInformation) == 0 && S_ISREG(fileInformation.st_mode) && fileInformation.st_size > 0)
+        {
+            std::size_t size = static_cast<std::size_t>(fileInformation.st_size);
+
+            void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+            close(fileDescriptor);
+
+            if (data != MAP_FAILED)
+            {
+                if (htd_io::BinaryTreeDecomposition::isValid(data, size))
+                {
+                    return new htd_io::BinaryTreeDecomposition(data, size, [](const void * storage, std::size_t storageSize)
+                    {
+                        munmap(const_cast<void *>(storage), storageSize);
+                    });
+                }
+
+                munmap(data, size);
+            }
+
+            return nullptr;
+        }
+
+        close(fileDescriptor);
+    }
+#endif
+
+    std::ifstream stream(path, std::ios::binary);
+
+    return stream.is_open() ? importBinaryTreeDecomposition(stream) : nullptr;
+}
+
+htd_io::BinaryTreeDecomposition * htd_io::BinaryTdFormatImporter::import(std::istream & stream) const
+{
+    return importBinaryTreeDecomposition(stream);
+}
+
+#endif /* HTD_IO_BINARYTDFORMATIMPORTER_CPP */
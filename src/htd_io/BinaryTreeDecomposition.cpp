@@ -0,0 +1,367 @@
+/*
+ * File:   BinaryTreeDecomposition.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_BINARYTREEDECOMPOSITION_CPP
+#define HTD_IO_BINARYTREEDECOMPOSITION_CPP
+
+#include <htd_io/BinaryTreeDecomposition.hpp>
+
+#include <htd/IMutableTreeDecomposition.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+
+#include <cstring>
+#include <vector>
+
+const char htd_io::BinaryTdFormatHeader::MAGIC[8] = { 'H', 'T', 'D', 'B', 'T', 'D', '\0', '\0' };
+
+const std::uint32_t htd_io::BinaryTdFormatHeader::VERSION;
+
+const std::uint32_t htd_io::BinaryTdFormatHeader::FLAG_INDUCED_EDGES;
+
+const std::uint32_t htd_io::BinaryTdFormatHeader::NO_PARENT;
+
+/**
+ *  Private implementation details of class htd_io::BinaryTreeDecomposition.
+ */
+struct htd_io::BinaryTreeDecomposition::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] data     The storage holding the decomposition.
+     *  @param[in] size     The size of the storage in bytes.
+     *  @param[in] release  The function releasing the storage.
+     */
+    Implementation(const void * data, std::size_t size, const std::function<void(const void *, std::size_t)> & release) : data_(data), size_(size), release_(release), header_(static_cast<const htd_io::BinaryTdFormatHeader *>(data)), bagOffsets_(nullptr), inducedEdgeOffsets_(nullptr), parents_(nullptr), bagContents_(nullptr), inducedEdges_(nullptr)
+    {
+        std::size_t nodeCount = static_cast<std::size_t>(header_->nodeCount);
+
+        const char * position = static_cast<const char *>(data) + sizeof(htd_io::BinaryTdFormatHeader);
+
+        bagOffsets_ = reinterpret_cast<const std::uint64_t *>(position);
+
+        position += (nodeCount + 1) * sizeof(std::uint64_t);
+
+        if ((header_->flags & htd_io::BinaryTdFormatHeader::FLAG_INDUCED_EDGES) != 0)
+        {
+            inducedEdgeOffsets_ = reinterpret_cast<const std::uint64_t *>(position);
+
+            position += (nodeCount + 1) * sizeof(std::uint64_t);
+        }
+
+        parents_ = reinterpret_cast<const std::uint32_t *>(position);
+
+        position += nodeCount * sizeof(std::uint32_t);
+
+        bagContents_ = reinterpret_cast<const std::uint32_t *>(position);
+
+        position += header_->bagEntryCount * sizeof(std::uint32_t);
+
+        if (inducedEdgeOffsets_ != nullptr)
+        {
+            inducedEdges_ = reinterpret_cast<const std::uint32_t *>(position);
+        }
+    }
+
+    virtual ~Implementation()
+    {
+        if (release_)
+        {
+            release_(data_, size_);
+        }
+    }
+
+    /**
+     *  The storage holding the decomposition.
+     */
+    const void * data_;
+
+    /**
+     *  The size of the storage in bytes.
+     */
+    std::size_t size_;
+
+    /**
+     *  The function releasing the storage.
+     */
+    std::function<void(const void *, std::size_t)> release_;
+
+    /**
+     *  The header of the decomposition.
+     */
+    const htd_io::BinaryTdFormatHeader * header_;
+
+    /**
+     *  The bag offsets section.
+     */
+    const std::uint64_t * bagOffsets_;
+
+    /**
+     *  The induced edge offsets section or nullptr if the section is not present.
+     */
+    const std::uint64_t * inducedEdgeOffsets_;
+
+    /**
+     *  The parents section.
+     */
+    const std::uint32_t * parents_;
+
+    /**
+     *  The bag contents section.
+     */
+    const std::uint32_t * bagContents_;
+
+    /**
+     *  The induced edges section or nullptr if the section is not present.
+     */
+    const std::uint32_t * inducedEdges_;
+
+    /**
+     *  Check whether an offsets section is consistent.
+     *
+     *  @param[in] offsets      The offsets section.
+     *  @param[in] nodeCount    The number of nodes.
+     *  @param[in] entryCount   The total number of entries.
+     *
+     *  @return True if the offsets start at zero, are non-decreasing and end at the total number of entries, false otherwise.
+     */
+    static bool isValidOffsetSection(const std::uint64_t * offsets, std::size_t nodeCount, std::uint64_t entryCount)
+    {
+        bool ret = offsets[0] == 0 && offsets[nodeCount] == entryCount;
+
+        for (std::size_t index = 0; ret && index < nodeCount; ++index)
+        {
+            ret = offsets[index] <= offsets[index + 1];
+        }
+
+        return ret;
+    }
+};
+
+htd_io::BinaryTreeDecomposition::BinaryTreeDecomposition(const void * data, std::size_t size, const std::function<void(const void *, std::size_t)> & release) : implementation_(new Implementation(data, size, release))
+{
+    HTD_ASSERT(isValid(data, size))
+}
+
+htd_io::BinaryTreeDecomposition::~BinaryTreeDecomposition()
+{
+
+}
+
+const htd_io::BinaryTdFormatHeader & htd_io::BinaryTreeDecomposition::header(void) const
+{
+    return *(implementation_->header_);
+}
+
+std::size_t htd_io::BinaryTreeDecomposition::nodeCount(void) const
+{
+    return static_cast<std::size_t>(implementation_->header_->nodeCount);
+}
+
+std::size_t htd_io::BinaryTreeDecomposition::vertexCount(void) const
+{
+    return static_cast<std::size_t>(implementation_->header_->vertexCount);
+}
+
+std::size_t htd_io::BinaryTreeDecomposition::maximumBagSize(void) const
+{
+    return static_cast<std::size_t>(implementation_->header_->maximumBagSize);
+}
+
+std::uint32_t htd_io::BinaryTreeDecomposition::root(void) const
+{
+    return nodeCount() > 0 ? static_cast<std::uint32_t>(nodeCount() - 1) : htd_io::BinaryTdFormatHeader::NO_PARENT;
+}
+
+std::uint32_t htd_io::BinaryTreeDecomposition::parent(std::uint32_t node) const
+{
+    HTD_ASSERT(node < nodeCount())
+
+    return implementation_->parents_[node];
+}
+
+const std::uint32_t * htd_io::BinaryTreeDecomposition::parents(void) const
+{
+    return implementation_->parents_;
+}
+
+std::size_t htd_io::BinaryTreeDecomposition::bagSize(std::uint32_t node) const
+{
+    HTD_ASSERT(node < nodeCount())
+
+    return static_cast<std::size_t>(implementation_->bagOffsets_[node + 1] - implementation_->bagOffsets_[node]);
+}
+
+const std::uint32_t * htd_io::BinaryTreeDecomposition::bagContent(std::uint32_t node) const
+{
+    HTD_ASSERT(node < nodeCount())
+
+    return implementation_->bagContents_ + implementation_->bagOffsets_[node];
+}
+
+bool htd_io::BinaryTreeDecomposition::hasInducedEdges(void) const
+{
+    return implementation_->inducedEdgeOffsets_ != nullptr;
+}
+
+std::size_t htd_io::BinaryTreeDecomposition::inducedEdgeCount(std::uint32_t node) const
+{
+    HTD_ASSERT(node < nodeCount() && hasInducedEdges())
+
+    return static_cast<std::size_t>(implementation_->inducedEdgeOffsets_[node + 1] - implementation_->inducedEdgeOffsets_[node]);
+}
+
+const std::uint32_t * htd_io::BinaryTreeDecomposition::inducedEdges(std::uint32_t node) const
+{
+    HTD_ASSERT(node < nodeCount() && hasInducedEdges())
+
+    return implementation_->inducedEdges_ + implementation_->inducedEdgeOffsets_[node];
+}
+
+htd::ITreeDecomposition * htd_io::BinaryTreeDecomposition::toTreeDecomposition(const htd::LibraryInstance * const manager) const
+{
+    htd::IMutableTreeDecomposition * ret = manager->treeDecompositionFactory().createInstance();
+
+    std::size_t count = nodeCount();
+
+    if (count > 0)
+    {
+        const std::uint32_t * parentArray = implementation_->parents_;
+
+        std::vector<std::size_t> childOffsets(count + 1, 0);
+
+        for (std::size_t node = 0; node + 1 < count; ++node)
+        {
+            ++childOffsets[parentArray[node] + 1];
+        }
+
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            childOffsets[node + 1] += childOffsets[node];
+        }
+
+        std::vector<std::uint32_t> children(count > 1 ? count - 1 : 0);
+
+        std::vector<std::size_t> insertionPositions(childOffsets.begin(), childOffsets.end() - 1);
+
+        for (std::size_t node = 0; node + 1 < count; ++node)
+        {
+            children[insertionPositions[parentArray[node]]++] = static_cast<std::uint32_t>(node);
+        }
+
+        std::vector<htd::vertex_t> createdVertices(count, htd::Vertex::UNKNOWN);
+
+        std::vector<std::uint32_t> stack { root() };
+
+        while (!stack.empty())
+        {
+            std::uint32_t node = stack.back();
+
+            stack.pop_back();
+
+            const std::uint32_t * bagBegin = bagContent(node);
+
+            std::vector<htd::vertex_t> bag(bagBegin, bagBegin + bagSize(node));
+
+            if (node == root())
+            {
+                createdVertices[node] = ret->insertRoot(std::move(bag), htd::FilteredHyperedgeCollection());
+            }
+            else
+            {
+                createdVertices[node] = ret->addChild(createdVertices[parentArray[node]], std::move(bag), htd::FilteredHyperedgeCollection());
+            }
+
+            for (std::size_t index = childOffsets[node + 1]; index > childOffsets[node]; --index)
+            {
+                stack.push_back(children[index - 1]);
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool htd_io::BinaryTreeDecomposition::isValid(const void * data, std::size_t size)
+{
+    if (data == nullptr || size < sizeof(htd_io::BinaryTdFormatHeader) || reinterpret_cast<std::uintptr_t>(data) % sizeof(std::uint64_t) != 0)
+    {
+        return false;
+    }
+
+    const htd_io::BinaryTdFormatHeader * header = static_cast<const htd_io::BinaryTdFormatHeader *>(data);
+
+    if (std::memcmp(header->magic, htd_io::BinaryTdFormatHeader::MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != htd_io::BinaryTdFormatHeader::VERSION ||
+        (header->flags & ~htd_io::BinaryTdFormatHeader::FLAG_INDUCED_EDGES) != 0 ||
+        header->nodeCount >= htd_io::BinaryTdFormatHeader::NO_PARENT ||
+        header->bagEntryCount > size ||
+        header->inducedEdgeEntryCount > size)
+    {
+        return false;
+    }
+
+    bool inducedEdgesAvailable = (header->flags & htd_io::BinaryTdFormatHeader::FLAG_INDUCED_EDGES) != 0;
+
+    std::size_t nodeCount = static_cast<std::size_t>(header->nodeCount);
+
+    std::size_t requiredSize = sizeof(htd_io::BinaryTdFormatHeader) +
+                               (inducedEdgesAvailable ? 2 : 1) * (nodeCount + 1) * sizeof(std::uint64_t) +
+                               nodeCount * sizeof(std::uint32_t) +
+                               static_cast<std::size_t>(header->bagEntryCount) * sizeof(std::uint32_t) +
+                               (inducedEdgesAvailable ? static_cast<std::size_t>(header->inducedEdgeEntryCount) * sizeof(std::uint32_t) : 0);
+
+    if (requiredSize > size)
+    {
+        return false;
+    }
+
+    const std::uint64_t * bagOffsets = reinterpret_cast<const std::uint64_t *>(header + 1);
+
+    const std::uint64_t * inducedEdgeOffsets = inducedEdgesAvailable ? bagOffsets + nodeCount + 1 : nullptr;
+
+    const std::uint32_t * parents = reinterpret_cast<const std::uint32_t *>(bagOffsets + (inducedEdgesAvailable ? 2 : 1) * (nodeCount + 1));
+
+    bool ret = Implementation::isValidOffsetSection(bagOffsets, nodeCount, header->bagEntryCount);
+
+    if (ret && inducedEdgesAvailable)
+    {
+        ret = Implementation::isValidOffsetSection(inducedEdgeOffsets, nodeCount, header->inducedEdgeEntryCount);
+    }
+
+    for (std::size_t node = 0; ret && node + 1 < nodeCount; ++node)
+    {
+        ret = parents[node] > node && parents[node] < nodeCount;
+    }
+
+    if (ret && nodeCount > 0)
+    {
+        ret = parents[nodeCount - 1] == htd_io::BinaryTdFormatHeader::NO_PARENT;
+    }
+
+    return ret;
+}
+
+#endif /* HTD_IO_BINARYTREEDECOMPOSITION_CPP */
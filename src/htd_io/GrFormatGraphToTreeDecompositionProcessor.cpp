@@ -32,6 +32,7 @@
 #include <htd/main.hpp>
 
 #include <fstream>
+#include <memory>
 #include <stdexcept>
 
 /**
@@ -44,7 +45,7 @@ struct htd_io::GrFormatGraphToTreeDecompositionProcessor::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), exporter_(nullptr), preprocessor_(nullptr)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), exporter_(nullptr), preprocessor_(nullptr), cancellationToken_(nullptr)
     {
 
     }
@@ -77,6 +78,11 @@ struct htd_io::GrFormatGraphToTreeDecompositionProcessor::Implementation
      */
     htd::IGraphPreprocessor * preprocessor_;
 
+    /**
+     *  The cancellation token which is attached to the calling thread while the input graph is preprocessed and decomposed.
+     */
+    std::shared_ptr<htd::CancellationToken> cancellationToken_;
+
     /**
      *  A vector of callback functions which are invoked after parsing the input graph is finished.
      */
@@ -133,83 +139,49 @@ struct htd_io::GrFormatGraphToTreeDecompositionProcessor::Implementation
             callback(fitness);
         }
     }
-};
-
-htd_io::GrFormatGraphToTreeDecompositionProcessor::GrFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-
-}
-
-htd_io::GrFormatGraphToTreeDecompositionProcessor::~GrFormatGraphToTreeDecompositionProcessor(void)
-{
-
-}
-
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
-{
-    std::ifstream inputStream(inputFile);
-    std::ofstream outputStream(outputFile);
-
-    process(inputStream, outputStream);
-}
-
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
-{
-    std::ifstream inputStream(inputFile);
-
-    process(inputStream, outputStream);
-}
 
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
-{
-    std::ofstream outputStream(outputFile);
-
-    process(inputStream, outputStream);
-}
-
-void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
-{
-    htd_io::GrFormatImporter importer(implementation_->managementInstance_);
-
-    htd::IMultiGraph * graph = importer.import(inputStream);
-
-    if (graph != nullptr)
+    /**
+     *  Compute a decomposition of the given graph using the preprocessor and the algorithm provided by the management instance.
+     *
+     *  @param[in] graph    The graph which shall be decomposed.
+     *
+     *  @return A decomposition of the given graph or nullptr if no decomposition was computed.
+     */
+    htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const
     {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
-
-        htd::ITreeDecompositionAlgorithm * algorithm = implementation_->managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+        htd::ITreeDecompositionAlgorithm * algorithm = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
 
         htd::ITreeDecomposition * decomposition = nullptr;
 
-        if (implementation_->preprocessor_ != nullptr)
+        if (preprocessor_ != nullptr)
         {
-            htd::IPreprocessedGraph * preprocessedGraph = implementation_->preprocessor_->prepare(*graph);
+            htd::IPreprocessedGraph * preprocessedGraph = preprocessor_->prepare(graph);
 
             HTD_ASSERT(preprocessedGraph != nullptr)
 
-            implementation_->invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+            invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
 
             htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
 
             if (customizedAlgorithm != nullptr)
             {
-                decomposition = customizedAlgorithm->computeDecomposition(*graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
-                                                                                                          const htd::ITreeDecomposition & decomposition,
-                                                                                                          const htd::FitnessEvaluation & fitness)
+                decomposition = customizedAlgorithm->computeDecomposition(graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
+                                                                                                         const htd::ITreeDecomposition & decomposition,
+                                                                                                         const htd::FitnessEvaluation & fitness)
                 {
                     HTD_UNUSED(graph)
                     HTD_UNUSED(decomposition)
 
-                    implementation_->invokeDecompositionCallbacks(fitness);
+                    invokeDecompositionCallbacks(fitness);
                 });
             }
             else
             {
-                decomposition = algorithm->computeDecomposition(*graph, *preprocessedGraph);
+                decomposition = algorithm->computeDecomposition(graph, *preprocessedGraph);
 
                 if (decomposition != nullptr)
                 {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
                 }
             }
 
@@ -221,45 +193,109 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 
             if (customizedAlgorithm != nullptr)
             {
-                decomposition = customizedAlgorithm->computeDecomposition(*graph, [&](const htd::IMultiHypergraph & graph,
-                                                                                      const htd::ITreeDecomposition & decomposition,
-                                                                                      const htd::FitnessEvaluation & fitness)
+                decomposition = customizedAlgorithm->computeDecomposition(graph, [&](const htd::IMultiHypergraph & graph,
+                                                                                     const htd::ITreeDecomposition & decomposition,
+                                                                                     const htd::FitnessEvaluation & fitness)
                 {
                     HTD_UNUSED(graph)
                     HTD_UNUSED(decomposition)
 
-                    implementation_->invokeDecompositionCallbacks(fitness);
+                    invokeDecompositionCallbacks(fitness);
                 });
             }
             else
             {
-                decomposition = algorithm->computeDecomposition(*graph);
+                decomposition = algorithm->computeDecomposition(graph);
 
                 if (decomposition != nullptr)
                 {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
                 }
             }
         }
 
         delete algorithm;
 
-        if (decomposition != nullptr)
+        return decomposition;
+    }
+
+    /**
+     *  Decompose a given graph and write the resulting decomposition to the given output stream.
+     *
+     *  @param[in] graph        The graph which shall be decomposed. If it is nullptr, the parsing callbacks are informed about the parsing error.
+     *  @param[in] outputStream The output stream to which the resulting decomposition shall be written.
+     */
+    void process(htd::IMultiGraph * graph, std::ostream & outputStream) const
+    {
+        if (graph != nullptr)
         {
-            if (implementation_->exporter_ != nullptr)
+            invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
+
+            htd::ITreeDecomposition * decomposition = nullptr;
+
             {
-                implementation_->exporter_->write(*decomposition, *graph, outputStream);
+                htd::CancellationScope cancellationScope(cancellationToken_ != nullptr ? cancellationToken_ : htd::CancellationToken::current());
+
+                decomposition = computeDecomposition(*graph);
             }
 
-            delete decomposition;
-        }
+            if (decomposition != nullptr)
+            {
+                if (exporter_ != nullptr)
+                {
+                    exporter_->write(*decomposition, *graph, outputStream);
+                }
 
-        delete graph;
-    }
-    else
-    {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+                delete decomposition;
+            }
+
+            delete graph;
+        }
+        else
+        {
+            invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+        }
     }
+};
+
+htd_io::GrFormatGraphToTreeDecompositionProcessor::GrFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::GrFormatGraphToTreeDecompositionProcessor::~GrFormatGraphToTreeDecompositionProcessor(void)
+{
+
+}
+
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
+{
+    htd_io::GrFormatImporter importer(implementation_->managementInstance_);
+
+    std::ofstream outputStream(outputFile);
+
+    implementation_->process(importer.import(inputFile), outputStream);
+}
+
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
+{
+    htd_io::GrFormatImporter importer(implementation_->managementInstance_);
+
+    implementation_->process(importer.import(inputFile), outputStream);
+}
+
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
+{
+    std::ofstream outputStream(outputFile);
+
+    process(inputStream, outputStream);
+}
+
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
+{
+    htd_io::GrFormatImporter importer(implementation_->managementInstance_);
+
+    implementation_->process(importer.import(inputStream), outputStream);
 }
 
 void htd_io::GrFormatGraphToTreeDecompositionProcessor::setExporter(htd_io::ITreeDecompositionExporter * exporter)
@@ -282,6 +318,11 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGr
     implementation_->preprocessor_ = preprocessor;
 }
 
+void htd_io::GrFormatGraphToTreeDecompositionProcessor::setCancellationToken(const std::shared_ptr<htd::CancellationToken> & token)
+{
+    implementation_->cancellationToken_ = token;
+}
+
 void htd_io::GrFormatGraphToTreeDecompositionProcessor::registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback)
 {
     implementation_->parsingCallbacks_.push_back(callback);
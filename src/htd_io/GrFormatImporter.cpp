@@ -29,9 +29,21 @@
 
 #include <htd/MultiGraphFactory.hpp>
 
+#include <cstring>
 #include <fstream>
 #include <string>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HTD_IO_MEMORY_MAPPED_INPUT
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 /**
  *  Private implementation details of class htd_io::GrFormatImporter.
@@ -54,137 +66,450 @@ struct htd_io::GrFormatImporter::Implementation
     }
 
     /**
-     *  The management instance to which the current object instance belongs.
+     *  The number of bytes which are read at once from an input stream.
      */
-    const htd::LibraryInstance * managementInstance_;
-};
+    static const std::size_t BLOCK_SIZE = 1 << 20;
 
-htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
+    /**
+     *  Structure representing the state of the parser.
+     */
+    struct ParserState
+    {
+        /**
+         *  Constructor for the parser state.
+         */
+        ParserState(void) : remainingEdges(0), parsedLines(0), firstLine(true), error(false), terminated(false)
+        {
 
-}
+        }
 
-htd_io::GrFormatImporter::~GrFormatImporter(void)
-{
+        /**
+         *  The number of edges which are still expected according to the header line.
+         */
+        std::size_t remainingEdges;
 
-}
+        /**
+         *  The number of lines parsed so far.
+         */
+        std::size_t parsedLines;
 
-htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
-{
-    std::ifstream stream(path);
+        /**
+         *  A boolean flag indicating whether the header line was not parsed yet.
+         */
+        bool firstLine;
 
-    return import(stream);
-}
+        /**
+         *  A boolean flag indicating whether the input is malformed.
+         */
+        bool error;
 
-htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
-{
-    std::size_t vertexCount = 0;
-    std::size_t edgeCount = 0;
+        /**
+         *  A boolean flag indicating whether parsing was stopped because the management instance was terminated.
+         */
+        bool terminated;
+    };
 
-    bool firstLine = true;
+    /**
+     *  Parse a non-negative decimal integer in place.
+     *
+     *  @param[in,out] position The position of the first digit. After the call, it points to the first character after the integer.
+     *  @param[in] end          The end of the character range.
+     *  @param[out] value       The parsed value.
+     *
+     *  @return True if at least one digit was found, false otherwise.
+     */
+    static bool parseInteger(const char * & position, const char * end, std::size_t & value)
+    {
+        const char * begin = position;
+
+        std::size_t result = 0;
 
-    bool error = false;
+        while (position != end && static_cast<unsigned char>(*position - '0') < 10)
+        {
+            result = result * 10 + static_cast<std::size_t>(*position - '0');
 
-    htd::IMutableMultiGraph * ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+            ++position;
+        }
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+        value = result;
 
-    if (stream.good())
-    {
-        std::string line;
+        return position != begin;
+    }
 
-        std::size_t pos = 0;
+    /**
+     *  Parse a single line of the input.
+     *
+     *  @param[in] begin            The first character of the line.
+     *  @param[in] end              The end of the line, excluding the line break.
+     *  @param[in,out] state        The state of the parser.
+     *  @param[in] headerHandler    The function which is called with the number of vertices and edges declared in the header line.
+     *  @param[in] edgeHandler      The function which is called with the endpoints of each edge.
+     */
+    template <typename HeaderHandler, typename EdgeHandler>
+    void parseLine(const char * begin, const char * end, ParserState & state, HeaderHandler & headerHandler, EdgeHandler & edgeHandler) const
+    {
+        if (begin != end && *(end - 1) == '\r')
+        {
+            --end;
+        }
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        if (begin == end)
         {
-            if (line.empty())
+            state.error = true;
+        }
+        else if (*begin != 'c')
+        {
+            const char * position = begin;
+
+            if (state.firstLine)
             {
-                error = true;
+                std::size_t vertexCount = 0;
+                std::size_t edgeCount = 0;
+
+                if (end - begin > 5 && std::memcmp(begin, "p tw ", 5) == 0)
+                {
+                    position += 5;
+
+                    if (parseInteger(position, end, vertexCount) && position != end && *position == ' ' &&
+                        parseInteger(++position, end, edgeCount) && position == end)
+                    {
+                        headerHandler(vertexCount, edgeCount);
+
+                        state.remainingEdges = edgeCount;
+
+                        state.firstLine = false;
+                    }
+                    else
+                    {
+                        state.error = true;
+                    }
+                }
+                else
+                {
+                    state.error = true;
+                }
             }
             else
             {
-                if (line[line.size() - 1] == '\r')
+                std::size_t vertex1 = 0;
+                std::size_t vertex2 = 0;
+
+                if (parseInteger(position, end, vertex1) && position != end && *position == ' ' &&
+                    parseInteger(++position, end, vertex2) && position == end)
                 {
-                    line.pop_back();
-                }
+                    edgeHandler(static_cast<htd::vertex_t>(vertex1), static_cast<htd::vertex_t>(vertex2));
 
-                if (line[0] != 'c')
+                    state.remainingEdges--;
+                }
+                else
                 {
-                    if (firstLine)
-                    {
-                        if (line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
+                    state.error = true;
+                }
+            }
+        }
+    }
 
-                        line = line.substr(5);
+    /**
+     *  Parse all complete lines within a given character range.
+     *
+     *  @param[in] begin            The first character of the range.
+     *  @param[in] end              The end of the range.
+     *  @param[in,out] state        The state of the parser.
+     *  @param[in] headerHandler    The function which is called with the number of vertices and edges declared in the header line.
+     *  @param[in] edgeHandler      The function which is called with the endpoints of each edge.
+     *
+     *  @return The first character of the trailing incomplete line (or end if the range ends with a line break).
+     */
+    template <typename HeaderHandler, typename EdgeHandler>
+    const char * parseLines(const char * begin, const char * end, ParserState & state, HeaderHandler & headerHandler, EdgeHandler & edgeHandler) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-                        vertexCount = std::stol(line, &pos);
+        const char * lineBegin = begin;
 
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
+        const char * lineEnd = static_cast<const char *>(std::memchr(lineBegin, '\n', end - lineBegin));
 
-                        line = line.substr(pos + 1);
+        while (lineEnd != nullptr && !state.error && !state.terminated)
+        {
+            parseLine(lineBegin, lineEnd, state, headerHandler, edgeHandler);
 
-                        edgeCount = std::stol(line, &pos);
+            lineBegin = lineEnd + 1;
 
-                        if (pos != line.length())
-                        {
-                            error = true;
-                        }
+            lineEnd = static_cast<const char *>(std::memchr(lineBegin, '\n', end - lineBegin));
 
-                        ret->addVertices(vertexCount);
+            if ((++state.parsedLines & 0xFFF) == 0 && managementInstance.isTerminated())
+            {
+                state.terminated = true;
+            }
+        }
 
-                        firstLine = false;
-                    }
-                    else
-                    {
-                        htd::vertex_t vertex1 = std::stoul(line, &pos);
+        return lineBegin;
+    }
 
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(pos + 1);
+    /**
+     *  Finish parsing after the whole input was processed.
+     *
+     *  @param[in] begin            The first character of the trailing line without line break.
+     *  @param[in] end              The end of the trailing line.
+     *  @param[in,out] state        The state of the parser.
+     *  @param[in] headerHandler    The function which is called with the number of vertices and edges declared in the header line.
+     *  @param[in] edgeHandler      The function which is called with the endpoints of each edge.
+     *
+     *  @return True if the information could be parsed successfully, false otherwise.
+     */
+    template <typename HeaderHandler, typename EdgeHandler>
+    bool finish(const char * begin, const char * end, ParserState & state, HeaderHandler & headerHandler, EdgeHandler & edgeHandler) const
+    {
+        if (begin != end && !state.error && !state.terminated)
+        {
+            parseLine(begin, end, state, headerHandler, edgeHandler);
+        }
+
+        if (state.remainingEdges != 0 && !state.terminated && !managementInstance_->isTerminated())
+        {
+            state.error = true;
+        }
+
+        return !state.firstLine && !state.error;
+    }
 
-                            htd::vertex_t vertex2 = std::stoul(line, &pos);
+    /**
+     *  Parse the information from a given stream.
+     *
+     *  The stream is read in large blocks and the lines are parsed in place without any intermediate strings.
+     *
+     *  @param[in] stream           The input stream from which the information can be read.
+     *  @param[in] headerHandler    The function which is called with the number of vertices and edges declared in the header line.
+     *  @param[in] edgeHandler      The function which is called with the endpoints of each edge.
+     *
+     *  @return True if the information could be parsed successfully, false otherwise.
+     */
+    template <typename HeaderHandler, typename EdgeHandler>
+    bool parse(std::istream & stream, HeaderHandler && headerHandler, EdgeHandler && edgeHandler) const
+    {
+        if (!stream.good())
+        {
+            return false;
+        }
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+        ParserState state;
 
-                            ret->addEdge(vertex1, vertex2);
+        std::vector<char> buffer(BLOCK_SIZE);
 
-                            edgeCount--;
-                        }
-                    }
-                }
+        std::size_t carry = 0;
+
+        while (!state.error && !state.terminated && stream)
+        {
+            if (carry == buffer.size())
+            {
+                buffer.resize(2 * buffer.size());
             }
+
+            stream.read(buffer.data() + carry, static_cast<std::streamsize>(buffer.size() - carry));
+
+            const char * end = buffer.data() + carry + static_cast<std::size_t>(stream.gcount());
+
+            const char * remainder = parseLines(buffer.data(), end, state, headerHandler, edgeHandler);
+
+            carry = static_cast<std::size_t>(end - remainder);
+
+            std::memmove(buffer.data(), remainder, carry);
         }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
+        return finish(buffer.data(), buffer.data() + carry, state, headerHandler, edgeHandler);
+    }
+
+    /**
+     *  Parse the information stored in a given file.
+     *
+     *  If supported by the platform, the file is memory-mapped and parsed in place. Otherwise, it is read as a stream.
+     *
+     *  @param[in] path             The path to the file from which the information can be read.
+     *  @param[in] headerHandler    The function which is called with the number of vertices and edges declared in the header line.
+     *  @param[in] edgeHandler      The function which is called with the endpoints of each edge.
+     *
+     *  @return True if the information could be parsed successfully, false otherwise.
+     */
+    template <typename HeaderHandler, typename EdgeHandler>
+    bool parse(const std::string & path, HeaderHandler && headerHandler, EdgeHandler && edgeHandler) const
+    {
+#ifdef HTD_IO_MEMORY_MAPPED_INPUT
+        int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+        if (fileDescriptor >= 0)
         {
-            error = true;
+            struct stat fileInformation;
+
+            if (fstat(fileDescriptor, &fileInformation) == 0 && S_ISREG(fileInformation.st_mode) && fileInformation.st_size > 0)
+            {
+                std::size_t size = static_cast<std::size_t>(fileInformation.st_size);
+
+                void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+                if (data != MAP_FAILED)
+                {
+                    madvise(data, size, MADV_SEQUENTIAL);
+
+                    const char * begin = static_cast<const char *>(data);
+
+                    ParserState state;
+
+                    const char * remainder = parseLines(begin, begin + size, state, headerHandler, edgeHandler);
+
+                    bool ret = finish(remainder, begin + size, state, headerHandler, edgeHandler);
+
+                    munmap(data, size);
+
+                    close(fileDescriptor);
+
+                    return ret;
+                }
+            }
+
+            close(fileDescriptor);
         }
+#endif
+
+        std::ifstream stream(path, std::ios::binary);
+
+        return parse(stream, headerHandler, edgeHandler);
     }
-    else
+
+    /**
+     *  Create a new IMultiGraph instance based on the information from a given input.
+     *
+     *  The edges are collected in a flat vector and added to the graph in one step after parsing.
+     *
+     *  @param[in] input    The input stream or the path to the file from which the information can be read.
+     *
+     *  @return A new IMultiGraph instance based on the information from the given input or nullptr if the input is malformed.
+     */
+    template <typename Input>
+    htd::IMultiGraph * importGraph(Input & input) const
     {
-        error = true;
+        htd::IMutableMultiGraph * ret = managementInstance_->multiGraphFactory().createInstance();
+
+        std::size_t vertexCount = 0;
+
+        bool validVertices = true;
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+        bool success = parse(input,
+                             [&](std::size_t declaredVertexCount, std::size_t declaredEdgeCount)
+                             {
+                                 vertexCount = declaredVertexCount;
+
+                                 ret->addVertices(declaredVertexCount);
+
+                                 edges.reserve(declaredEdgeCount);
+                             },
+                             [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+                             {
+                                 validVertices = validVertices &&
+                                                 vertex1 >= htd::Vertex::FIRST && vertex1 < htd::Vertex::FIRST + vertexCount &&
+                                                 vertex2 >= htd::Vertex::FIRST && vertex2 < htd::Vertex::FIRST + vertexCount;
+
+                                 edges.emplace_back(vertex1, vertex2);
+                             });
+
+        if (success && validVertices)
+        {
+            ret->addEdges(edges);
+        }
+        else
+        {
+            delete ret;
+
+            ret = nullptr;
+        }
+
+        return ret;
     }
 
-    if (firstLine || error)
+    /**
+     *  Create a new, immutable htd::CompactMultiHypergraph instance based on the information from a given input.
+     *
+     *  @param[in] input    The input stream or the path to the file from which the information can be read.
+     *
+     *  @return A new htd::CompactMultiHypergraph instance based on the information from the given input or nullptr if the input is malformed.
+     */
+    template <typename Input>
+    htd::CompactMultiHypergraph * importCompactGraph(Input & input) const
     {
-        delete ret;
+        htd::CompactMultiHypergraph * ret = nullptr;
+
+        std::size_t vertexCount = 0;
+
+        bool validVertices = true;
+
+        std::vector<htd::index_t> edgeOffsets(1, 0);
+
+        std::vector<htd::vertex_t> edgeElements;
+
+        bool success = parse(input,
+                             [&](std::size_t declaredVertexCount, std::size_t declaredEdgeCount)
+                             {
+                                 vertexCount = declaredVertexCount;
 
-        ret = nullptr;
+                                 edgeOffsets.reserve(declaredEdgeCount + 1);
+
+                                 edgeElements.reserve(2 * declaredEdgeCount);
+                             },
+                             [&](htd::vertex_t vertex1, htd::vertex_t vertex2)
+                             {
+                                 validVertices = validVertices &&
+                                                 vertex1 >= htd::Vertex::FIRST && vertex1 < htd::Vertex::FIRST + vertexCount &&
+                                                 vertex2 >= htd::Vertex::FIRST && vertex2 < htd::Vertex::FIRST + vertexCount;
+
+                                 edgeElements.push_back(vertex1);
+                                 edgeElements.push_back(vertex2);
+
+                                 edgeOffsets.push_back(edgeElements.size());
+                             });
+
+        if (success && validVertices)
+        {
+            ret = new htd::CompactMultiHypergraph(managementInstance_, vertexCount, std::move(edgeOffsets), std::move(edgeElements));
+        }
+
+        return ret;
     }
-    
-    return ret;
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+};
+
+htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::GrFormatImporter::~GrFormatImporter(void)
+{
+
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
+{
+    return implementation_->importGraph(path);
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
+{
+    return implementation_->importGraph(stream);
+}
+
+htd::CompactMultiHypergraph * htd_io::GrFormatImporter::importCompact(const std::string & path) const
+{
+    return implementation_->importCompactGraph(path);
+}
+
+htd::CompactMultiHypergraph * htd_io::GrFormatImporter::importCompact(std::istream & stream) const
+{
+    return implementation_->importCompactGraph(stream);
 }
 
 #endif /* HTD_IO_GRFORMATIMPORTER_CPP */
@@ -32,6 +32,7 @@
 #include <fstream>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::HgrFormatImporter.
@@ -54,137 +55,164 @@ struct htd_io::HgrFormatImporter::Implementation
     }
 
     /**
-     *  The management instance to which the current object instance belongs.
+     *  Parse the information from a given stream.
+     *
+     *  @param[in] stream           The input stream from which the information can be read.
+     *  @param[in] headerHandler    The function which is called with the number of vertices and edges declared in the header line.
+     *  @param[in] edgeHandler      The function which is called with the endpoints of each hyperedge.
+     *
+     *  @return True if the information could be parsed successfully, false otherwise.
      */
-    const htd::LibraryInstance * managementInstance_;
-};
-
-htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-
-}
-
-htd_io::HgrFormatImporter::~HgrFormatImporter(void)
-{
-
-}
-
-htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
-{
-    std::ifstream stream(path);
-
-    return import(stream);
-}
-
-htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
-{
-    std::size_t vertexCount = 0;
-    std::size_t edgeCount = 0;
-
-    bool firstLine = true;
-
-    bool error = false;
+    template <typename HeaderHandler, typename EdgeHandler>
+    bool parse(std::istream & stream, HeaderHandler && headerHandler, EdgeHandler && edgeHandler) const
+    {
+        std::size_t vertexCount = 0;
+        std::size_t edgeCount = 0;
 
-    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+        bool firstLine = true;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+        bool error = false;
 
-    if (stream.good())
-    {
-        std::string line;
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        if (stream.good())
         {
-            if (line.empty())
-            {
-                error = true;
-            }
-            else
+            std::string line;
+
+            while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
             {
-                if (line[line.size() - 1] == '\r')
+                if (line.empty())
                 {
-                    line.pop_back();
+                    error = true;
                 }
-
-                if (line[0] != 'c')
+                else
                 {
-                    if (firstLine)
+                    if (line[line.size() - 1] == '\r')
                     {
-                        if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(5);
-
-                            std::size_t pos = 0;
-
-                            vertexCount = std::stol(line, &pos);
+                        line.pop_back();
+                    }
 
-                            if (line[pos] != ' ')
+                    if (line[0] != 'c')
+                    {
+                        if (firstLine)
+                        {
+                            if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
                             {
                                 error = true;
                             }
+                            else
+                            {
+                                line = line.substr(5);
 
-                            line = line.substr(pos + 1);
+                                std::size_t pos = 0;
 
-                            edgeCount = std::stol(line, &pos);
+                                vertexCount = std::stol(line, &pos);
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+                                if (line[pos] != ' ')
+                                {
+                                    error = true;
+                                }
 
-                            ret->addVertices(vertexCount);
+                                line = line.substr(pos + 1);
 
-                            firstLine = false;
-                        }
-                    }
-                    else
-                    {
-                        std::size_t pos = 0;
+                                edgeCount = std::stol(line, &pos);
+
+                                if (pos != line.length())
+                                {
+                                    error = true;
+                                }
 
-                        std::vector<htd::vertex_t> vertices;
+                                headerHandler(vertexCount, edgeCount);
 
-                        while (!error && pos != line.length())
+                                firstLine = false;
+                            }
+                        }
+                        else
                         {
-                            vertices.push_back(std::stoul(line, &pos));
+                            std::size_t pos = 0;
 
-                            if (pos != line.length())
+                            std::vector<htd::vertex_t> vertices;
+
+                            while (!error && pos != line.length())
                             {
-                                if (line[pos] != ' ')
-                                {
-                                    error = true;
-                                }
-                                else
-                                {
-                                    line = line.substr(pos + 1);
+                                vertices.push_back(std::stoul(line, &pos));
 
-                                    pos = 0;
+                                if (pos != line.length())
+                                {
+                                    if (line[pos] != ' ')
+                                    {
+                                        error = true;
+                                    }
+                                    else
+                                    {
+                                        line = line.substr(pos + 1);
+
+                                        pos = 0;
+                                    }
                                 }
                             }
-                        }
 
-                        ret->addEdge(std::move(vertices));
+                            edgeHandler(std::move(vertices));
 
-                        edgeCount--;
+                            edgeCount--;
+                        }
                     }
                 }
             }
-        }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
+            if (edgeCount != 0 && !managementInstance.isTerminated())
+            {
+                error = true;
+            }
+        }
+        else
         {
             error = true;
         }
+
+        return !firstLine && !error;
     }
-    else
-    {
-        error = true;
-    }
 
-    if (firstLine || error)
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+};
+
+htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::HgrFormatImporter::~HgrFormatImporter(void)
+{
+
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
+{
+    std::ifstream stream(path);
+
+    return import(stream);
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
+{
+    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+
+    bool success = implementation_->parse(stream,
+                                          [&](std::size_t vertexCount, std::size_t edgeCount)
+                                          {
+                                              HTD_UNUSED(edgeCount)
+
+                                              ret->addVertices(vertexCount);
+                                          },
+                                          [&](std::vector<htd::vertex_t> && vertices)
+                                          {
+                                              ret->addEdge(std::move(vertices));
+                                          });
+
+    if (!success)
     {
         delete ret;
 
@@ -194,4 +222,50 @@ htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream)
     return ret;
 }
 
+htd::CompactMultiHypergraph * htd_io::HgrFormatImporter::importCompact(const std::string & path) const
+{
+    std::ifstream stream(path);
+
+    return importCompact(stream);
+}
+
+htd::CompactMultiHypergraph * htd_io::HgrFormatImporter::importCompact(std::istream & stream) const
+{
+    htd::CompactMultiHypergraph * ret = nullptr;
+
+    std::size_t vertexCount = 0;
+
+    bool validVertices = true;
+
+    std::vector<htd::index_t> edgeOffsets(1, 0);
+
+    std::vector<htd::vertex_t> edgeElements;
+
+    bool success = implementation_->parse(stream,
+                                          [&](std::size_t declaredVertexCount, std::size_t declaredEdgeCount)
+                                          {
+                                              vertexCount = declaredVertexCount;
+
+                                              edgeOffsets.reserve(declaredEdgeCount + 1);
+                                          },
+                                          [&](std::vector<htd::vertex_t> && vertices)
+                                          {
+                                              for (htd::vertex_t vertex : vertices)
+                                              {
+                                                  validVertices = validVertices && vertex >= htd::Vertex::FIRST && vertex < htd::Vertex::FIRST + vertexCount;
+                                              }
+
+                                              edgeElements.insert(edgeElements.end(), vertices.begin(), vertices.end());
+
+                                              edgeOffsets.push_back(edgeElements.size());
+                                          });
+
+    if (success && validVertices)
+    {
+        ret = new htd::CompactMultiHypergraph(implementation_->managementInstance_, vertexCount, std::move(edgeOffsets), std::move(edgeElements));
+    }
+
+    return ret;
+}
+
 #endif /* HTD_IO_HGRFORMATIMPORTER_CPP */
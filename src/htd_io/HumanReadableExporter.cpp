@@ -29,6 +29,8 @@
 
 #include <htd/PreOrderTreeTraversal.hpp>
 
+#include <htd_io/OutputBuffer.hpp>
+
 htd_io::HumanReadableExporter::HumanReadableExporter(void)
 {
 
@@ -39,108 +41,122 @@ htd_io::HumanReadableExporter::~HumanReadableExporter()
 
 }
 
-void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outputStream)
+void printBagContent(const std::vector<htd::vertex_t> & bag, htd_io::OutputBuffer & output)
 {
-    outputStream << "[ ";
+    output.append("[ ");
 
     if (bag.empty())
     {
-        outputStream << "]";
+        output.append(']');
     }
     else
     {
         for (htd::index_t index = 0; index < bag.size(); ++index)
         {
-            outputStream << bag.at(index);
+            output.append(bag[index]);
 
             if (index < bag.size() - 1)
             {
-                outputStream << ", ";
+                output.append(", ");
             }
         }
 
-        outputStream << " ]";
+        output.append(" ]");
     }
 }
 
-void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outputStream, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+void printBagContent(const std::vector<htd::vertex_t> & bag, htd_io::OutputBuffer & output, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
 {
-    outputStream << "[ ";
+    output.append("[ ");
 
     if (bag.empty())
     {
-        outputStream << "]";
+        output.append(']');
     }
     else
     {
         for (htd::index_t index = 0; index < bag.size(); ++index)
         {
-            outputStream << graph.vertexName(bag.at(index));
+            output.append(graph.vertexName(bag[index]));
 
             if (index < bag.size() - 1)
             {
-                outputStream << ", ";
+                output.append(", ");
             }
         }
 
-        outputStream << " ]";
+        output.append(" ]");
     }
 }
 
-void printHyperedge(const htd::Hyperedge & hyperedge, std::ostream & outputStream)
+void printEdgeContent(const std::vector<htd::vertex_t> & elements, htd_io::OutputBuffer & output)
 {
-    outputStream << "HYPEREDGE " << hyperedge.id() << ": [ ";
+    if (elements.empty())
+    {
+        output.append("<EMPTY>");
+    }
+    else
+    {
+        printBagContent(elements, output);
+    }
+}
+
+void printHyperedge(const htd::Hyperedge & hyperedge, htd_io::OutputBuffer & output)
+{
+    output.append("HYPEREDGE ").append(hyperedge.id()).append(": [ ");
 
     const std::vector<htd::vertex_t> & elements = hyperedge.elements();
 
     if (elements.empty())
     {
-        outputStream << "]";
+        output.append(']');
     }
     else
     {
         for (htd::index_t index = 0; index < elements.size(); ++index)
         {
-            outputStream << elements.at(index);
+            output.append(elements[index]);
 
             if (index < elements.size() - 1)
             {
-                outputStream << ", ";
+                output.append(", ");
             }
         }
 
-        outputStream << " ]";
+        output.append(" ]");
     }
 }
 
-void printHyperedge(const htd::Hyperedge & hyperedge, std::ostream & outputStream, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+void printHyperedge(const htd::Hyperedge & hyperedge, htd_io::OutputBuffer & output, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
 {
-    outputStream << "HYPEREDGE " << hyperedge.id() << ": [ ";
+    output.append("HYPEREDGE ").append(hyperedge.id()).append(": [ ");
 
     const std::vector<htd::vertex_t> & elements = hyperedge.elements();
 
     if (elements.empty())
     {
-        outputStream << "]";
+        output.append(']');
     }
     else
     {
         for (htd::index_t index = 0; index < elements.size(); ++index)
         {
-            outputStream << graph.vertexName(elements.at(index));
+            output.append(graph.vertexName(elements[index]));
 
             if (index < elements.size() - 1)
             {
-                outputStream << ", ";
+                output.append(", ");
             }
         }
 
-        outputStream << " ]";
+        output.append(" ]");
     }
 }
 
 void htd_io::HumanReadableExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
 {
+    htd_io::OutputBuffer output(outputStream);
+
     htd::PreOrderTreeTraversal traversal;
 
     HTD_UNUSED(graph)
@@ -151,19 +167,23 @@ void htd_io::HumanReadableExporter::write(const htd::ITreeDecomposition & decomp
 
         for (htd::index_t index = 0; index < distanceToRoot; ++index)
         {
-            outputStream << "  ";
+            output.append("  ");
         }
 
-        outputStream << "NODE " << vertex << ": ";
+        output.append("NODE ").append(vertex).append(": ");
 
-        printBagContent(decomposition.bagContent(vertex), outputStream);
+        printBagContent(decomposition.bagContent(vertex), output);
 
-        outputStream << std::endl;
+        output.append('\n');
     });
+
+    output.flush();
 }
 
 void htd_io::HumanReadableExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
+    htd_io::OutputBuffer output(outputStream);
+
     htd::PreOrderTreeTraversal traversal;
 
     traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
@@ -172,19 +192,23 @@ void htd_io::HumanReadableExporter::write(const htd::ITreeDecomposition & decomp
 
         for (htd::index_t index = 0; index < distanceToRoot; ++index)
         {
-            outputStream << "   ";
+            output.append("   ");
         }
 
-        outputStream << "NODE " << vertex << ": ";
+        output.append("NODE ").append(vertex).append(": ");
 
-        printBagContent(decomposition.bagContent(vertex), outputStream, graph);
+        printBagContent(decomposition.bagContent(vertex), output, graph);
 
-        outputStream << std::endl;
+        output.append('\n');
     });
+
+    output.flush();
 }
 
 void htd_io::HumanReadableExporter::write(const htd::IHypertreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
 {
+    htd_io::OutputBuffer output(outputStream);
+
     htd::PreOrderTreeTraversal traversal;
 
     HTD_UNUSED(graph)
@@ -195,36 +219,44 @@ void htd_io::HumanReadableExporter::write(const htd::IHypertreeDecomposition & d
 
         for (htd::index_t index = 0; index < distanceToRoot; ++index)
         {
-            outputStream << "  ";
+            output.append("  ");
         }
 
-        outputStream << "NODE " << vertex << ": ";
+        output.append("NODE ").append(vertex).append(": ");
 
-        printBagContent(decomposition.bagContent(vertex), outputStream);
+        printBagContent(decomposition.bagContent(vertex), output);
 
-        outputStream << std::endl;
+        output.append('\n');
 
         for (htd::index_t index = 0; index < distanceToRoot + 1; ++index)
         {
-            outputStream << "  ";
+            output.append("  ");
         }
 
-        outputStream << "COVERING EDGES: " << std::endl;
+        output.append("COVERING EDGES: \n");
 
         for (const htd::Hyperedge & edge : decomposition.coveringEdges(vertex))
         {
             for (htd::index_t index = 0; index < distanceToRoot + 2; ++index)
             {
-                outputStream << "  ";
+                output.append("  ");
             }
 
-            outputStream << "HYPEREDGE " << edge.id() << ": " << edge.elements() << std::endl;
+            output.append("HYPEREDGE ").append(edge.id()).append(": ");
+
+            printEdgeContent(edge.elements(), output);
+
+            output.append('\n');
         }
     });
+
+    output.flush();
 }
 
 void htd_io::HumanReadableExporter::write(const htd::IHypertreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
+    htd_io::OutputBuffer output(outputStream);
+
     htd::PreOrderTreeTraversal traversal;
 
     traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
@@ -233,32 +265,38 @@ void htd_io::HumanReadableExporter::write(const htd::IHypertreeDecomposition & d
 
         for (htd::index_t index = 0; index < distanceToRoot; ++index)
         {
-            outputStream << "   ";
+            output.append("   ");
         }
 
-        outputStream << "NODE " << vertex << ": ";
+        output.append("NODE ").append(vertex).append(": ");
 
-        printBagContent(decomposition.bagContent(vertex), outputStream, graph);
+        printBagContent(decomposition.bagContent(vertex), output, graph);
 
-        outputStream << std::endl;
+        output.append('\n');
 
         for (htd::index_t index = 0; index < distanceToRoot + 1; ++index)
         {
-            outputStream << "  ";
+            output.append("  ");
         }
 
-        outputStream << "COVERING EDGES: " << std::endl;
+        output.append("COVERING EDGES: \n");
 
         for (const htd::Hyperedge & edge : decomposition.coveringEdges(vertex))
         {
             for (htd::index_t index = 0; index < distanceToRoot + 2; ++index)
             {
-                outputStream << "  ";
+                output.append("  ");
             }
 
-            outputStream << "HYPEREDGE " << edge.id() << ": " << edge.elements() << std::endl;
+            output.append("HYPEREDGE ").append(edge.id()).append(": ");
+
+            printEdgeContent(edge.elements(), output);
+
+            output.append('\n');
         }
     });
+
+    output.flush();
 }
 
 #endif /* HTD_IO_HUMANREADABLEEXPORTER_CPP */
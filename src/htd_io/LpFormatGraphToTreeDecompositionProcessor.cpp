@@ -32,6 +32,7 @@
 #include <htd/main.hpp>
 
 #include <fstream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
@@ -45,7 +46,7 @@ struct htd_io::LpFormatGraphToTreeDecompositionProcessor::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), exporter_(nullptr), preprocessor_(nullptr)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), exporter_(nullptr), preprocessor_(nullptr), cancellationToken_(nullptr)
     {
 
     }
@@ -78,6 +79,11 @@ struct htd_io::LpFormatGraphToTreeDecompositionProcessor::Implementation
      */
     htd::IGraphPreprocessor * preprocessor_;
 
+    /**
+     *  The cancellation token which is attached to the calling thread while the input graph is preprocessed and decomposed.
+     */
+    std::shared_ptr<htd::CancellationToken> cancellationToken_;
+
     /**
      *  A vector of callback functions which are invoked after parsing the input graph is finished.
      */
@@ -134,83 +140,49 @@ struct htd_io::LpFormatGraphToTreeDecompositionProcessor::Implementation
             callback(fitness);
         }
     }
-};
-
-htd_io::LpFormatGraphToTreeDecompositionProcessor::LpFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-
-}
-
-htd_io::LpFormatGraphToTreeDecompositionProcessor::~LpFormatGraphToTreeDecompositionProcessor(void)
-{
-
-}
-
-void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
-{
-    std::ifstream inputStream(inputFile);
-    std::ofstream outputStream(outputFile);
-
-    process(inputStream, outputStream);
-}
-
-void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
-{
-    std::ifstream inputStream(inputFile);
 
-    process(inputStream, outputStream);
-}
-
-void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
-{
-    std::ofstream outputStream(outputFile);
-
-    process(inputStream, outputStream);
-}
-
-void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
-{
-    htd_io::LpFormatImporter importer(implementation_->managementInstance_);
-
-    htd::NamedMultiHypergraph<std::string, std::string> * graph = importer.import(inputStream);
-
-    if (graph != nullptr)
+    /**
+     *  Compute a decomposition of the given graph using the preprocessor and the algorithm provided by the management instance.
+     *
+     *  @param[in] graph    The graph which shall be decomposed.
+     *
+     *  @return A decomposition of the given graph or nullptr if no decomposition was computed.
+     */
+    htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const
     {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
-
-        htd::ITreeDecompositionAlgorithm * algorithm = implementation_->managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+        htd::ITreeDecompositionAlgorithm * algorithm = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
 
         htd::ITreeDecomposition * decomposition = nullptr;
 
-        if (implementation_->preprocessor_ != nullptr)
+        if (preprocessor_ != nullptr)
         {
-            htd::IPreprocessedGraph * preprocessedGraph = implementation_->preprocessor_->prepare(graph->internalGraph());
+            htd::IPreprocessedGraph * preprocessedGraph = preprocessor_->prepare(graph);
 
             HTD_ASSERT(preprocessedGraph != nullptr)
 
-            implementation_->invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+            invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
 
             htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
 
             if (customizedAlgorithm != nullptr)
             {
-                decomposition = customizedAlgorithm->computeDecomposition(graph->internalGraph(), *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
-                                                                                                                          const htd::ITreeDecomposition & decomposition,
-                                                                                                                          const htd::FitnessEvaluation & fitness)
+                decomposition = customizedAlgorithm->computeDecomposition(graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
+                                                                                                         const htd::ITreeDecomposition & decomposition,
+                                                                                                         const htd::FitnessEvaluation & fitness)
                 {
                     HTD_UNUSED(graph)
                     HTD_UNUSED(decomposition)
 
-                    implementation_->invokeDecompositionCallbacks(fitness);
+                    invokeDecompositionCallbacks(fitness);
                 });
             }
             else
             {
-                decomposition = algorithm->computeDecomposition(graph->internalGraph(), *preprocessedGraph);
+                decomposition = algorithm->computeDecomposition(graph, *preprocessedGraph);
 
                 if (decomposition != nullptr)
                 {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
                 }
             }
 
@@ -222,29 +194,83 @@ void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 
             if (customizedAlgorithm != nullptr)
             {
-                decomposition = customizedAlgorithm->computeDecomposition(graph->internalGraph(), [&](const htd::IMultiHypergraph & graph,
-                                                                                                      const htd::ITreeDecomposition & decomposition,
-                                                                                                      const htd::FitnessEvaluation & fitness)
+                decomposition = customizedAlgorithm->computeDecomposition(graph, [&](const htd::IMultiHypergraph & graph,
+                                                                                     const htd::ITreeDecomposition & decomposition,
+                                                                                     const htd::FitnessEvaluation & fitness)
                 {
                     HTD_UNUSED(graph)
                     HTD_UNUSED(decomposition)
 
-                    implementation_->invokeDecompositionCallbacks(fitness);
+                    invokeDecompositionCallbacks(fitness);
                 });
             }
             else
             {
-                decomposition = algorithm->computeDecomposition(graph->internalGraph());
+                decomposition = algorithm->computeDecomposition(graph);
 
                 if (decomposition != nullptr)
                 {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
                 }
             }
         }
 
         delete algorithm;
 
+        return decomposition;
+    }
+};
+
+htd_io::LpFormatGraphToTreeDecompositionProcessor::LpFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::LpFormatGraphToTreeDecompositionProcessor::~LpFormatGraphToTreeDecompositionProcessor(void)
+{
+
+}
+
+void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
+{
+    std::ifstream inputStream(inputFile);
+    std::ofstream outputStream(outputFile);
+
+    process(inputStream, outputStream);
+}
+
+void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
+{
+    std::ifstream inputStream(inputFile);
+
+    process(inputStream, outputStream);
+}
+
+void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
+{
+    std::ofstream outputStream(outputFile);
+
+    process(inputStream, outputStream);
+}
+
+void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, std::ostream & outputStream) const
+{
+    htd_io::LpFormatImporter importer(implementation_->managementInstance_);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importer.import(inputStream);
+
+    if (graph != nullptr)
+    {
+        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
+
+        htd::ITreeDecomposition * decomposition = nullptr;
+
+        {
+            htd::CancellationScope cancellationScope(implementation_->cancellationToken_ != nullptr ? implementation_->cancellationToken_ : htd::CancellationToken::current());
+
+            decomposition = implementation_->computeDecomposition(graph->internalGraph());
+        }
+
         if (decomposition != nullptr)
         {
             if (implementation_->exporter_ != nullptr)
@@ -283,6 +309,11 @@ void htd_io::LpFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGr
     implementation_->preprocessor_ = preprocessor;
 }
 
+void htd_io::LpFormatGraphToTreeDecompositionProcessor::setCancellationToken(const std::shared_ptr<htd::CancellationToken> & token)
+{
+    implementation_->cancellationToken_ = token;
+}
+
 void htd_io::LpFormatGraphToTreeDecompositionProcessor::registerParsingCallback(const std::function<void(htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount)> & callback)
 {
     implementation_->parsingCallbacks_.push_back(callback);
@@ -27,47 +27,46 @@
 
 #include <htd_io/TdFormatExporter.hpp>
 
-#include <sstream>
-#include <unordered_map>
+#include <htd_io/OutputBuffer.hpp>
 
-htd_io::TdFormatExporter::TdFormatExporter(void)
-{
-
-}
+#include <algorithm>
+#include <vector>
 
-htd_io::TdFormatExporter::~TdFormatExporter()
-{
-
-}
-
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+/**
+ *  Write a tree decomposition in the tree decomposition format 'td' to the given output stream.
+ *
+ *  @param[in] decomposition    The tree decomposition which shall be written.
+ *  @param[in] vertexCount      The number of vertices of the decomposed graph.
+ *  @param[in] outputStream     The output stream to which the tree decomposition shall be written.
+ */
+static void writeTdFormat(const htd::ITreeDecomposition & decomposition, std::size_t vertexCount, std::ostream & outputStream)
 {
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
+    htd_io::OutputBuffer output(outputStream);
 
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
+    output.append("s td ").append(decomposition.vertexCount()).append(' ').append(decomposition.maximumBagSize()).append(' ').append(vertexCount).append('\n');
 
     if (decomposition.vertexCount() > 0)
     {
-        std::size_t index = 1;
+        const htd::ConstSpan<htd::vertex_t> nodes = decomposition.vertexSpan();
+
+        htd::vertex_t maximumNode = *std::max_element(nodes.begin(), nodes.end());
 
-        std::stringstream tmpStream;
+        std::vector<std::size_t> indices(maximumNode - htd::Vertex::FIRST + 1, 0);
 
-        for (htd::vertex_t node : decomposition.vertices())
+        std::size_t index = 1;
+
+        for (htd::vertex_t node : nodes)
         {
-            tmpStream << "b " << index << " ";
+            output.append("b ").append(index).append(' ');
 
-            indices.emplace(node, index);
+            indices[node - htd::Vertex::FIRST] = index;
 
             for (htd::vertex_t vertex : decomposition.bagContent(node))
             {
-                tmpStream << vertex << " ";
+                output.append(vertex).append(' ');
             }
 
-            tmpStream << "\n" << std::flush;
-
-            outputStream << tmpStream.rdbuf();
-
-            tmpStream.clear();
+            output.append('\n');
 
             ++index;
         }
@@ -80,64 +79,31 @@ void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decompositi
 
         for (htd::index_t index = 0; index < edgeCount; ++index)
         {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
-
-            outputStream << vertex1 << " " << vertex2 << "\n";
+            output.append(indices[(*it)[0] - htd::Vertex::FIRST]).append(' ').append(indices[(*it)[1] - htd::Vertex::FIRST]).append('\n');
 
             ++it;
         }
     }
 }
 
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+htd_io::TdFormatExporter::TdFormatExporter(void)
 {
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
-
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
-
-    if (decomposition.vertexCount() > 0)
-    {
-        std::size_t index = 1;
-
-        std::stringstream tmpStream;
-
-        for (htd::vertex_t node : decomposition.vertices())
-        {
-            tmpStream << "b " << index << " ";
 
-            indices.emplace(node, index);
-
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
-            {
-                tmpStream << vertex << " ";
-            }
-
-            tmpStream << "\n" << std::flush;
-
-            outputStream << tmpStream.rdbuf();
-
-            tmpStream.clear();
-
-            ++index;
-        }
-
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
-
-        std::size_t edgeCount = decomposition.edgeCount();
+}
 
-        auto it = hyperedgeCollection.begin();
+htd_io::TdFormatExporter::~TdFormatExporter()
+{
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+}
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), outputStream);
+}
 
-            ++it;
-        }
-    }
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), outputStream);
 }
 
 #endif /* HTD_IO_TDFORMATEXPORTER_CPP */
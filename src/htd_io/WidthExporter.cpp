@@ -41,42 +41,42 @@ void htd_io::WidthExporter::write(const htd::ITreeDecomposition & decomposition,
 {
     HTD_UNUSED(graph)
 
-    outputStream << decomposition.maximumBagSize() << std::endl;
+    outputStream << decomposition.maximumBagSize() << '\n';
 }
 
 void htd_io::WidthExporter::write(const htd::IGraphDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
 {
     HTD_UNUSED(graph)
 
-    outputStream << decomposition.maximumBagSize() << std::endl;
+    outputStream << decomposition.maximumBagSize() << '\n';
 }
 
 void htd_io::WidthExporter::write(const htd::IHypertreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
 {
     HTD_UNUSED(graph)
 
-    outputStream << decomposition.maximumBagSize() << ", " << decomposition.maximumCoveringEdgeAmount() << std::endl;
+    outputStream << decomposition.maximumBagSize() << ", " << decomposition.maximumCoveringEdgeAmount() << '\n';
 }
 
 void htd_io::WidthExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
     HTD_UNUSED(graph)
 
-    outputStream << decomposition.maximumBagSize() << std::endl;
+    outputStream << decomposition.maximumBagSize() << '\n';
 }
 
 void htd_io::WidthExporter::write(const htd::IGraphDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
     HTD_UNUSED(graph)
 
-    outputStream << decomposition.maximumBagSize() << std::endl;
+    outputStream << decomposition.maximumBagSize() << '\n';
 }
 
 void htd_io::WidthExporter::write(const htd::IHypertreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
 {
     HTD_UNUSED(graph)
 
-    outputStream << decomposition.maximumBagSize() << ", " << decomposition.maximumCoveringEdgeAmount() << std::endl;
+    outputStream << decomposition.maximumBagSize() << ", " << decomposition.maximumCoveringEdgeAmount() << '\n';
 }
 
 #endif /* HTD_IO_WIDTHEXPORTER_CPP */
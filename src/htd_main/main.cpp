@@ -31,9 +31,39 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <thread>
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
+/**
+ *  Fitness function preferring tree decompositions with small maximum bag size.
+ */
+class WidthFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        WidthFitnessFunction(void)
+        {
+
+        }
+
+        virtual ~WidthFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const HTD_OVERRIDE
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1, -(double)(decomposition.maximumBagSize()));
+        }
+
+        WidthFitnessFunction * clone(void) const HTD_OVERRIDE
+        {
+            return new WidthFitnessFunction();
+        }
+};
+
 htd_cli::OptionManager * createOptionManager(void)
 {
     htd_cli::OptionManager * manager = new htd_cli::OptionManager();
@@ -78,6 +108,7 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::Choice * outputFormatChoice = new htd_cli::Choice("output", "Set the output format of the decomposition to <format>.\n  (See https://github.com/mabseher/htd/blob/master/FORMATS.md for information about the available output formats.)", "format");
 
         outputFormatChoice->addPossibility("td", "Use the output format 'td'.");
+        outputFormatChoice->addPossibility("btd", "Use the binary output format 'btd'.");
         outputFormatChoice->addPossibility("human", "Provide a human-readable output of the decomposition.");
         outputFormatChoice->addPossibility("width", "Provide only the maximum bag size of the decomposition.");
 
@@ -94,6 +125,7 @@ htd_cli::OptionManager * createOptionManager(void)
         strategyChoice->addPossibility("random", "Use a random vertex ordering.");
         strategyChoice->addPossibility("min-fill", "Minimum fill ordering algorithm");
         strategyChoice->addPossibility("min-degree", "Minimum degree ordering algorithm");
+        strategyChoice->addPossibility("approximate-min-degree", "Approximate minimum degree ordering algorithm (AMD)");
         strategyChoice->addPossibility("min-separator", "Minimum separating vertex set heuristic");
         strategyChoice->addPossibility("max-cardinality", "Maximum cardinality search ordering algorithm");
         strategyChoice->addPossibility("max-cardinality-enhanced", "Enhanced maximum cardinality search ordering algorithm (MCS-M)");
@@ -134,6 +166,14 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * threadOption = new htd_cli::SingleValueOption("threads", "Set the number of threads used to perform the iterations during optimization to <count> (0 = number of hardware threads). (Default: 1)", "count");
+
+        manager->registerOption(threadOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * timeLimitOption = new htd_cli::SingleValueOption("time-limit", "Stop the optimization after a wall-clock time of <seconds> seconds and output the best decomposition found so far (0 = infinite). (Default: 0)", "seconds");
+
+        manager->registerOption(timeLimitOption, "Optimization Options");
     }
     catch (const std::runtime_error & exception)
     {
@@ -170,6 +210,8 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::Choice & decompositionTypeChoice = optionManager.accessChoice("type");
 
+    const htd_cli::Option & printProgressOption = optionManager.accessOption("print-progress");
+
     const htd_cli::Choice & strategyChoice = optionManager.accessChoice("strategy");
 
     const htd_cli::SingleValueOption & seedOption = optionManager.accessSingleValueOption("seed");
@@ -182,6 +224,17 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
 
+    if (ret && printProgressOption.used() && outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "btd")
+    {
+        std::cerr << "INVALID PROGRAM CALL: Option --print-progress cannot be combined with the binary output format 'btd'!" << std::endl;
+
+        ret = false;
+    }
+
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
+
+    const htd_cli::SingleValueOption & timeLimitOption = optionManager.accessSingleValueOption("time-limit");
+
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
     if (ret && helpOption.used())
@@ -266,6 +319,10 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         {
             manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
         }
+        else if (value == "approximate-min-degree")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::ApproximateMinDegreeOrderingAlgorithm(manager));
+        }
         else if (value == "min-separator")
         {
             if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
@@ -320,6 +377,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
             ret = false;
         }
 
+        if (outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "btd")
+        {
+            std::cerr << "INVALID OUTPUT FORMAT: Format 'btd' only supports tree decompositions!" << std::endl;
+
+            ret = false;
+        }
+
         if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
         {
             std::cerr << "INVALID PROGRAM CALL: Currently, optimization is supported only for tree decompositions!" << std::endl;
@@ -404,6 +468,82 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret)
+    {
+        if (threadOption.used())
+        {
+            if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width" && std::string(strategyChoice.value()) != "challenge")
+            {
+                std::size_t index = 0;
+
+                const std::string & value = threadOption.value();
+
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << threadOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::stoul(value, &index, 10);
+
+                    if (index != value.length())
+                    {
+                        std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --threads may only be used when option --opt is set to \"width\" and a strategy other than \"challenge\" is used!" << std::endl;
+
+                ret = false;
+            }
+        }
+    }
+
+    if (ret)
+    {
+        if (timeLimitOption.used())
+        {
+            if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
+            {
+                std::size_t index = 0;
+
+                const std::string & value = timeLimitOption.value();
+
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID TIME LIMIT: " << timeLimitOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::stoul(value, &index, 10);
+
+                    if (index != value.length())
+                    {
+                        std::cerr << "INVALID TIME LIMIT: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --time-limit may only be used when option --opt is set to \"width\"!" << std::endl;
+
+                ret = false;
+            }
+        }
+    }
+
     if (ret && triangulationMinimizationOption.used())
     {
         htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
@@ -593,6 +733,8 @@ int main(int argc, const char * const * const argv)
 
     std::ios_base::sync_with_stdio(false);
 
+    htd::CancellationToken::clock::time_point programStart = htd::CancellationToken::clock::now();
+
     std::signal(SIGINT, handleSignal);
     std::signal(SIGTERM, handleSignal);
 
@@ -618,6 +760,10 @@ int main(int argc, const char * const * const argv)
 
         const htd_cli::SingleValueOption & patienceOption = optionManager->accessSingleValueOption("patience");
 
+        const htd_cli::SingleValueOption & threadOption = optionManager->accessSingleValueOption("threads");
+
+        const htd_cli::SingleValueOption & timeLimitOption = optionManager->accessSingleValueOption("time-limit");
+
         const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
 
         const std::string & outputFormat = outputFormatChoice.value();
@@ -686,6 +832,10 @@ int main(int argc, const char * const * const argv)
             {
                 exporter = new htd_io::TdFormatExporter();
             }
+            else if (outputFormat == "btd")
+            {
+                exporter = new htd_io::BinaryTdFormatExporter();
+            }
             else if (outputFormat == "human")
             {
                 exporter = new htd_io::HumanReadableExporter();
@@ -705,6 +855,13 @@ int main(int argc, const char * const * const argv)
             {
                 std::size_t optimalMaximumBagSize = (std::size_t)-1;
 
+                std::chrono::seconds timeLimit(0);
+
+                if (timeLimitOption.used())
+                {
+                    timeLimit = std::chrono::seconds(std::stoul(timeLimitOption.value(), nullptr, 10));
+                }
+
                 if (std::string(optimizationChoice.value()) == "width")
                 {
                     htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * algorithm = new htd::CombinedWidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
@@ -773,37 +930,70 @@ int main(int argc, const char * const * const argv)
                     }
                     else
                     {
-                        htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+                        std::size_t iterations = 10;
 
                         if (iterationOption.used())
                         {
-                            std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+                            iterations = std::stoul(iterationOption.value(), nullptr, 10);
 
                             if (iterations == 0)
                             {
                                 iterations = (std::size_t)-1;
                             }
-
-                            baseAlgorithm->setIterationCount(iterations);
                         }
-                        else
+
+                        std::size_t nonImprovementLimit = (std::size_t)-1;
+
+                        if (patienceOption.used() && std::string(patienceOption.value()) != "-1")
                         {
-                            baseAlgorithm->setIterationCount(10);
+                            nonImprovementLimit = std::stoul(patienceOption.value(), nullptr, 10);
                         }
 
-                        if (patienceOption.used())
+                        std::size_t threads = 1;
+
+                        if (threadOption.used())
                         {
-                            if (std::string(patienceOption.value()) == "-1")
-                            {
-                                baseAlgorithm->setNonImprovementLimit((std::size_t)-1);
-                            }
-                            else
+                            threads = std::stoul(threadOption.value(), nullptr, 10);
+
+                            if (threads == 0)
                             {
-                                baseAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
+                                threads = std::max(std::thread::hardware_concurrency(), 1u);
                             }
                         }
 
-                        algorithm->addDecompositionAlgorithm(baseAlgorithm);
+                        if (timeLimit > std::chrono::seconds::zero())
+                        {
+                            algorithm->addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(libraryInstance));
+                        }
+
+                        if (threads > 1)
+                        {
+                            htd::IterativeImprovementTreeDecompositionAlgorithm * baseAlgorithm =
+                                new htd::IterativeImprovementTreeDecompositionAlgorithm(libraryInstance,
+                                                                                        libraryInstance->treeDecompositionAlgorithmFactory().createInstance(),
+                                                                                        new WidthFitnessFunction());
+
+                            baseAlgorithm->setIterationCount(iterations);
+
+                            baseAlgorithm->setNonImprovementLimit(nonImprovementLimit);
+
+                            baseAlgorithm->setThreadCount(threads);
+
+                            /* The fitness function only rates the width, hence non-improving orderings need not be materialized. */
+                            baseAlgorithm->setWidthOnlyEvaluationEnabled(true);
+
+                            algorithm->addDecompositionAlgorithm(baseAlgorithm);
+                        }
+                        else
+                        {
+                            htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+
+                            baseAlgorithm->setIterationCount(iterations);
+
+                            baseAlgorithm->setNonImprovementLimit(nonImprovementLimit);
+
+                            algorithm->addDecompositionAlgorithm(baseAlgorithm);
+                        }
                     }
 
                     algorithm->setComputeInducedEdgesEnabled(false);
@@ -858,6 +1048,19 @@ int main(int argc, const char * const * const argv)
 
                 processor->setPreprocessor(preprocessor);
 
+                std::shared_ptr<htd::CancellationToken> cancellationToken = std::make_shared<htd::CancellationToken>();
+
+                if (timeLimit > std::chrono::seconds::zero())
+                {
+                    processor->registerParsingCallback([&](htd_io::parsing_result_t result, std::size_t vertexCount, std::size_t edgeCount){
+                        HTD_UNUSED(result)
+                        HTD_UNUSED(vertexCount)
+                        HTD_UNUSED(edgeCount)
+
+                        cancellationToken->setDeadline(programStart + timeLimit);
+                    });
+                }
+
                 std::chrono::milliseconds::rep start =
                     std::chrono::duration_cast<std::chrono::milliseconds>
                         (std::chrono::system_clock::now().time_since_epoch()).count();
@@ -989,6 +1192,8 @@ int main(int argc, const char * const * const argv)
                     });
                 }
 
+                processor->setCancellationToken(cancellationToken);
+
                 if (instanceOption.used())
                 {
                     processor->process(instanceOption.value(), std::cout);
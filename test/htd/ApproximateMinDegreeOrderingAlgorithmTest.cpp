@@ -0,0 +1,271 @@
+/*
+ * File:   ApproximateMinDegreeOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <vector>
+#include <random>
+
+class ApproximateMinDegreeOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        ApproximateMinDegreeOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ApproximateMinDegreeOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+bool isPermutation(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    std::vector<htd::vertex_t> sortedOrdering(ordering.begin(), ordering.end());
+
+    std::sort(sortedOrdering.begin(), sortedOrdering.end());
+
+    return vertices == sortedOrdering;
+}
+
+std::size_t eliminationWidth(htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(graph.neighbors(vertex).begin(), graph.neighbors(vertex).end());
+
+        neighbors.erase(std::remove(neighbors.begin(), neighbors.end(), vertex), neighbors.end());
+
+        if (neighbors.size() + 1 > ret)
+        {
+            ret = neighbors.size() + 1;
+        }
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 < neighbor2 && !graph.isNeighbor(neighbor1, neighbor2))
+                {
+                    graph.addEdge(neighbor1, neighbor2);
+                }
+            }
+        }
+
+        graph.removeVertex(vertex);
+    }
+
+    return ret;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance1);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckSize1Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 1);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)1, ordering->sequence().size());
+    ASSERT_EQ((htd::vertex_t)1, ordering->sequence()[0]);
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckSimpleGraph1)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(2, 6);
+    graph.addEdge(3, 4);
+    graph.addEdge(3, 7);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+
+    ASSERT_EQ((std::size_t)3, eliminationWidth(graph, ordering->sequence()));
+    ASSERT_EQ((std::size_t)3, ordering->maximumBagSize());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckCliqueGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 12);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 12; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 12; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+    ASSERT_EQ((std::size_t)12, ordering->maximumBagSize());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        std::size_t vertexCount = 20 + 10 * iteration;
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        std::uniform_int_distribution<htd::vertex_t> distribution(1, vertexCount);
+
+        for (std::size_t index = 0; index < 3 * vertexCount; ++index)
+        {
+            htd::vertex_t vertex1 = distribution(generator);
+            htd::vertex_t vertex2 = distribution(generator);
+
+            if (vertex1 != vertex2 && !graph.isNeighbor(vertex1, vertex2))
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+        htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+        ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+
+        ASSERT_EQ(eliminationWidth(graph, ordering->sequence()), ordering->maximumBagSize());
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckMaximumBagSize)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 12);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 12; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 12; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, 5, 3);
+
+    ASSERT_EQ((std::size_t)3, ordering->requiredIterations());
+    ASSERT_LT((std::size_t)5, ordering->maximumBagSize());
+
+    delete libraryInstance;
+    delete ordering;
+}
@@ -0,0 +1,408 @@
+/*
+ * File:   AtomBasedTreeDecompositionAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class AtomBasedTreeDecompositionAlgorithmTest : public ::testing::Test
+{
+    public:
+        AtomBasedTreeDecompositionAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~AtomBasedTreeDecompositionAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Create a graph consisting of a chain of cliques where each clique shares two vertices with its predecessor.
+ *
+ *  @param[in,out] graph        The graph to which the chain of cliques shall be added.
+ *  @param[in] cliqueSizes      The sizes of the cliques.
+ */
+static void createChainOfCliques(htd::MultiHypergraph & graph, const std::vector<std::size_t> & cliqueSizes)
+{
+    std::vector<htd::vertex_t> sharedVertices;
+
+    for (std::size_t cliqueSize : cliqueSizes)
+    {
+        std::vector<htd::vertex_t> clique(sharedVertices);
+
+        while (clique.size() < cliqueSize)
+        {
+            clique.push_back(graph.addVertex());
+        }
+
+        for (htd::index_t index1 = 0; index1 < clique.size(); ++index1)
+        {
+            for (htd::index_t index2 = index1 + 1; index2 < clique.size(); ++index2)
+            {
+                if (index1 >= sharedVertices.size() || index2 >= sharedVertices.size())
+                {
+                    graph.addEdge(clique[index1], clique[index2]);
+                }
+            }
+        }
+
+        sharedVertices.assign(clique.end() - 2, clique.end());
+    }
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::AtomBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->bagContent(decomposition->root()).size(), (std::size_t)0);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+
+    graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+    graph.addEdge(vertex2, vertex3);
+
+    htd::AtomBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)2);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckAtomsOfChainOfCliques)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createChainOfCliques(graph, { 4, 6, 3, 5 });
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.computeAtoms(graph, atoms, separators);
+
+    ASSERT_EQ(atoms.size(), (std::size_t)4);
+
+    ASSERT_EQ(separators.size(), atoms.size());
+
+    std::vector<std::size_t> atomSizes;
+
+    for (htd::index_t index = 0; index < atoms.size(); ++index)
+    {
+        const std::vector<htd::vertex_t> & atom = atoms[index];
+
+        const std::vector<htd::vertex_t> & separator = separators[index];
+
+        EXPECT_TRUE(std::is_sorted(atom.begin(), atom.end()));
+
+        EXPECT_TRUE(std::includes(atom.begin(), atom.end(), separator.begin(), separator.end()));
+
+        EXPECT_EQ(separator.size(), index + 1 < atoms.size() ? (std::size_t)2 : (std::size_t)0);
+
+        atomSizes.push_back(atom.size());
+    }
+
+    std::sort(atomSizes.begin(), atomSizes.end());
+
+    EXPECT_EQ(atomSizes, std::vector<std::size_t>({ 3, 4, 5, 6 }));
+
+    delete libraryInstance;
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckResultChainOfCliques)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    createChainOfCliques(graph, { 4, 6, 3, 5, 7, 2, 4 });
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::AtomBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setThreadCount(threadCount);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+        EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)7);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
+
+            std::size_t expectedInducedEdgeCount = 0;
+
+            for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+            {
+                if (std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
+                {
+                    ++expectedInducedEdgeCount;
+                }
+            }
+
+            EXPECT_EQ(decomposition->inducedHyperedges(vertex).size(), expectedInducedEdgeCount);
+        }
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckResultRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (htd::index_t iteration = 0; iteration < 20; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance);
+
+        std::size_t vertexCount = 5 + generator() % 40;
+
+        graph.addVertices(vertexCount);
+
+        std::size_t edgeCount = generator() % (2 * vertexCount);
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+            htd::vertex_t vertex2 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::AtomBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setThreadCount(1 + iteration % 3);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckResultNonContiguousNodeIdentifiers)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(7);
+
+    for (htd::index_t iteration = 0; iteration < 10; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance);
+
+        createChainOfCliques(graph, { 4, 6, 3, 5 });
+
+        std::size_t vertexCount = graph.vertexCount();
+
+        /* Attach a random sparse graph so that the decompositions of the atoms consist of several nodes. */
+        graph.addVertices(30);
+
+        for (htd::index_t index = 0; index < 50; ++index)
+        {
+            htd::vertex_t vertex1 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(vertexCount + generator() % 30);
+            htd::vertex_t vertex2 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % (vertexCount + 30));
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        /* The compression of a normalized decomposition removes nodes, i.e., the node identifiers of the atom decompositions contain gaps. */
+        htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+        baseAlgorithm->addManipulationOperation(new htd::NormalizationOperation(libraryInstance));
+        baseAlgorithm->addManipulationOperation(new htd::CompressionOperation(libraryInstance));
+
+        htd::AtomBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setDecompositionAlgorithm(baseAlgorithm);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(AtomBasedTreeDecompositionAlgorithmTest, CheckResultIndependentOfThreadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(13);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(60);
+
+    for (htd::index_t index = 0; index < 90; ++index)
+    {
+        htd::vertex_t vertex1 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % 60);
+        htd::vertex_t vertex2 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % 60);
+
+        if (vertex1 != vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    std::vector<std::vector<htd::vertex_t>> expectedBags;
+
+    for (std::size_t threadCount : { 1, 2, 4 })
+    {
+        htd::AtomBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setThreadCount(threadCount);
+
+        htd::setThreadLocalRandomSeed(42);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        htd::resetThreadLocalRandomSeed();
+
+        ASSERT_NE(decomposition, nullptr);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        std::vector<std::vector<htd::vertex_t>> bags;
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            bags.push_back(decomposition->bagContent(vertex));
+        }
+
+        if (threadCount == 1)
+        {
+            expectedBags = bags;
+        }
+        else
+        {
+            EXPECT_EQ(expectedBags, bags);
+        }
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
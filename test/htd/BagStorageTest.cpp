@@ -0,0 +1,371 @@
+/*
+ * File:   BagStorageTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+/**
+ *  The number of allocations performed via the global operator new.
+ */
+static std::size_t allocationCount = 0;
+
+/**
+ *  The number of bytes which are currently allocated via the global operator new.
+ */
+static std::size_t allocatedBytes = 0;
+
+/**
+ *  The size of the header preceding each allocation which records its size. It preserves the alignment of the allocation.
+ */
+static const std::size_t allocationHeaderSize = sizeof(std::max_align_t);
+
+void * operator new(std::size_t size)
+{
+    char * block = static_cast<char *>(std::malloc(size + allocationHeaderSize));
+
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<std::size_t *>(block) = size;
+
+    ++allocationCount;
+
+    allocatedBytes += size;
+
+    return block + allocationHeaderSize;
+}
+
+void operator delete(void * pointer) noexcept
+{
+    if (pointer != nullptr)
+    {
+        char * block = static_cast<char *>(pointer) - allocationHeaderSize;
+
+        allocatedBytes -= *reinterpret_cast<std::size_t *>(block);
+
+        std::free(block);
+    }
+}
+
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    void * ret = nullptr;
+
+    try
+    {
+        ret = ::operator new(size);
+    }
+    catch (const std::bad_alloc &)
+    {
+        ret = nullptr;
+    }
+
+    return ret;
+}
+
+void operator delete(void * pointer, const std::nothrow_t &) noexcept
+{
+    ::operator delete(pointer);
+}
+
+class BagStorageTest : public ::testing::Test
+{
+    public:
+        BagStorageTest(void)
+        {
+
+        }
+
+        virtual ~BagStorageTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(BagStorageTest, CheckEmptyStorage)
+{
+    htd::BagStorage storage;
+
+    ASSERT_EQ((std::size_t)0, storage.size());
+
+    ASSERT_FALSE(storage.contains(htd::Vertex::FIRST));
+    ASSERT_FALSE(storage.contains(htd::Vertex::UNKNOWN));
+
+    storage.erase(htd::Vertex::FIRST);
+
+    ASSERT_EQ((std::size_t)0, storage.size());
+}
+
+TEST(BagStorageTest, CheckInsertionAndRemoval)
+{
+    htd::BagStorage storage;
+
+    storage.insert(5, std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+    storage.insert(3);
+    storage.insert(8, std::vector<htd::vertex_t> { 4 }, htd::FilteredHyperedgeCollection());
+
+    ASSERT_EQ((std::size_t)3, storage.size());
+
+    ASSERT_TRUE(storage.contains(3));
+    ASSERT_FALSE(storage.contains(4));
+    ASSERT_TRUE(storage.contains(5));
+    ASSERT_FALSE(storage.contains(6));
+    ASSERT_TRUE(storage.contains(8));
+    ASSERT_FALSE(storage.contains(9));
+
+    const std::vector<htd::vertex_t> & bag5 = storage.bagContent(5);
+
+    storage.insert(20);
+    storage.insert(1);
+
+    ASSERT_EQ((std::size_t)5, storage.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), bag5);
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4 }), storage.bagContent(8));
+    ASSERT_TRUE(storage.bagContent(3).empty());
+    ASSERT_EQ((std::size_t)0, storage.inducedHyperedges(3).size());
+
+    storage.bagContent(3).push_back(7);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 7 }), storage.bagContent(3));
+
+    storage.erase(1);
+    storage.erase(20);
+    storage.erase(3);
+
+    ASSERT_EQ((std::size_t)2, storage.size());
+
+    ASSERT_FALSE(storage.contains(1));
+    ASSERT_FALSE(storage.contains(3));
+    ASSERT_FALSE(storage.contains(20));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), bag5);
+
+    storage.insert(3);
+
+    ASSERT_TRUE(storage.bagContent(3).empty());
+
+    storage.insert(5, std::vector<htd::vertex_t> { 6 }, htd::FilteredHyperedgeCollection());
+
+    ASSERT_EQ((std::size_t)3, storage.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 6 }), storage.bagContent(5));
+
+    storage.clear();
+
+    ASSERT_EQ((std::size_t)0, storage.size());
+    ASSERT_FALSE(storage.contains(5));
+}
+
+TEST(BagStorageTest, CheckCopyAndMove)
+{
+    htd::Hyperedge h1(1, 1, 2);
+
+    htd::FilteredHyperedgeCollection hyperedges(new htd::HyperedgeVector(std::vector<htd::Hyperedge> { h1 }), std::vector<htd::index_t> { 0 });
+
+    htd::BagStorage storage1;
+
+    storage1.insert(2, std::vector<htd::vertex_t> { 1, 2 }, hyperedges);
+    storage1.insert(4, std::vector<htd::vertex_t> { 2 }, htd::FilteredHyperedgeCollection());
+
+    htd::BagStorage storage2(storage1);
+
+    storage2.bagContent(2).push_back(3);
+
+    ASSERT_EQ((std::size_t)2, storage2.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), storage1.bagContent(2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), storage2.bagContent(2));
+    ASSERT_EQ((std::size_t)1, storage2.inducedHyperedges(2).size());
+
+    htd::BagStorage storage3(std::move(storage2));
+
+    ASSERT_EQ((std::size_t)2, storage3.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2 }), storage3.bagContent(4));
+
+    storage2 = storage1;
+
+    ASSERT_EQ((std::size_t)2, storage2.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), storage2.bagContent(2));
+
+    storage3 = std::move(storage1);
+
+    ASSERT_EQ((std::size_t)2, storage3.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), storage3.bagContent(2));
+}
+
+TEST(BagStorageTest, CheckArenaCompaction)
+{
+    htd::Hyperedge h1(1, 50, 51);
+
+    htd::FilteredHyperedgeCollection hyperedges(new htd::HyperedgeVector(std::vector<htd::Hyperedge> { h1 }), std::vector<htd::index_t> { 0 });
+
+    htd::BagStorage storage;
+
+    for (htd::vertex_t vertex = 1; vertex <= 100; ++vertex)
+    {
+        storage.insert(vertex, std::vector<htd::vertex_t> { vertex, vertex + 1 }, vertex == 50 ? hyperedges : htd::FilteredHyperedgeCollection());
+    }
+
+    std::vector<htd::vertex_t> & bag10 = storage.bagContent(10);
+
+    bag10.push_back(1000);
+
+    for (htd::vertex_t round = 0; round < 20; ++round)
+    {
+        for (htd::vertex_t vertex = 1; vertex <= 100; vertex += 2)
+        {
+            storage.insert(vertex, std::vector<htd::vertex_t> { vertex + round }, htd::FilteredHyperedgeCollection());
+        }
+    }
+
+    ASSERT_EQ((std::size_t)100, storage.size());
+
+    ASSERT_EQ(&bag10, &(storage.bagContent(10)));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 10, 11, 1000 }), bag10);
+    ASSERT_EQ((std::size_t)3, storage.bagSize(10));
+
+    for (htd::vertex_t vertex = 1; vertex <= 100; ++vertex)
+    {
+        htd::ConstSpan<htd::vertex_t> bag = storage.bagSpan(vertex);
+
+        if (vertex % 2 == 1)
+        {
+            ASSERT_EQ((std::size_t)1, bag.size());
+            ASSERT_EQ(vertex + 19, bag[0]);
+        }
+        else if (vertex != 10)
+        {
+            ASSERT_EQ(std::vector<htd::vertex_t>({ vertex, vertex + 1 }), std::vector<htd::vertex_t>(bag.begin(), bag.end()));
+        }
+    }
+
+    const htd::BagStorage & constStorage = storage;
+
+    ASSERT_TRUE(hyperedges == constStorage.inducedHyperedges(50));
+    ASSERT_EQ((std::size_t)0, constStorage.inducedHyperedges(52).size());
+
+    for (htd::vertex_t vertex = 1; vertex <= 100; vertex += 2)
+    {
+        storage.erase(vertex);
+    }
+
+    ASSERT_EQ((std::size_t)50, storage.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 10, 11, 1000 }), bag10);
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 50, 51 }), constStorage.bagContent(50));
+    ASSERT_TRUE(hyperedges == constStorage.inducedHyperedges(50));
+}
+
+TEST(BagStorageTest, CheckMemoryFootprint)
+{
+    const std::size_t nodeCount = 4096;
+
+    const std::vector<htd::vertex_t> bagContent { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    const htd::FilteredHyperedgeCollection inducedEdges;
+
+    htd::BagStorage storage;
+
+    std::size_t initialAllocationCount = allocationCount;
+
+    std::size_t initialAllocatedBytes = allocatedBytes;
+
+    for (htd::vertex_t vertex = 1; vertex <= nodeCount; ++vertex)
+    {
+        storage.insert(vertex, bagContent, inducedEdges);
+    }
+
+    /* The bags are packed into one arena, i.e., the number of allocations does not grow with the number of nodes. */
+    EXPECT_LT(allocationCount - initialAllocationCount, nodeCount / 4);
+
+    std::size_t footprint = allocatedBytes - initialAllocatedBytes;
+
+    std::size_t currentAllocationCount = allocationCount;
+
+    std::size_t sum = 0;
+
+    for (htd::vertex_t vertex = 1; vertex <= nodeCount; ++vertex)
+    {
+        sum += storage.bagSize(vertex);
+
+        for (htd::vertex_t element : storage.bagSpan(vertex))
+        {
+            sum += element;
+        }
+    }
+
+    /* Neither the size nor the span of a bag detaches it from the arena. */
+    EXPECT_EQ(currentAllocationCount, allocationCount);
+    EXPECT_EQ(nodeCount * 44, sum);
+
+    for (std::size_t round = 0; round < 32; ++round)
+    {
+        for (htd::vertex_t vertex = 1; vertex <= nodeCount; vertex += 2)
+        {
+            storage.insert(vertex, bagContent, inducedEdges);
+        }
+    }
+
+    /* The replaced bags are reclaimed by compacting the arena, otherwise the footprint would grow by 2 MiB. */
+    EXPECT_LT(allocatedBytes - initialAllocatedBytes, footprint + 4 * nodeCount * bagContent.size() * sizeof(htd::vertex_t));
+
+    const htd::BagStorage & constStorage = storage;
+
+    for (htd::vertex_t vertex = 1; vertex <= nodeCount; ++vertex)
+    {
+        EXPECT_EQ(bagContent, constStorage.bagContent(vertex));
+    }
+
+    currentAllocationCount = allocationCount;
+
+    htd::BagStorage copy(storage);
+
+    /* The copy packs the detached bags into its arena again. */
+    EXPECT_LT(allocationCount - currentAllocationCount, nodeCount / 4);
+
+    EXPECT_EQ(nodeCount, copy.size());
+    EXPECT_EQ(bagContent.size(), copy.bagSize(nodeCount));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
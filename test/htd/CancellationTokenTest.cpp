@@ -0,0 +1,262 @@
+/*
+ * File:   CancellationTokenTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+class CancellationTokenTest : public ::testing::Test
+{
+    public:
+        CancellationTokenTest(void)
+        {
+
+        }
+
+        virtual ~CancellationTokenTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(CancellationTokenTest, CheckCancel)
+{
+    htd::CancellationToken token;
+
+    ASSERT_FALSE(token.isCancelled());
+    ASSERT_FALSE(token.hasDeadline());
+    ASSERT_EQ(nullptr, token.parent());
+
+    token.cancel();
+
+    ASSERT_TRUE(token.isCancelled());
+}
+
+TEST(CancellationTokenTest, CheckDeadline)
+{
+    htd::CancellationToken token;
+
+    token.setTimeout(std::chrono::hours(1));
+
+    ASSERT_TRUE(token.hasDeadline());
+    ASSERT_FALSE(token.isCancelled());
+
+    token.setDeadline(htd::CancellationToken::clock::now() - std::chrono::milliseconds(1));
+
+    ASSERT_TRUE(token.isCancelled());
+
+    token.setDeadline(htd::CancellationToken::clock::time_point::max());
+
+    ASSERT_FALSE(token.hasDeadline());
+    ASSERT_FALSE(token.isCancelled());
+}
+
+TEST(CancellationTokenTest, CheckParentChaining)
+{
+    std::shared_ptr<htd::CancellationToken> parent = std::make_shared<htd::CancellationToken>();
+
+    std::shared_ptr<htd::CancellationToken> child1 = std::make_shared<htd::CancellationToken>(parent);
+    std::shared_ptr<htd::CancellationToken> child2 = std::make_shared<htd::CancellationToken>(parent);
+
+    std::shared_ptr<htd::CancellationToken> grandChild = std::make_shared<htd::CancellationToken>(child1);
+
+    ASSERT_EQ(parent, child1->parent());
+    ASSERT_EQ(child1, grandChild->parent());
+
+    child2->cancel();
+
+    ASSERT_FALSE(parent->isCancelled());
+    ASSERT_FALSE(child1->isCancelled());
+    ASSERT_TRUE(child2->isCancelled());
+    ASSERT_FALSE(grandChild->isCancelled());
+
+    parent->setTimeout(std::chrono::seconds(0));
+
+    ASSERT_TRUE(parent->isCancelled());
+    ASSERT_TRUE(child1->isCancelled());
+    ASSERT_TRUE(grandChild->isCancelled());
+}
+
+TEST(CancellationTokenTest, CheckScope)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::shared_ptr<htd::CancellationToken> outerToken = std::make_shared<htd::CancellationToken>();
+
+    std::shared_ptr<htd::CancellationToken> innerToken = std::make_shared<htd::CancellationToken>();
+
+    ASSERT_EQ(nullptr, htd::CancellationToken::current());
+    ASSERT_FALSE(htd::CancellationToken::isCurrentCancelled());
+
+    {
+        htd::CancellationScope outerScope(outerToken);
+
+        ASSERT_EQ(outerToken, htd::CancellationToken::current());
+
+        {
+            htd::CancellationScope innerScope(innerToken);
+
+            ASSERT_EQ(innerToken, htd::CancellationToken::current());
+
+            innerToken->cancel();
+
+            ASSERT_TRUE(libraryInstance->isTerminated());
+        }
+
+        ASSERT_EQ(outerToken, htd::CancellationToken::current());
+
+        ASSERT_FALSE(libraryInstance->isTerminated());
+    }
+
+    ASSERT_EQ(nullptr, htd::CancellationToken::current());
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    delete libraryInstance;
+}
+
+TEST(CancellationTokenTest, CheckIndependentJobs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::shared_ptr<htd::CancellationToken> cancelledToken = std::make_shared<htd::CancellationToken>();
+
+    std::shared_ptr<htd::CancellationToken> activeToken = std::make_shared<htd::CancellationToken>();
+
+    cancelledToken->cancel();
+
+    bool terminated1 = false;
+    bool terminated2 = true;
+
+    std::thread thread1([&](void)
+    {
+        htd::CancellationScope scope(cancelledToken);
+
+        terminated1 = libraryInstance->isTerminated();
+    });
+
+    std::thread thread2([&](void)
+    {
+        htd::CancellationScope scope(activeToken);
+
+        terminated2 = libraryInstance->isTerminated();
+    });
+
+    thread1.join();
+    thread2.join();
+
+    ASSERT_TRUE(terminated1);
+    ASSERT_FALSE(terminated2);
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    delete libraryInstance;
+}
+
+class WidthFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        WidthFitnessFunction(void)
+        {
+
+        }
+
+        ~WidthFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1, -(double)(decomposition.maximumBagSize()));
+        }
+
+        WidthFitnessFunction * clone(void) const
+        {
+            return new WidthFitnessFunction();
+        }
+};
+
+TEST(CancellationTokenTest, CheckTimeoutOfUnboundedComputation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 30);
+
+    for (htd::vertex_t vertex = 1; vertex < 30; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+        graph.addEdge(vertex, 30 - vertex / 2);
+    }
+
+    for (std::size_t threadCount : { 1, 3 })
+    {
+        htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new WidthFitnessFunction());
+
+        /* Perform an infinite number of iterations. */
+        algorithm.setIterationCount(0);
+
+        algorithm.setThreadCount(threadCount);
+
+        std::shared_ptr<htd::CancellationToken> token = std::make_shared<htd::CancellationToken>();
+
+        token->setTimeout(std::chrono::milliseconds(100));
+
+        htd::CancellationScope scope(token);
+
+        std::size_t iterationCount = 0;
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)
+        {
+            ++iterationCount;
+        });
+
+        ASSERT_TRUE(token->isCancelled());
+        ASSERT_GT(iterationCount, (std::size_t)0);
+        ASSERT_NE(nullptr, decomposition);
+
+        delete decomposition;
+    }
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    delete libraryInstance;
+}
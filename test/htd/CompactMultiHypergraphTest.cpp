@@ -0,0 +1,237 @@
+/*
+ * File:   CompactMultiHypergraphTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class CompactMultiHypergraphTest : public ::testing::Test
+{
+    public:
+        CompactMultiHypergraphTest(void)
+        {
+
+        }
+
+        virtual ~CompactMultiHypergraphTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+static void checkEquivalence(const htd::IMultiHypergraph & expected, const htd::IMultiHypergraph & actual)
+{
+    ASSERT_EQ(expected.vertexCount(), actual.vertexCount());
+    ASSERT_EQ(expected.edgeCount(), actual.edgeCount());
+
+    ASSERT_EQ(expected.vertices(), actual.vertices());
+    ASSERT_EQ(expected.hyperedges().size(), actual.hyperedges().size());
+
+    for (htd::index_t index = 0; index < expected.edgeCount(); ++index)
+    {
+        ASSERT_EQ(expected.hyperedgeAtPosition(index).id(), actual.hyperedgeAtPosition(index).id());
+        ASSERT_EQ(expected.hyperedgeAtPosition(index).elements(), actual.hyperedgeAtPosition(index).elements());
+        ASSERT_EQ(expected.hyperedgeAtPosition(index).sortedElements(), actual.hyperedgeAtPosition(index).sortedElements());
+
+        ASSERT_TRUE(actual.isEdge(expected.hyperedgeAtPosition(index).id()));
+        ASSERT_TRUE(actual.isEdge(expected.hyperedgeAtPosition(index).elements()));
+
+        ASSERT_EQ(expected.associatedEdgeIds(expected.hyperedgeAtPosition(index).elements()),
+                  actual.associatedEdgeIds(expected.hyperedgeAtPosition(index).elements()));
+    }
+
+    ASSERT_EQ(expected.isolatedVertexCount(), actual.isolatedVertexCount());
+    ASSERT_EQ(expected.isolatedVertices(), actual.isolatedVertices());
+
+    ASSERT_EQ(expected.isConnected(), actual.isConnected());
+
+    for (htd::vertex_t vertex : expected.vertices())
+    {
+        ASSERT_TRUE(actual.isVertex(vertex));
+
+        ASSERT_EQ(expected.neighborCount(vertex), actual.neighborCount(vertex));
+        ASSERT_EQ(expected.neighbors(vertex), actual.neighbors(vertex));
+
+        ASSERT_EQ(expected.edgeCount(vertex), actual.edgeCount(vertex));
+        ASSERT_EQ(expected.hyperedges(vertex).size(), actual.hyperedges(vertex).size());
+
+        for (htd::index_t index = 0; index < expected.edgeCount(vertex); ++index)
+        {
+            ASSERT_EQ(expected.hyperedgeAtPosition(index, vertex).id(), actual.hyperedgeAtPosition(index, vertex).id());
+        }
+
+        ASSERT_EQ(expected.isIsolatedVertex(vertex), actual.isIsolatedVertex(vertex));
+
+        for (htd::vertex_t vertex2 : expected.vertices())
+        {
+            ASSERT_EQ(expected.isNeighbor(vertex, vertex2), actual.isNeighbor(vertex, vertex2));
+            ASSERT_EQ(expected.isConnected(vertex, vertex2), actual.isConnected(vertex, vertex2));
+            ASSERT_EQ(expected.isEdge(vertex, vertex2), actual.isEdge(vertex, vertex2));
+        }
+    }
+}
+
+TEST(CompactMultiHypergraphTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph original(libraryInstance);
+
+    htd::CompactMultiHypergraph graph(original);
+
+    ASSERT_EQ((std::size_t)0, graph.vertexCount());
+    ASSERT_EQ((std::size_t)0, graph.edgeCount());
+
+    ASSERT_EQ((std::size_t)0, graph.vertices().size());
+    ASSERT_EQ((std::size_t)0, graph.hyperedges().size());
+
+    ASSERT_EQ((std::size_t)0, graph.isolatedVertexCount());
+    ASSERT_EQ((std::size_t)0, graph.isolatedVertices().size());
+
+    ASSERT_FALSE(graph.isVertex(htd::Vertex::UNKNOWN));
+    ASSERT_FALSE(graph.isVertex((htd::vertex_t)1));
+    ASSERT_FALSE(graph.isEdge((htd::id_t)1));
+
+    ASSERT_TRUE(graph.isConnected());
+
+    delete libraryInstance;
+}
+
+TEST(CompactMultiHypergraphTest, CheckConversion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph original(libraryInstance, 7);
+
+    original.addEdge(1, 2);
+    original.addEdge(2, 1);
+    original.addEdge(1, 2);
+    original.addEdge(3, 3);
+    original.addEdge(std::vector<htd::vertex_t> { 2, 3, 5 });
+    original.addEdge(std::vector<htd::vertex_t> { 5, 6, 2 });
+    original.addEdge(std::vector<htd::vertex_t> { 7 });
+
+    original.removeVertex(4);
+
+    htd::CompactMultiHypergraph graph(original);
+
+    checkEquivalence(original, graph);
+
+    ASSERT_FALSE(graph.isVertex((htd::vertex_t)4));
+    ASSERT_FALSE(graph.isVertex((htd::vertex_t)8));
+
+    ASSERT_EQ((std::size_t)2, graph.associatedEdgeIds(1, 2).size());
+    ASSERT_EQ((std::size_t)1, graph.associatedEdgeIds(2, 1).size());
+
+    ASSERT_TRUE(graph.isNeighbor(3, 3));
+    ASSERT_FALSE(graph.isNeighbor(5, 5));
+    ASSERT_FALSE(graph.isNeighbor(6, 6));
+
+    ASSERT_TRUE(graph.isIsolatedVertex(7));
+    ASSERT_FALSE(graph.isConnected());
+
+    htd::CompactMultiHypergraph * clone = graph.clone();
+
+    checkEquivalence(original, *clone);
+
+    delete clone;
+
+    delete libraryInstance;
+}
+
+TEST(CompactMultiHypergraphTest, CheckConstructionFromEdgeArrays)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph original(libraryInstance, 6);
+
+    original.addEdge(1, 2);
+    original.addEdge(2, 3);
+    original.addEdge(3, 3);
+    original.addEdge(std::vector<htd::vertex_t> { 4, 1, 4, 2 });
+    original.addEdge(std::vector<htd::vertex_t> { 5 });
+    original.addEdge(std::vector<htd::vertex_t> { 3, 4, 5 });
+
+    std::vector<htd::index_t> edgeOffsets { 0, 2, 4, 6, 10, 11, 14 };
+    std::vector<htd::vertex_t> edgeElements { 1, 2, 2, 3, 3, 3, 4, 1, 4, 2, 5, 3, 4, 5 };
+
+    htd::CompactMultiHypergraph graph(libraryInstance, 6, std::move(edgeOffsets), std::move(edgeElements));
+
+    checkEquivalence(original, graph);
+
+    ASSERT_EQ((std::size_t)3, graph.hyperedgeSizeAtPosition(5));
+
+    std::vector<htd::vertex_t> elements;
+
+    graph.copyHyperedgeElementsTo(3, elements);
+
+    ASSERT_EQ(original.hyperedgeAtPosition(3).elements(), elements);
+
+    delete libraryInstance;
+}
+
+TEST(CompactMultiHypergraphTest, CheckFactory)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMutableMultiHypergraph * original = libraryInstance->multiHypergraphFactory().createInstance(4);
+
+    original->addEdge(1, 2);
+    original->addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+
+    htd::IMultiHypergraph * graph = libraryInstance->multiHypergraphFactory().createCompactInstance(*original);
+
+    ASSERT_EQ(libraryInstance, graph->managementInstance());
+
+    checkEquivalence(*original, *graph);
+
+    htd::FilteredHyperedgeCollection hyperedges = graph->hyperedgesAtPositions(std::vector<htd::index_t> { 1 });
+
+    ASSERT_EQ((std::size_t)1, hyperedges.size());
+    ASSERT_EQ((htd::id_t)2, hyperedges.begin()->id());
+
+    delete graph;
+    delete original;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,374 @@
+/*
+ * File:   EnhancedMaximumCardinalitySearchOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+class EnhancedMaximumCardinalitySearchOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        EnhancedMaximumCardinalitySearchOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~EnhancedMaximumCardinalitySearchOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Create a random graph with the given number of vertices.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] vertexCount      The number of vertices of the new graph.
+ *  @param[in] edgeCount        The number of edges which shall be drawn for the new graph.
+ *  @param[in] generator        The random number generator.
+ *
+ *  @return A new random graph.
+ */
+static htd::MultiHypergraph * createRandomGraph(const htd::LibraryInstance * libraryInstance, std::size_t vertexCount, std::size_t edgeCount, std::mt19937 & generator)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, vertexCount);
+
+    for (htd::index_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t vertex1 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+        htd::vertex_t vertex2 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+
+        if (vertex1 != vertex2)
+        {
+            ret->addEdge(vertex1, vertex2);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute the adjacency sets of the given graph extended by the given fill edges.
+ *
+ *  @param[in] graph        The input graph.
+ *  @param[in] fillEdges    The fill edges.
+ *
+ *  @return The adjacency sets of the given graph extended by the given fill edges, indexed by the vertex identifiers.
+ */
+static std::vector<std::set<htd::vertex_t>> computeAdjacency(const htd::IMultiHypergraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges)
+{
+    std::vector<std::set<htd::vertex_t>> ret(graph.vertexCount() + htd::Vertex::FIRST);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            if (neighbor != vertex)
+            {
+                ret[vertex].insert(neighbor);
+            }
+        }
+    }
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+    {
+        ret[fillEdge.first].insert(fillEdge.second);
+        ret[fillEdge.second].insert(fillEdge.first);
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute the fill edges introduced by the elimination game for the given graph and elimination ordering.
+ *
+ *  @param[in] graph        The input graph.
+ *  @param[in] ordering     The elimination ordering.
+ *
+ *  @return The fill edges in ascending order, each edge given with its endpoints in ascending order.
+ */
+static std::vector<std::pair<htd::vertex_t, htd::vertex_t>> computeEliminationFill(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+    std::vector<std::set<htd::vertex_t>> adjacency = computeAdjacency(graph, ret);
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighborhood(adjacency[vertex].begin(), adjacency[vertex].end());
+
+        for (auto it = neighborhood.begin(); it != neighborhood.end(); ++it)
+        {
+            adjacency[*it].erase(vertex);
+
+            for (auto it2 = it + 1; it2 != neighborhood.end(); ++it2)
+            {
+                if (adjacency[*it].insert(*it2).second)
+                {
+                    adjacency[*it2].insert(*it);
+
+                    ret.emplace_back(*it, *it2);
+                }
+            }
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    return ret;
+}
+
+/**
+ *  Check whether the given graph extended by the given fill edges is a minimal triangulation, i.e., whether each fill
+ *  edge is the unique chord of a cycle of length four.
+ *
+ *  @param[in] graph        The input graph.
+ *  @param[in] fillEdges    The fill edges.
+ *
+ *  @return True if no fill edge can be removed individually, false otherwise.
+ */
+static bool isMinimalFill(const htd::IMultiHypergraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges)
+{
+    bool ret = true;
+
+    std::vector<std::set<htd::vertex_t>> adjacency = computeAdjacency(graph, fillEdges);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+    {
+        std::vector<htd::vertex_t> commonNeighbors;
+
+        std::set_intersection(adjacency[fillEdge.first].begin(), adjacency[fillEdge.first].end(),
+                              adjacency[fillEdge.second].begin(), adjacency[fillEdge.second].end(),
+                              std::back_inserter(commonNeighbors));
+
+        bool chord = false;
+
+        for (auto it = commonNeighbors.begin(); !chord && it != commonNeighbors.end(); ++it)
+        {
+            for (auto it2 = it + 1; !chord && it2 != commonNeighbors.end(); ++it2)
+            {
+                chord = adjacency[*it].count(*it2) == 0;
+            }
+        }
+
+        ret = ret && chord;
+    }
+
+    return ret;
+}
+
+/**
+ *  Check whether the given sequence is a permutation of the vertices of the given graph.
+ *
+ *  @param[in] graph    The input graph.
+ *  @param[in] sequence The sequence of vertices.
+ *
+ *  @return True if the given sequence is a permutation of the vertices of the given graph, false otherwise.
+ */
+static bool isPermutation(const htd::IMultiHypergraph & graph, std::vector<htd::vertex_t> sequence)
+{
+    std::sort(sequence.begin(), sequence.end());
+
+    std::vector<htd::vertex_t> vertices;
+
+    graph.copyVerticesTo(vertices);
+
+    return sequence == vertices;
+}
+
+TEST(EnhancedMaximumCardinalitySearchOrderingAlgorithmTest, CheckResultChordalGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(1, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(4, 6);
+
+    for (bool lexicographicSearchEnabled : { false, true })
+    {
+        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+        algorithm.setLexicographicSearchEnabled(lexicographicSearchEnabled);
+
+        EXPECT_EQ(lexicographicSearchEnabled, algorithm.isLexicographicSearchEnabled());
+
+        std::vector<htd::vertex_t> ordering;
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+        algorithm.computeMinimalTriangulation(graph, ordering, fillEdges);
+
+        EXPECT_TRUE(isPermutation(graph, ordering));
+
+        EXPECT_TRUE(fillEdges.empty());
+
+        htd::IVertexOrdering * vertexOrdering = algorithm.computeOrdering(graph);
+
+        ASSERT_NE(vertexOrdering, nullptr);
+
+        EXPECT_TRUE(isPermutation(graph, vertexOrdering->sequence()));
+
+        EXPECT_TRUE(computeEliminationFill(graph, vertexOrdering->sequence()).empty());
+
+        delete vertexOrdering;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(EnhancedMaximumCardinalitySearchOrderingAlgorithmTest, CheckResultCycle)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t size = 8;
+
+    htd::MultiHypergraph graph(libraryInstance, size);
+
+    for (htd::vertex_t vertex = 1; vertex <= size; ++vertex)
+    {
+        graph.addEdge(vertex, (htd::vertex_t)(vertex % size + 1));
+    }
+
+    for (bool lexicographicSearchEnabled : { false, true })
+    {
+        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+        algorithm.setLexicographicSearchEnabled(lexicographicSearchEnabled);
+
+        std::vector<htd::vertex_t> ordering;
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+        algorithm.computeMinimalTriangulation(graph, ordering, fillEdges);
+
+        EXPECT_TRUE(isPermutation(graph, ordering));
+
+        /* Each minimal triangulation of a cycle of length n contains exactly n - 3 chords. */
+        EXPECT_EQ(size - 3, fillEdges.size());
+
+        std::sort(fillEdges.begin(), fillEdges.end());
+
+        EXPECT_EQ(computeEliminationFill(graph, ordering), fillEdges);
+    }
+
+    delete libraryInstance;
+}
+
+TEST(EnhancedMaximumCardinalitySearchOrderingAlgorithmTest, CheckResultRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (htd::index_t iteration = 0; iteration < 40; ++iteration)
+    {
+        std::size_t vertexCount = 2 + generator() % 40;
+
+        htd::MultiHypergraph * graph = createRandomGraph(libraryInstance, vertexCount, generator() % (3 * vertexCount), generator);
+
+        for (bool lexicographicSearchEnabled : { false, true })
+        {
+            htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+            algorithm.setLexicographicSearchEnabled(lexicographicSearchEnabled);
+
+            std::vector<htd::vertex_t> ordering;
+
+            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+            algorithm.computeMinimalTriangulation(*graph, ordering, fillEdges);
+
+            ASSERT_TRUE(isPermutation(*graph, ordering));
+
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+            {
+                EXPECT_LT(fillEdge.first, fillEdge.second);
+            }
+
+            std::sort(fillEdges.begin(), fillEdges.end());
+
+            /* The fill edges must be exactly the fill edges of the elimination game for the computed ordering. */
+            EXPECT_EQ(computeEliminationFill(*graph, ordering), fillEdges);
+
+            EXPECT_TRUE(isMinimalFill(*graph, fillEdges));
+
+            htd::IVertexOrdering * vertexOrdering = algorithm.computeOrdering(*graph);
+
+            ASSERT_NE(vertexOrdering, nullptr);
+
+            EXPECT_TRUE(isPermutation(*graph, vertexOrdering->sequence()));
+
+            delete vertexOrdering;
+        }
+
+        htd::TriangulationMinimizationOrderingAlgorithm minimizationAlgorithm(libraryInstance);
+
+        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm * triangulationAlgorithm = new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(libraryInstance);
+
+        triangulationAlgorithm->setLexicographicSearchEnabled(iteration % 2 == 0);
+
+        minimizationAlgorithm.setMinimalTriangulationAlgorithm(triangulationAlgorithm);
+
+        htd::IVertexOrdering * vertexOrdering = minimizationAlgorithm.computeOrdering(*graph);
+
+        ASSERT_NE(vertexOrdering, nullptr);
+
+        EXPECT_TRUE(isPermutation(*graph, vertexOrdering->sequence()));
+
+        delete vertexOrdering;
+
+        delete graph;
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
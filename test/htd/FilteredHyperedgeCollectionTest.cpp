@@ -348,6 +348,37 @@ TEST(FilteredHyperedgeCollectionTest, TestRestriction)
     ASSERT_EQ((std::size_t)0, hyperedges2.size());
 }
 
+TEST(FilteredHyperedgeCollectionTest, TestAssignmentToEmptyCollection)
+{
+    htd::Hyperedge h1(1, 1, 2);
+    htd::Hyperedge h2(2, 2, 3);
+
+    std::vector<htd::Hyperedge> inputEdges1 { h1, h2 };
+
+    htd::FilteredHyperedgeCollection hyperedges1(new htd::HyperedgeVector(inputEdges1), std::vector<htd::index_t> { 0, 1 });
+
+    htd::FilteredHyperedgeCollection hyperedges2;
+    htd::FilteredHyperedgeCollection hyperedges3;
+    htd::FilteredHyperedgeCollection hyperedges4(hyperedges3);
+
+    hyperedges2 = hyperedges1;
+
+    ASSERT_EQ((std::size_t)2, hyperedges2.size());
+    ASSERT_EQ((std::size_t)0, hyperedges3.size());
+    ASSERT_EQ((std::size_t)0, hyperedges4.size());
+
+    hyperedges2.restrictTo(std::vector<htd::vertex_t> { 1, 2 });
+
+    ASSERT_EQ((std::size_t)2, hyperedges1.size());
+    ASSERT_EQ((std::size_t)1, hyperedges2.size());
+
+    hyperedges4 = hyperedges2;
+
+    ASSERT_EQ((std::size_t)1, hyperedges4.size());
+    ASSERT_EQ((std::size_t)0, hyperedges3.size());
+    ASSERT_EQ((std::size_t)0, htd::FilteredHyperedgeCollection().size());
+}
+
 TEST(FilteredHyperedgeCollectionTest, TestSwapMethod)
 {
     htd::Hyperedge h1(1, 1, 2);
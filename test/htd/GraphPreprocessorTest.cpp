@@ -61,6 +61,55 @@ bool isValidOrdering(htd::MultiHypergraph & graph, const std::vector<htd::vertex
     return sortedVertices == graph.vertexVector();
 }
 
+std::vector<htd::vertex_t> remainingVertexNames(const htd::IPreprocessedGraph & preprocessedGraph)
+{
+    std::vector<htd::vertex_t> ret;
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        ret.push_back(preprocessedGraph.vertexName(vertex));
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    return ret;
+}
+
+std::vector<std::pair<htd::vertex_t, htd::vertex_t>> remainingEdges(const htd::IPreprocessedGraph & preprocessedGraph)
+{
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+        {
+            if (preprocessedGraph.vertexName(vertex) < preprocessedGraph.vertexName(neighbor))
+            {
+                ret.emplace_back(preprocessedGraph.vertexName(vertex), preprocessedGraph.vertexName(neighbor));
+            }
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    return ret;
+}
+
+std::vector<std::pair<htd::vertex_t, htd::vertex_t>> cliqueEdges(const std::vector<htd::vertex_t> & vertices)
+{
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+    for (auto it1 = vertices.begin(); it1 != vertices.end(); ++it1)
+    {
+        for (auto it2 = it1 + 1; it2 != vertices.end(); ++it2)
+        {
+            ret.emplace_back(*it1, *it2);
+        }
+    }
+
+    return ret;
+}
+
 TEST(GraphPreprocessorTest, CheckCloneMethod)
 {
     htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
@@ -1457,6 +1506,400 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+TEST(GraphPreprocessorTest, CheckEliminationOfVerticesOfDegreeLessThanTwo)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(4, 6);
+    graph.addEdge(4, 7);
+    graph.addEdge(5, 6);
+    graph.addEdge(5, 7);
+    graph.addEdge(6, 7);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), preprocessedGraph->eliminationSequence());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 4, 5, 6, 7 }), remainingVertexNames(*preprocessedGraph));
+    EXPECT_EQ(cliqueEdges({ 4, 5, 6, 7 }), remainingEdges(*preprocessedGraph));
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckContractionOfPaths)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(3, 4);
+    graph.addEdge(1, 5);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 2);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 5, 6 }), preprocessedGraph->eliminationSequence());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), remainingVertexNames(*preprocessedGraph));
+    EXPECT_EQ(cliqueEdges({ 1, 2, 3, 4 }), remainingEdges(*preprocessedGraph));
+
+    EXPECT_EQ((std::size_t)2, preprocessedGraph->minTreeWidth());
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckShrinkingOfTriangles)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 4);
+    graph.addEdge(1, 5);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(3, 4);
+    graph.addEdge(3, 5);
+    graph.addEdge(4, 5);
+    graph.addEdge(6, 1);
+    graph.addEdge(6, 2);
+    graph.addEdge(6, 3);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(2);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    /* Vertex 3 has the adjacent neighbors 4 and 5, hence it is eliminated and vertex 6 becomes adjacent to 4 and 5. */
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 3 }), preprocessedGraph->eliminationSequence());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 4, 5, 6 }), remainingVertexNames(*preprocessedGraph));
+    EXPECT_EQ(cliqueEdges({ 1, 2, 4, 5, 6 }), remainingEdges(*preprocessedGraph));
+
+    EXPECT_EQ((std::size_t)3, preprocessedGraph->minTreeWidth());
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckBuddiesAreRetained)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(1, 5);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(3, 6);
+    graph.addEdge(3, 7);
+    graph.addEdge(4, 6);
+    graph.addEdge(4, 7);
+    graph.addEdge(5, 6);
+    graph.addEdge(5, 7);
+    graph.addEdge(6, 7);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(2);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    /* Vertices 1 and 2 are buddies, i.e., they share the three neighbors 3, 4 and 5. The preprocessor does not apply the buddy rule, hence the graph is retained. */
+    EXPECT_TRUE(preprocessedGraph->eliminationSequence().empty());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5, 6, 7 }), remainingVertexNames(*preprocessedGraph));
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> expectedEdges { { 1, 3 }, { 1, 4 }, { 1, 5 }, { 2, 3 }, { 2, 4 }, { 2, 5 },
+                                                                        { 3, 6 }, { 3, 7 }, { 4, 6 }, { 4, 7 }, { 5, 6 }, { 5, 7 }, { 6, 7 } };
+
+    EXPECT_EQ(expectedEdges, remainingEdges(*preprocessedGraph));
+
+    EXPECT_EQ((std::size_t)3, preprocessedGraph->minTreeWidth());
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckEliminationOfSimplicialVertices)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    /* Vertices 1 to 6 form an octahedron, i.e., the complete graph without the edges {1, 2}, {3, 4} and {5, 6}. */
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(1, 5);
+    graph.addEdge(1, 6);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(2, 6);
+    graph.addEdge(3, 5);
+    graph.addEdge(3, 6);
+    graph.addEdge(4, 5);
+    graph.addEdge(4, 6);
+    graph.addEdge(7, 1);
+    graph.addEdge(7, 3);
+    graph.addEdge(7, 5);
+    graph.addEdge(7, 8);
+    graph.addEdge(8, 1);
+    graph.addEdge(8, 3);
+    graph.addEdge(8, 5);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 7, 8 }), preprocessedGraph->eliminationSequence());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5, 6 }), remainingVertexNames(*preprocessedGraph));
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> expectedEdges { { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 6 },
+                                                                        { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 },
+                                                                        { 3, 5 }, { 3, 6 }, { 4, 5 }, { 4, 6 } };
+
+    EXPECT_EQ(expectedEdges, remainingEdges(*preprocessedGraph));
+
+    EXPECT_EQ((std::size_t)4, preprocessedGraph->minTreeWidth());
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckEliminationOfAlmostSimplicialVertices)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 9);
+
+    /* Vertices 1 to 6 form an octahedron, i.e., the complete graph without the edges {1, 2}, {3, 4} and {5, 6}. */
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(1, 5);
+    graph.addEdge(1, 6);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(2, 6);
+    graph.addEdge(3, 5);
+    graph.addEdge(3, 6);
+    graph.addEdge(4, 5);
+    graph.addEdge(4, 6);
+    graph.addEdge(7, 1);
+    graph.addEdge(7, 3);
+    graph.addEdge(7, 5);
+    graph.addEdge(7, 8);
+    graph.addEdge(8, 1);
+    graph.addEdge(8, 3);
+    graph.addEdge(8, 5);
+    graph.addEdge(9, 2);
+    graph.addEdge(9, 4);
+    graph.addEdge(9, 6);
+    graph.addEdge(9, 8);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    /* Vertex 7 is simplicial. Afterwards, vertex 8 is almost simplicial because its neighbors
+       except for vertex 9 form a clique, hence it is eliminated and vertex 9 becomes adjacent
+       to vertices 1, 3 and 5. */
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 7, 8 }), preprocessedGraph->eliminationSequence());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5, 6, 9 }), remainingVertexNames(*preprocessedGraph));
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> expectedEdges { { 1, 3 }, { 1, 4 }, { 1, 5 }, { 1, 6 }, { 1, 9 },
+                                                                        { 2, 3 }, { 2, 4 }, { 2, 5 }, { 2, 6 }, { 2, 9 },
+                                                                        { 3, 5 }, { 3, 6 }, { 3, 9 }, { 4, 5 }, { 4, 6 },
+                                                                        { 4, 9 }, { 5, 9 }, { 6, 9 } };
+
+    EXPECT_EQ(expectedEdges, remainingEdges(*preprocessedGraph));
+
+    EXPECT_EQ((std::size_t)4, preprocessedGraph->minTreeWidth());
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckFullPreprocessingResultsInValidDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (std::size_t vertexCount = 10; vertexCount <= 200; vertexCount += 10)
+    {
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        unsigned int state = (unsigned int)vertexCount;
+
+        for (std::size_t edge = 0; edge < 2 * vertexCount; ++edge)
+        {
+            state = state * 1103515245 + 12345;
+
+            htd::vertex_t vertex1 = (htd::vertex_t)((state >> 16) % vertexCount) + htd::Vertex::FIRST;
+
+            state = state * 1103515245 + 12345;
+
+            htd::vertex_t vertex2 = (htd::vertex_t)((state >> 16) % vertexCount) + htd::Vertex::FIRST;
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        /* The strategy chosen by 'htd_main --preprocessing full'. */
+        preprocessor.setPreprocessingStrategy(3);
+
+        const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        ASSERT_EQ(graph.vertexCount(), preprocessedGraph->remainingVertices().size() +
+                                       preprocessedGraph->eliminationSequence().size());
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_GE(decomposition->maximumBagSize(), preprocessedGraph->minTreeWidth() + 1);
+
+        delete decomposition;
+
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckBiconnectedComponentPreprocessingIsIndependentOfThreadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    /* Add a torus graph with the given dimensions whose first vertex is either the given one or a new vertex. */
+    auto addTorus = [&](std::size_t rows, std::size_t columns, htd::vertex_t firstVertex)
+    {
+        std::vector<htd::vertex_t> torusVertices { firstVertex == htd::Vertex::UNKNOWN ? graph.addVertex() : firstVertex };
+
+        while (torusVertices.size() < rows * columns)
+        {
+            torusVertices.push_back(graph.addVertex());
+        }
+
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            for (std::size_t column = 0; column < columns; ++column)
+            {
+                graph.addEdge(torusVertices[row * columns + column], torusVertices[row * columns + (column + 1) % columns]);
+                graph.addEdge(torusVertices[row * columns + column], torusVertices[((row + 1) % rows) * columns + column]);
+            }
+        }
+
+        return torusVertices;
+    };
+
+    /* The largest biconnected component is a torus of size 4x5 to which eight tori of size 4x4 are attached via articulation points. */
+    std::vector<htd::vertex_t> centralVertices = addTorus(4, 5, htd::Vertex::UNKNOWN);
+
+    for (std::size_t index = 0; index < 8; ++index)
+    {
+        addTorus(4, 4, centralVertices[2 * index]);
+    }
+
+    std::vector<htd::vertex_t> expectedEliminationSequence;
+    std::vector<htd::vertex_t> expectedRemainingVertices;
+
+    for (std::size_t threadCount : { 1, 2, 4 })
+    {
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(4);
+
+        preprocessor.setThreadCount(threadCount);
+
+        htd::setThreadLocalRandomSeed(42);
+
+        const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        htd::resetThreadLocalRandomSeed();
+
+        ASSERT_EQ(graph.vertexCount(), preprocessedGraph->remainingVertices().size() +
+                                       preprocessedGraph->eliminationSequence().size());
+
+        if (threadCount == 1)
+        {
+            expectedEliminationSequence = preprocessedGraph->eliminationSequence();
+            expectedRemainingVertices = remainingVertexNames(*preprocessedGraph);
+
+            EXPECT_EQ(centralVertices, expectedRemainingVertices);
+        }
+        else
+        {
+            EXPECT_EQ(expectedEliminationSequence, preprocessedGraph->eliminationSequence());
+            EXPECT_EQ(expectedRemainingVertices, remainingVertexNames(*preprocessedGraph));
+        }
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        delete decomposition;
+
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
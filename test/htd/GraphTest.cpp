@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 class GraphTest : public ::testing::Test
@@ -504,6 +506,44 @@ TEST(GraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(GraphTest, CheckSpanAccess)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Graph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+
+    graph.addEdge(vertex3, vertex1);
+    graph.addEdge(vertex1, vertex2);
+
+    const htd::ConstSpan<htd::vertex_t> vertices = graph.vertexSpan();
+
+    ASSERT_EQ((std::size_t)3, vertices.size());
+    ASSERT_EQ(vertex1, vertices[0]);
+    ASSERT_EQ(vertex2, vertices[1]);
+    ASSERT_EQ(vertex3, vertices[2]);
+
+    std::vector<htd::vertex_t> buffer;
+
+    const htd::ConstSpan<htd::vertex_t> neighbors = graph.neighborSpan(vertex1, buffer);
+
+    ASSERT_EQ((std::size_t)2, neighbors.size());
+    ASSERT_EQ(vertex2, neighbors[0]);
+    ASSERT_EQ(vertex3, neighbors[1]);
+
+    ASSERT_TRUE(std::equal(neighbors.begin(), neighbors.end(), graph.neighbors(vertex1).begin()));
+
+    ASSERT_EQ((std::size_t)1, graph.neighborSpan(vertex2, buffer).size());
+    ASSERT_EQ(vertex1, graph.neighborSpan(vertex3, buffer).at(0));
+
+    ASSERT_THROW(graph.neighborSpan(vertex3, buffer).at(1), std::out_of_range);
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
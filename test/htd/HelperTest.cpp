@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
 #include <vector>
 
 class HelperTest : public ::testing::Test
@@ -714,6 +717,97 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+/**
+ *  Create a random set of vertices sorted in ascending order.
+ *
+ *  @param[in] generator    The random number generator.
+ *  @param[in] size         The maximum size of the set.
+ *  @param[in] universe     The number of vertices from which the elements of the set are drawn.
+ *
+ *  @return A random set of vertices sorted in ascending order.
+ */
+static std::vector<htd::vertex_t> createRandomSortedSet(std::mt19937 & generator, std::size_t size, std::size_t universe)
+{
+    std::uniform_int_distribution<std::size_t> distribution(1, universe);
+
+    std::vector<htd::vertex_t> ret;
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        ret.push_back(static_cast<htd::vertex_t>(distribution(generator)));
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+
+    return ret;
+}
+
+TEST(HelperTest, CheckSetKernelsAgainstStandardAlgorithms)
+{
+    std::mt19937 generator(42);
+
+    std::vector<std::pair<std::size_t, std::size_t>> sizes { { 0, 0 }, { 0, 17 }, { 5, 3 }, { 8, 8 }, { 13, 40 }, { 64, 64 },
+                                                             { 100, 3 }, { 3, 500 }, { 1000, 1000 }, { 7, 4000 }, { 4000, 1 } };
+
+    for (const std::pair<std::size_t, std::size_t> & size : sizes)
+    {
+        for (std::size_t universe : { (std::size_t)16, (std::size_t)200, (std::size_t)10000 })
+        {
+            for (std::size_t iteration = 0; iteration < 10; ++iteration)
+            {
+                std::vector<htd::vertex_t> input1 = createRandomSortedSet(generator, size.first, universe);
+                std::vector<htd::vertex_t> input2 = createRandomSortedSet(generator, size.second, universe);
+
+                std::vector<htd::vertex_t> expectedIntersection;
+                std::vector<htd::vertex_t> expectedDifference1;
+                std::vector<htd::vertex_t> expectedDifference2;
+                std::vector<htd::vertex_t> expectedUnion;
+
+                std::set_intersection(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedIntersection));
+                std::set_difference(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedDifference1));
+                std::set_difference(input2.begin(), input2.end(), input1.begin(), input1.end(), std::back_inserter(expectedDifference2));
+                std::set_union(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedUnion));
+
+                std::vector<htd::vertex_t> actualIntersection;
+                std::vector<htd::vertex_t> actualDifference;
+                std::vector<htd::vertex_t> actualUnion;
+
+                htd::set_intersection(input1, input2, actualIntersection);
+
+                ASSERT_EQ(expectedIntersection, actualIntersection);
+
+                htd::set_difference(input1, input2, actualDifference);
+
+                ASSERT_EQ(expectedDifference1, actualDifference);
+
+                ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(input1, input2));
+                ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(input2, input1));
+
+                const std::tuple<std::size_t, std::size_t, std::size_t> & analysis = htd::analyze_sets(input1, input2);
+
+                ASSERT_EQ(expectedDifference1.size(), std::get<0>(analysis));
+                ASSERT_EQ(expectedIntersection.size(), std::get<1>(analysis));
+                ASSERT_EQ(expectedDifference2.size(), std::get<2>(analysis));
+
+                const std::pair<std::size_t, std::size_t> & symmetricDifference = htd::symmetric_difference_sizes(input1, input2);
+
+                ASSERT_EQ(expectedDifference1.size(), symmetricDifference.first);
+                ASSERT_EQ(expectedDifference2.size(), symmetricDifference.second);
+
+                htd::vertex_t ignoredVertex = expectedUnion.empty() ? 1 : expectedUnion[expectedUnion.size() / 2];
+
+                expectedUnion.erase(std::remove(expectedUnion.begin(), expectedUnion.end(), ignoredVertex), expectedUnion.end());
+
+                htd::set_union(input1, input2, ignoredVertex, actualUnion);
+
+                ASSERT_EQ(expectedUnion, actualUnion);
+            }
+        }
+    }
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
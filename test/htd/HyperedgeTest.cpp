@@ -942,6 +942,53 @@ TEST(HyperedgeTest, CheckSetElements)
     ASSERT_EQ((htd::vertex_t)1, hyperedge1.sortedElements()[0]);
 }
 
+TEST(HyperedgeTest, CheckEraseAndCopy)
+{
+    htd::Hyperedge hyperedge1((htd::id_t)1, std::vector<htd::vertex_t> { 5, 3, 3, 1 });
+
+    ASSERT_EQ((std::size_t)4, hyperedge1.size());
+    ASSERT_EQ((std::size_t)3, hyperedge1.sortedElements().size());
+    ASSERT_EQ((htd::vertex_t)1, hyperedge1.sortedElements()[0]);
+    ASSERT_EQ((htd::vertex_t)3, hyperedge1.sortedElements()[1]);
+    ASSERT_EQ((htd::vertex_t)5, hyperedge1.sortedElements()[2]);
+
+    htd::Hyperedge hyperedge2(hyperedge1);
+
+    hyperedge1.erase(5);
+
+    ASSERT_EQ((std::size_t)3, hyperedge1.size());
+    ASSERT_EQ((std::size_t)2, hyperedge1.sortedElements().size());
+    ASSERT_FALSE(hyperedge1.contains(5));
+    ASSERT_TRUE(hyperedge2.contains(5));
+
+    hyperedge1.erase(3);
+
+    ASSERT_EQ((std::size_t)1, hyperedge1.size());
+    ASSERT_EQ((std::size_t)1, hyperedge1.sortedElements().size());
+    ASSERT_TRUE(hyperedge1.elements() == hyperedge1.sortedElements());
+    ASSERT_TRUE(hyperedge1.contains(1));
+    ASSERT_FALSE(hyperedge1.contains(3));
+
+    hyperedge1 = hyperedge2;
+
+    ASSERT_TRUE(hyperedge1 == hyperedge2);
+    ASSERT_TRUE(hyperedge1.sortedElements() == hyperedge2.sortedElements());
+
+    hyperedge2.setElements(4, 2);
+
+    ASSERT_EQ((htd::vertex_t)4, hyperedge2[0]);
+    ASSERT_EQ((htd::vertex_t)2, hyperedge2[1]);
+    ASSERT_EQ((htd::vertex_t)2, hyperedge2.sortedElements()[0]);
+    ASSERT_EQ((htd::vertex_t)4, hyperedge2.sortedElements()[1]);
+
+    hyperedge2.setElements(2, 4);
+
+    ASSERT_EQ((std::size_t)2, hyperedge2.sortedElements().size());
+    ASSERT_TRUE(hyperedge2.elements() == hyperedge2.sortedElements());
+    ASSERT_TRUE(hyperedge2.contains(4));
+    ASSERT_FALSE(hyperedge2.contains(3));
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,423 @@
+/*
+ * File:   MaxFlowAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+class MaxFlowAlgorithmTest : public ::testing::Test
+{
+    public:
+        MaxFlowAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MaxFlowAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the capacity of a minimum cut between the source and the target vertex by enumerating all cuts.
+ *
+ *  @param[in] flowNetwork  The flow network.
+ *  @param[in] source       The source vertex.
+ *  @param[in] target       The target vertex.
+ *
+ *  @return The capacity of a minimum cut between the source and the target vertex.
+ */
+static std::size_t computeMinimumCutCapacity(const htd::FlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target)
+{
+    std::size_t ret = (std::size_t)-1;
+
+    std::size_t vertexCount = flowNetwork.vertexCount();
+
+    for (std::size_t subset = 0; subset < ((std::size_t)1 << vertexCount); ++subset)
+    {
+        if ((subset & ((std::size_t)1 << source)) != 0 && (subset & ((std::size_t)1 << target)) == 0)
+        {
+            std::size_t capacity = 0;
+
+            for (htd::vertex_t vertex1 = 0; vertex1 < vertexCount; ++vertex1)
+            {
+                for (htd::vertex_t vertex2 = 0; vertex2 < vertexCount; ++vertex2)
+                {
+                    if ((subset & ((std::size_t)1 << vertex1)) != 0 && (subset & ((std::size_t)1 << vertex2)) == 0)
+                    {
+                        capacity += flowNetwork.capacity(vertex1, vertex2);
+                    }
+                }
+            }
+
+            ret = std::min(ret, capacity);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Check whether the given flow respects the capacities and the flow conservation of the flow network.
+ *
+ *  @param[in] flowNetwork  The flow network.
+ *  @param[in] flow         The flow.
+ */
+static void verifyFlow(const htd::FlowNetworkStructure & flowNetwork, const htd::IFlow & flow)
+{
+    std::size_t vertexCount = flowNetwork.vertexCount();
+
+    for (htd::vertex_t vertex1 = 0; vertex1 < vertexCount; ++vertex1)
+    {
+        long long inflow = 0;
+
+        for (htd::vertex_t vertex2 = 0; vertex2 < vertexCount; ++vertex2)
+        {
+            EXPECT_LE(flow.flow(vertex1, vertex2), (long long)flowNetwork.capacity(vertex1, vertex2));
+
+            EXPECT_EQ(flow.flow(vertex1, vertex2), -flow.flow(vertex2, vertex1));
+
+            inflow += flow.flow(vertex2, vertex1);
+        }
+
+        if (vertex1 != flow.source() && vertex1 != flow.target())
+        {
+            EXPECT_EQ(0, inflow);
+        }
+        else if (vertex1 == flow.target())
+        {
+            EXPECT_EQ((long long)flow.value(), inflow);
+        }
+    }
+}
+
+/**
+ *  Maximum flow algorithm which relies on the default implementation for residual networks.
+ */
+class AugmentingPathMaxFlowAlgorithm : public htd::IMaxFlowAlgorithm
+{
+    public:
+        AugmentingPathMaxFlowAlgorithm(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+        {
+
+        }
+
+        virtual ~AugmentingPathMaxFlowAlgorithm()
+        {
+
+        }
+
+        using htd::IMaxFlowAlgorithm::determineMaximumFlow;
+
+        const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return managementInstance_;
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+        {
+            managementInstance_ = manager;
+        }
+
+        htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE
+        {
+            htd::ResidualNetwork residualNetwork(flowNetwork);
+
+            determineMaximumFlow(residualNetwork, source, target, (std::size_t)-1);
+
+            return residualNetwork.createFlow(source, target);
+        }
+
+        AugmentingPathMaxFlowAlgorithm * clone(void) const HTD_OVERRIDE
+        {
+            return new AugmentingPathMaxFlowAlgorithm(managementInstance_);
+        }
+
+    private:
+        const htd::LibraryInstance * managementInstance_;
+};
+
+TEST(MaxFlowAlgorithmTest, CheckFlowNetworkStructure)
+{
+    htd::FlowNetworkStructure flowNetwork(5);
+
+    EXPECT_FALSE(flowNetwork.isConnected());
+    EXPECT_EQ((std::size_t)5, flowNetwork.isolatedVertexCount());
+
+    flowNetwork.updateCapacity(0, 2, 3);
+    flowNetwork.updateCapacity(0, 1, 5);
+    flowNetwork.updateCapacity(1, 2, 7);
+    flowNetwork.updateCapacity(0, 2, 4);
+
+    EXPECT_EQ((std::size_t)3, flowNetwork.edgeCount());
+    EXPECT_EQ((std::size_t)5, flowNetwork.capacity(0, 1));
+    EXPECT_EQ((std::size_t)4, flowNetwork.capacity(0, 2));
+    EXPECT_EQ((std::size_t)7, flowNetwork.capacity(1, 2));
+    EXPECT_EQ((std::size_t)0, flowNetwork.capacity(2, 0));
+    EXPECT_EQ((std::size_t)0, flowNetwork.capacity(3, 4));
+
+    EXPECT_TRUE(flowNetwork.isConnected(0, 2));
+    EXPECT_FALSE(flowNetwork.isConnected(2, 0));
+    EXPECT_FALSE(flowNetwork.isConnected(0, 3));
+    EXPECT_TRUE(flowNetwork.isConnected(3, 3));
+
+    EXPECT_FALSE(flowNetwork.isIsolatedVertex(2));
+    EXPECT_TRUE(flowNetwork.isIsolatedVertex(3));
+
+    std::vector<htd::vertex_t> expectedIsolatedVertices { 3, 4 };
+
+    const htd::ConstCollection<htd::vertex_t> & isolatedVertices = flowNetwork.isolatedVertices();
+
+    EXPECT_EQ(expectedIsolatedVertices, std::vector<htd::vertex_t>(isolatedVertices.begin(), isolatedVertices.end()));
+
+    flowNetwork.updateCapacity(2, 3, 1);
+    flowNetwork.updateCapacity(3, 4, 1);
+
+    EXPECT_TRUE(flowNetwork.isConnected());
+    EXPECT_EQ((std::size_t)0, flowNetwork.isolatedVertexCount());
+
+    flowNetwork.updateCapacity(4, 1, 1);
+
+    htd::FlowNetworkStructure * clonedFlowNetwork = flowNetwork.clone();
+
+    EXPECT_FALSE(clonedFlowNetwork->isConnected(4, 0));
+    EXPECT_TRUE(clonedFlowNetwork->isConnected(4, 2));
+    EXPECT_EQ((std::size_t)4, clonedFlowNetwork->capacity(0, 2));
+
+    delete clonedFlowNetwork;
+}
+
+TEST(MaxFlowAlgorithmTest, CheckSimpleNetwork)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::FlowNetworkStructure flowNetwork(6);
+
+    flowNetwork.updateCapacity(0, 1, 10);
+    flowNetwork.updateCapacity(0, 2, 10);
+    flowNetwork.updateCapacity(1, 2, 2);
+    flowNetwork.updateCapacity(1, 3, 4);
+    flowNetwork.updateCapacity(1, 4, 8);
+    flowNetwork.updateCapacity(2, 4, 9);
+    flowNetwork.updateCapacity(3, 5, 10);
+    flowNetwork.updateCapacity(4, 3, 6);
+    flowNetwork.updateCapacity(4, 5, 10);
+
+    std::vector<std::unique_ptr<htd::IMaxFlowAlgorithm>> algorithms;
+
+    algorithms.emplace_back(new htd::DinitzMaxFlowAlgorithm(libraryInstance));
+    algorithms.emplace_back(new htd::PushRelabelMaxFlowAlgorithm(libraryInstance));
+    algorithms.emplace_back(new AugmentingPathMaxFlowAlgorithm(libraryInstance));
+
+    for (const std::unique_ptr<htd::IMaxFlowAlgorithm> & algorithm : algorithms)
+    {
+        htd::IFlow * flow = algorithm->determineMaximumFlow(flowNetwork, 0, 5);
+
+        ASSERT_NE(flow, nullptr);
+
+        EXPECT_EQ((std::size_t)6, flow->vertexCount());
+        EXPECT_EQ((htd::vertex_t)0, flow->source());
+        EXPECT_EQ((htd::vertex_t)5, flow->target());
+        EXPECT_EQ((std::size_t)19, flow->value());
+
+        verifyFlow(flowNetwork, *flow);
+
+        delete flow;
+
+        htd::IMaxFlowAlgorithm * clonedAlgorithm = algorithm->clone();
+
+        htd::ResidualNetwork residualNetwork(flowNetwork);
+
+        EXPECT_EQ((std::size_t)19, clonedAlgorithm->determineMaximumFlow(residualNetwork, 0, 5, (std::size_t)-1));
+        EXPECT_EQ((std::size_t)0, clonedAlgorithm->determineMaximumFlow(residualNetwork, 5, 0, (std::size_t)-1));
+        EXPECT_EQ((std::size_t)10, clonedAlgorithm->determineMaximumFlow(residualNetwork, 1, 3, (std::size_t)-1));
+
+        delete clonedAlgorithm;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(MaxFlowAlgorithmTest, CheckInfiniteCapacities)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* Split-vertex network of the path 0 - 1 - 2 in which the vertex at position k is split into the nodes k and k + 3. */
+    htd::FlowNetworkStructure flowNetwork(6);
+
+    for (htd::vertex_t vertex = 0; vertex < 3; ++vertex)
+    {
+        flowNetwork.updateCapacity(vertex, vertex + 3, 1);
+    }
+
+    flowNetwork.updateCapacity(3, 1, (std::size_t)-1);
+    flowNetwork.updateCapacity(4, 0, (std::size_t)-1);
+    flowNetwork.updateCapacity(4, 2, (std::size_t)-1);
+    flowNetwork.updateCapacity(5, 1, (std::size_t)-1);
+
+    htd::DinitzMaxFlowAlgorithm dinitzAlgorithm(libraryInstance);
+    htd::PushRelabelMaxFlowAlgorithm pushRelabelAlgorithm(libraryInstance);
+
+    htd::ResidualNetwork residualNetwork(flowNetwork);
+
+    EXPECT_EQ((std::size_t)1, dinitzAlgorithm.determineMaximumFlow(residualNetwork, 3, 2, (std::size_t)-1));
+    EXPECT_EQ((std::size_t)1, pushRelabelAlgorithm.determineMaximumFlow(residualNetwork, 3, 2, (std::size_t)-1));
+
+    delete libraryInstance;
+}
+
+TEST(MaxFlowAlgorithmTest, CheckFlowLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* Network with 50 disjoint paths of capacity 1 from vertex 0 to vertex 51. */
+    htd::FlowNetworkStructure flowNetwork(52);
+
+    for (htd::vertex_t vertex = 1; vertex <= 50; ++vertex)
+    {
+        flowNetwork.updateCapacity(0, vertex, 1);
+        flowNetwork.updateCapacity(vertex, 51, 1);
+    }
+
+    htd::DinitzMaxFlowAlgorithm dinitzAlgorithm(libraryInstance);
+    htd::PushRelabelMaxFlowAlgorithm pushRelabelAlgorithm(libraryInstance);
+    AugmentingPathMaxFlowAlgorithm augmentingPathAlgorithm(libraryInstance);
+
+    htd::ResidualNetwork residualNetwork(flowNetwork);
+
+    /* Dinitz's algorithm would saturate all paths within its first blocking flow, the limit stops it after three of them. */
+    EXPECT_EQ((std::size_t)3, dinitzAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 3));
+
+    htd::IFlow * flow = residualNetwork.createFlow(0, 51);
+
+    EXPECT_EQ((std::size_t)3, flow->value());
+
+    delete flow;
+
+    EXPECT_EQ((std::size_t)3, augmentingPathAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 3));
+
+    flow = residualNetwork.createFlow(0, 51);
+
+    EXPECT_EQ((std::size_t)3, flow->value());
+
+    delete flow;
+
+    std::size_t pushRelabelValue = pushRelabelAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 3);
+
+    EXPECT_LE((std::size_t)3, pushRelabelValue);
+    EXPECT_GT((std::size_t)50, pushRelabelValue);
+
+    EXPECT_EQ((std::size_t)0, dinitzAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 0));
+    EXPECT_EQ((std::size_t)0, pushRelabelAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 0));
+    EXPECT_EQ((std::size_t)0, augmentingPathAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 0));
+
+    /* A limit above the value of the maximum flow does not affect the result. */
+    EXPECT_EQ((std::size_t)50, dinitzAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 51));
+    EXPECT_EQ((std::size_t)50, pushRelabelAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 51));
+    EXPECT_EQ((std::size_t)50, augmentingPathAlgorithm.determineMaximumFlow(residualNetwork, 0, 51, 51));
+
+    delete libraryInstance;
+}
+
+TEST(MaxFlowAlgorithmTest, CheckRandomNetworks)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    htd::DinitzMaxFlowAlgorithm dinitzAlgorithm(libraryInstance);
+    htd::PushRelabelMaxFlowAlgorithm pushRelabelAlgorithm(libraryInstance);
+    AugmentingPathMaxFlowAlgorithm augmentingPathAlgorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::size_t vertexCount = 2 + iteration % 9;
+
+        std::uniform_int_distribution<std::size_t> edgeDistribution(0, 99);
+        std::uniform_int_distribution<std::size_t> capacityDistribution(1, 20);
+
+        htd::FlowNetworkStructure flowNetwork(vertexCount);
+
+        for (htd::vertex_t vertex1 = 0; vertex1 < vertexCount; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = 0; vertex2 < vertexCount; ++vertex2)
+            {
+                if (vertex1 != vertex2 && edgeDistribution(generator) < 40)
+                {
+                    flowNetwork.updateCapacity(vertex1, vertex2, capacityDistribution(generator));
+                }
+            }
+        }
+
+        htd::ResidualNetwork residualNetwork(flowNetwork);
+
+        for (htd::vertex_t source = 0; source < vertexCount; ++source)
+        {
+            for (htd::vertex_t target = 0; target < vertexCount; ++target)
+            {
+                if (source != target)
+                {
+                    std::size_t expectedValue = computeMinimumCutCapacity(flowNetwork, source, target);
+
+                    std::size_t flowLimit = expectedValue / 2 + 1;
+
+                    EXPECT_EQ(std::min(expectedValue, flowLimit), dinitzAlgorithm.determineMaximumFlow(residualNetwork, source, target, flowLimit));
+                    EXPECT_LE(std::min(expectedValue, flowLimit), pushRelabelAlgorithm.determineMaximumFlow(residualNetwork, source, target, flowLimit));
+                    EXPECT_EQ(std::min(expectedValue, flowLimit), augmentingPathAlgorithm.determineMaximumFlow(residualNetwork, source, target, flowLimit));
+
+                    EXPECT_EQ(expectedValue, dinitzAlgorithm.determineMaximumFlow(residualNetwork, source, target, (std::size_t)-1));
+                    EXPECT_EQ(expectedValue, pushRelabelAlgorithm.determineMaximumFlow(residualNetwork, source, target, (std::size_t)-1));
+                    EXPECT_EQ(expectedValue, augmentingPathAlgorithm.determineMaximumFlow(residualNetwork, source, target, (std::size_t)-1));
+
+                    htd::IFlow * flow = residualNetwork.createFlow(source, target);
+
+                    EXPECT_EQ(expectedValue, flow->value());
+
+                    verifyFlow(flowNetwork, *flow);
+
+                    delete flow;
+                }
+            }
+        }
+    }
+
+    delete libraryInstance;
+}
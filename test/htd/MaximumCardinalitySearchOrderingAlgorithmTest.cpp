@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <random>
+#include <set>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -103,6 +106,50 @@ bool isValidOrdering(htd::MultiHypergraph & graph, const std::vector<htd::vertex
     return ret;
 }
 
+std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    std::unordered_map<htd::vertex_t, std::set<htd::vertex_t>> neighborhood;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            if (neighbor != vertex)
+            {
+                neighborhood[vertex].insert(neighbor);
+            }
+        }
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> currentNeighborhood(neighborhood[vertex].begin(), neighborhood[vertex].end());
+
+        ret = std::max(ret, currentNeighborhood.size() + 1);
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            std::set<htd::vertex_t> & neighborNeighborhood = neighborhood[neighbor];
+
+            neighborNeighborhood.erase(vertex);
+
+            for (htd::vertex_t otherNeighbor : currentNeighborhood)
+            {
+                if (otherNeighbor != neighbor)
+                {
+                    neighborNeighborhood.insert(otherNeighbor);
+                }
+            }
+        }
+
+        neighborhood.erase(vertex);
+    }
+
+    return ret;
+}
+
 TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckEmptyGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -771,6 +818,99 @@ TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckSize50Graph)
     delete libraryInstance;
 }
 
+TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckMaximumBagSizeRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (htd::index_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::size_t vertexCount = 1 + generator() % 60;
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        std::size_t edgeCount = generator() % (4 * vertexCount);
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+            htd::vertex_t vertex2 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::MaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+        algorithm.setRandomTieBreakingEnabled(iteration % 2 == 0);
+
+        htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+        std::size_t maxBagSize = computeMaximumBagSize(graph, ordering->sequence());
+
+        EXPECT_EQ(maxBagSize, ordering->maximumBagSize());
+
+        htd::MultiHypergraph graphCopy(graph);
+
+        EXPECT_TRUE(isValidOrdering(graphCopy, ordering->sequence()));
+
+        delete ordering;
+
+        if (maxBagSize > 1)
+        {
+            algorithm.setRandomTieBreakingEnabled(false);
+
+            htd::IWidthLimitedVertexOrdering * referenceOrdering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+            /* A width limit below the bag size of the deterministic ordering must lead to an early abort. */
+            htd::IWidthLimitedVertexOrdering * limitedOrdering = algorithm.computeOrdering(graph, referenceOrdering->maximumBagSize() - 1, 1);
+
+            EXPECT_GT(limitedOrdering->maximumBagSize(), referenceOrdering->maximumBagSize() - 1);
+
+            EXPECT_EQ((std::size_t)1, limitedOrdering->requiredIterations());
+
+            delete limitedOrdering;
+
+            /* Without random tie-breaking, the ordering is deterministic. */
+            htd::IWidthLimitedVertexOrdering * repeatedOrdering = algorithm.computeOrdering(graph, referenceOrdering->maximumBagSize(), 1);
+
+            EXPECT_EQ(referenceOrdering->sequence(), repeatedOrdering->sequence());
+
+            EXPECT_EQ(referenceOrdering->maximumBagSize(), repeatedOrdering->maximumBagSize());
+
+            delete repeatedOrdering;
+
+            delete referenceOrdering;
+        }
+    }
+
+    delete libraryInstance;
+}
+
+TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setRandomTieBreakingEnabled(false);
+
+    htd::MaximumCardinalitySearchOrderingAlgorithm * clone = algorithm.clone();
+
+    EXPECT_EQ(libraryInstance, clone->managementInstance());
+
+    EXPECT_FALSE(clone->isRandomTieBreakingEnabled());
+
+    delete clone;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
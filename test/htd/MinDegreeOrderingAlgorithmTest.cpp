@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <cstdlib>
 #include <vector>
 
 class MinDegreeOrderingAlgorithmTest : public ::testing::Test
@@ -1278,6 +1279,77 @@ TEST(MinDegreeOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinDegreeOrderingAlgorithmTest, CheckDenseAndSparseAdjacency)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 80);
+
+    std::srand(1234);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 80; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 80; ++vertex2)
+        {
+            if (std::rand() % 10 == 0)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    std::vector<htd::vertex_t> vertexNames(graph.vertices().begin(), graph.vertices().end());
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    std::vector<htd::vertex_t> remainingVertices;
+
+    for (htd::vertex_t vertex : vertexNames)
+    {
+        neighborhood.emplace_back();
+
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            neighborhood.back().push_back(neighbor - 1);
+        }
+
+        remainingVertices.push_back(vertex - 1);
+    }
+
+    htd::PreprocessedGraph * preprocessedGraph = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), graph.edgeCount(), 0);
+
+    ASSERT_EQ(nullptr, preprocessedGraph->denseAdjacencyMatrix());
+
+    preprocessedGraph->updateDenseAdjacencyMatrix();
+
+    ASSERT_NE(nullptr, preprocessedGraph->denseAdjacencyMatrix());
+
+    htd::MinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 10; ++iteration)
+    {
+        if (iteration == 5)
+        {
+            preprocessedGraph->releaseDenseAdjacencyMatrix();
+
+            ASSERT_EQ(nullptr, preprocessedGraph->denseAdjacencyMatrix());
+        }
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+        htd::MultiHypergraph graphCopy(graph);
+
+        ASSERT_TRUE(isValidOrdering(graphCopy, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
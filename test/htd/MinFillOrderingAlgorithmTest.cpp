@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <cstdlib>
 #include <vector>
 
 class MinFillOrderingAlgorithmTest : public ::testing::Test
@@ -1296,6 +1297,92 @@ TEST(MinFillOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinFillOrderingAlgorithmTest, CheckDenseAndSparseAdjacency)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 80);
+
+    std::srand(1234);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 80; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 80; ++vertex2)
+        {
+            if (std::rand() % 10 == 0)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    std::vector<htd::vertex_t> vertexNames(graph.vertices().begin(), graph.vertices().end());
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    std::vector<htd::vertex_t> remainingVertices;
+
+    for (htd::vertex_t vertex : vertexNames)
+    {
+        neighborhood.emplace_back();
+
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            neighborhood.back().push_back(neighbor - 1);
+        }
+
+        remainingVertices.push_back(vertex - 1);
+    }
+
+    htd::PreprocessedGraph * preprocessedGraph = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), graph.edgeCount(), 0);
+
+    ASSERT_EQ(nullptr, preprocessedGraph->denseAdjacencyMatrix());
+
+    preprocessedGraph->updateDenseAdjacencyMatrix();
+
+    ASSERT_NE(nullptr, preprocessedGraph->denseAdjacencyMatrix());
+
+    const htd::DenseAdjacencyMatrix & adjacencyMatrix = *(preprocessedGraph->denseAdjacencyMatrix());
+
+    ASSERT_EQ(graph.vertexCount(), adjacencyMatrix.vertexCount());
+    ASSERT_EQ((std::size_t)2, adjacencyMatrix.wordCount());
+
+    for (htd::index_t index1 = 0; index1 < adjacencyMatrix.vertexCount(); ++index1)
+    {
+        for (htd::index_t index2 = 0; index2 < adjacencyMatrix.vertexCount(); ++index2)
+        {
+            ASSERT_EQ(graph.isNeighbor(preprocessedGraph->vertexName(adjacencyMatrix.vertexAtPosition(index1)),
+                                       preprocessedGraph->vertexName(adjacencyMatrix.vertexAtPosition(index2))),
+                      adjacencyMatrix.isNeighbor(index1, index2));
+        }
+    }
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 10; ++iteration)
+    {
+        if (iteration == 5)
+        {
+            preprocessedGraph->releaseDenseAdjacencyMatrix();
+
+            ASSERT_EQ(nullptr, preprocessedGraph->denseAdjacencyMatrix());
+        }
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+        htd::MultiHypergraph graphCopy(graph);
+
+        ASSERT_TRUE(isValidOrdering(graphCopy, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,299 @@
+/*
+ * File:   MinimumSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class MinimumSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        MinimumSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MinimumSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Check whether the given set of vertices separates the graph, i.e., whether removing it leaves a disconnected graph.
+ *
+ *  @param[in] graph        The input graph.
+ *  @param[in] separator    The set of vertices in ascending order.
+ *
+ *  @return True if the given set of vertices separates the graph, false otherwise.
+ */
+static bool isSeparator(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & separator)
+{
+    std::vector<htd::vertex_t> remainder;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        if (!std::binary_search(separator.begin(), separator.end(), vertex))
+        {
+            remainder.push_back(vertex);
+        }
+    }
+
+    std::vector<htd::vertex_t> reached;
+
+    if (!remainder.empty())
+    {
+        std::vector<htd::vertex_t> stack(1, remainder[0]);
+
+        reached.push_back(remainder[0]);
+
+        while (!stack.empty())
+        {
+            htd::vertex_t vertex = stack.back();
+
+            stack.pop_back();
+
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                if (std::binary_search(remainder.begin(), remainder.end(), neighbor) && std::find(reached.begin(), reached.end(), neighbor) == reached.end())
+                {
+                    reached.push_back(neighbor);
+
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    return reached.size() < remainder.size();
+}
+
+/**
+ *  Compute the size of a minimum separator of the given graph by enumerating all subsets of its vertices.
+ *
+ *  @param[in] graph    The input graph.
+ *
+ *  @return The size of a minimum separator of the given graph or the number of vertices if the graph has no separator.
+ */
+static std::size_t computeMinimumSeparatorSize(const htd::IMultiHypergraph & graph)
+{
+    std::size_t ret = graph.vertexCount();
+
+    std::size_t vertexCount = graph.vertexCount();
+
+    for (std::size_t subset = 0; subset < ((std::size_t)1 << vertexCount); ++subset)
+    {
+        std::vector<htd::vertex_t> separator;
+
+        for (htd::index_t index = 0; index < vertexCount; ++index)
+        {
+            if ((subset & ((std::size_t)1 << index)) != 0)
+            {
+                separator.push_back(graph.vertexAtPosition(index));
+            }
+        }
+
+        if (separator.size() < ret && isSeparator(graph, separator))
+        {
+            ret = separator.size();
+        }
+    }
+
+    return ret;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_NE(separator, nullptr);
+
+    EXPECT_EQ((std::size_t)0, separator->size());
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckCompleteGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 5; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 5; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_NE(separator, nullptr);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5 }), *separator);
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t size = 6;
+
+    htd::MultiHypergraph graph(libraryInstance, size * size);
+
+    for (htd::index_t row = 0; row < size; ++row)
+    {
+        for (htd::index_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = (htd::vertex_t)(row * size + column + 1);
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, (htd::vertex_t)(vertex + size));
+            }
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+    ASSERT_NE(separator, nullptr);
+
+    EXPECT_EQ((std::size_t)2, separator->size());
+
+    EXPECT_TRUE(isSeparator(graph, *separator));
+
+    delete separator;
+
+    delete libraryInstance;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (std::size_t iteration = 0; iteration < 100; ++iteration)
+    {
+        std::size_t vertexCount = 2 + iteration % 9;
+
+        std::uniform_int_distribution<std::size_t> distribution(0, 99);
+
+        std::size_t density = 20 + 10 * (iteration % 8);
+
+        htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+        for (htd::vertex_t vertex1 = 1; vertex1 <= vertexCount; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= vertexCount; ++vertex2)
+            {
+                if (distribution(generator) < density)
+                {
+                    graph.addEdge(vertex1, vertex2);
+                }
+            }
+        }
+
+        std::size_t expectedSize = computeMinimumSeparatorSize(graph);
+
+        htd::MinimumSeparatorAlgorithm algorithm(libraryInstance);
+
+        std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(graph);
+
+        ASSERT_NE(separator, nullptr);
+
+        EXPECT_EQ(expectedSize, separator->size());
+
+        EXPECT_TRUE(std::is_sorted(separator->begin(), separator->end()));
+
+        if (expectedSize < vertexCount)
+        {
+            EXPECT_TRUE(isSeparator(graph, *separator));
+        }
+
+        algorithm.setThreadCount(4);
+
+        ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+        std::vector<htd::vertex_t> * parallelSeparator = algorithm.computeSeparator(graph);
+
+        ASSERT_NE(parallelSeparator, nullptr);
+
+        EXPECT_EQ(*separator, *parallelSeparator);
+
+        algorithm.setMaxFlowAlgorithm(new htd::PushRelabelMaxFlowAlgorithm(libraryInstance));
+
+        htd::MinimumSeparatorAlgorithm * clonedAlgorithm = algorithm.clone();
+
+        std::vector<htd::vertex_t> * pushRelabelSeparator = clonedAlgorithm->computeSeparator(graph);
+
+        ASSERT_NE(pushRelabelSeparator, nullptr);
+
+        EXPECT_EQ(*separator, *pushRelabelSeparator);
+
+        delete pushRelabelSeparator;
+        delete clonedAlgorithm;
+        delete parallelSeparator;
+        delete separator;
+    }
+
+    delete libraryInstance;
+}
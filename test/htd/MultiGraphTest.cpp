@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <utility>
 #include <vector>
 
 class MultiGraphTest : public ::testing::Test
@@ -362,6 +363,59 @@ TEST(MultiGraphTest, CheckSelfLoop)
     delete libraryInstance;
 }
 
+TEST(MultiGraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiGraph graph1(libraryInstance, 5);
+    htd::MultiGraph graph2(libraryInstance, 5);
+
+    graph1.addEdge((htd::vertex_t)3, (htd::vertex_t)4);
+    graph2.addEdge((htd::vertex_t)3, (htd::vertex_t)4);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 1, 2 }, { 5, 1 }, { 2, 1 }, { 3, 3 }, { 4, 3 }, { 2, 5 }, { 1, 4 } };
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge.first, edge.second);
+    }
+
+    graph2.addEdges(edges);
+
+    graph2.addEdges(std::vector<std::pair<htd::vertex_t, htd::vertex_t>>());
+
+    ASSERT_EQ((std::size_t)8, graph2.edgeCount());
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+    ASSERT_EQ(graph1.nextEdgeId(), graph2.nextEdgeId());
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        const htd::Hyperedge & hyperedge1 = graph1.hyperedgeAtPosition(index);
+        const htd::Hyperedge & hyperedge2 = graph2.hyperedgeAtPosition(index);
+
+        ASSERT_EQ(hyperedge1.id(), hyperedge2.id());
+        ASSERT_EQ(hyperedge1.elements(), hyperedge2.elements());
+    }
+
+    for (htd::vertex_t vertex : graph1.vertices())
+    {
+        std::vector<htd::vertex_t> neighborhood1;
+        std::vector<htd::vertex_t> neighborhood2;
+
+        graph1.copyNeighborsTo(vertex, neighborhood1);
+        graph2.copyNeighborsTo(vertex, neighborhood2);
+
+        ASSERT_EQ(neighborhood1, neighborhood2);
+    }
+
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)3, (htd::vertex_t)3));
+    ASSERT_TRUE(graph2.isNeighbor((htd::vertex_t)5, (htd::vertex_t)2));
+    ASSERT_FALSE(graph2.isNeighbor((htd::vertex_t)5, (htd::vertex_t)4));
+    ASSERT_EQ(graph1.associatedEdgeIds((htd::vertex_t)1, (htd::vertex_t)2).size(), graph2.associatedEdgeIds((htd::vertex_t)1, (htd::vertex_t)2).size());
+
+    delete libraryInstance;
+}
+
 TEST(MultiGraphTest, CheckGraphModifications)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
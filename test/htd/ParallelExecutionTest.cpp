@@ -0,0 +1,158 @@
+/*
+ * File:   ParallelExecutionTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class ParallelExecutionTest : public ::testing::Test
+{
+    public:
+        ParallelExecutionTest(void)
+        {
+
+        }
+
+        virtual ~ParallelExecutionTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(ParallelExecutionTest, CheckExecuteWorkers)
+{
+    std::shared_ptr<htd::CancellationToken> token = std::make_shared<htd::CancellationToken>();
+
+    token->cancel();
+
+    htd::CancellationScope cancellationScope(token);
+
+    std::vector<int> observations(4, 0);
+
+    htd::executeWorkers(4, [&](htd::index_t worker)
+    {
+        observations[worker] = htd::CancellationToken::isCurrentCancelled() ? 1 : 2;
+    });
+
+    EXPECT_EQ(std::vector<int>(4, 1), observations);
+}
+
+TEST(ParallelExecutionTest, CheckParallelForExecutesEachTaskOnce)
+{
+    for (std::size_t threadCount : { 1, 2, 3, 8 })
+    {
+        std::vector<std::atomic<int>> executions(100);
+
+        for (std::atomic<int> & execution : executions)
+        {
+            execution = 0;
+        }
+
+        std::atomic<int> invalidWorkers(0);
+
+        htd::parallelFor(executions.size(), threadCount, [&](htd::index_t worker, htd::index_t task)
+        {
+            if (worker >= threadCount)
+            {
+                ++invalidWorkers;
+            }
+
+            ++executions[task];
+        });
+
+        EXPECT_EQ(0, invalidWorkers.load());
+
+        for (std::atomic<int> & execution : executions)
+        {
+            EXPECT_EQ(1, execution.load());
+        }
+    }
+}
+
+TEST(ParallelExecutionTest, CheckParallelForAfterCancellation)
+{
+    std::shared_ptr<htd::CancellationToken> token = std::make_shared<htd::CancellationToken>();
+
+    token->cancel();
+
+    htd::CancellationScope cancellationScope(token);
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        std::atomic<int> executions(0);
+
+        htd::parallelFor(10, threadCount, [&](htd::index_t worker, htd::index_t task)
+        {
+            HTD_UNUSED(worker)
+            HTD_UNUSED(task)
+
+            ++executions;
+        });
+
+        EXPECT_EQ(0, executions.load());
+    }
+}
+
+TEST(ParallelExecutionTest, CheckSeededParallelForIsReproducible)
+{
+    std::vector<std::vector<std::size_t>> results;
+
+    for (std::size_t threadCount : { 1, 2, 5 })
+    {
+        htd::setThreadLocalRandomSeed(42);
+
+        std::vector<std::size_t> numbers(20);
+
+        htd::seededParallelFor(numbers.size(), threadCount, [&](htd::index_t worker, htd::index_t task)
+        {
+            HTD_UNUSED(worker)
+
+            numbers[task] = htd::randomNumber();
+        });
+
+        numbers.push_back(htd::randomNumber());
+
+        results.push_back(numbers);
+    }
+
+    htd::resetThreadLocalRandomSeed();
+
+    EXPECT_EQ(results[0], results[1]);
+    EXPECT_EQ(results[0], results[2]);
+}
@@ -0,0 +1,308 @@
+/*
+ * File:   PriorityQueueTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+/**
+ *  Type selector for the indexed priority queue which allows to instantiate the queue with an arbitrary comparison operator.
+ */
+struct IndexedPriorityQueueSelector
+{
+    template < typename Compare >
+    using Queue = htd::IndexedPriorityQueue<htd::vertex_t, std::size_t, Compare>;
+};
+
+/**
+ *  Type selector for the bucket queue which allows to instantiate the queue with an arbitrary comparison operator.
+ */
+struct BucketQueueSelector
+{
+    template < typename Compare >
+    using Queue = htd::BucketQueue<htd::vertex_t, Compare>;
+};
+
+template < typename Selector >
+class PriorityQueueTest : public ::testing::Test
+{
+    public:
+        PriorityQueueTest(void)
+        {
+
+        }
+
+        virtual ~PriorityQueueTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+typedef ::testing::Types<IndexedPriorityQueueSelector, BucketQueueSelector> PriorityQueueSelectors;
+
+TYPED_TEST_SUITE(PriorityQueueTest, PriorityQueueSelectors);
+
+template < typename Queue >
+void checkTopCollection(const Queue & queue, const std::map<htd::vertex_t, std::size_t> & expected, bool maximumOnTop)
+{
+    ASSERT_EQ(expected.size(), queue.size());
+
+    if (!expected.empty())
+    {
+        std::size_t topPriority = expected.begin()->second;
+
+        for (const auto & entry : expected)
+        {
+            if (maximumOnTop ? entry.second > topPriority : entry.second < topPriority)
+            {
+                topPriority = entry.second;
+            }
+        }
+
+        std::vector<htd::vertex_t> expectedTopCollection;
+
+        for (const auto & entry : expected)
+        {
+            if (entry.second == topPriority)
+            {
+                expectedTopCollection.push_back(entry.first);
+            }
+        }
+
+        std::vector<htd::vertex_t> actualTopCollection(queue.topCollection().begin(), queue.topCollection().end());
+
+        std::sort(actualTopCollection.begin(), actualTopCollection.end());
+
+        ASSERT_EQ(topPriority, queue.topPriority());
+        ASSERT_EQ(expectedTopCollection, actualTopCollection);
+    }
+}
+
+template < typename Queue >
+void checkRandomOperations(Queue & queue, bool maximumOnTop)
+{
+    std::map<htd::vertex_t, std::size_t> expected;
+
+    std::srand(42);
+
+    for (std::size_t step = 0; step < 5000; ++step)
+    {
+        htd::vertex_t value = static_cast<htd::vertex_t>(std::rand() % 100);
+
+        std::size_t priority = static_cast<std::size_t>(std::rand() % 20);
+
+        switch (std::rand() % 4)
+        {
+            case 0:
+            case 1:
+            {
+                if (expected.count(value) == 0)
+                {
+                    queue.push(value, priority);
+
+                    expected[value] = priority;
+                }
+                else
+                {
+                    queue.updatePriority(value, priority);
+
+                    expected[value] = priority;
+                }
+
+                break;
+            }
+            case 2:
+            {
+                ASSERT_EQ(expected.erase(value) > 0, queue.erase(value));
+
+                break;
+            }
+            default:
+            {
+                if (!queue.empty())
+                {
+                    htd::vertex_t top = queue.top();
+
+                    ASSERT_TRUE(queue.eraseFromTopCollection(top));
+
+                    expected.erase(top);
+                }
+
+                break;
+            }
+        }
+
+        for (htd::vertex_t vertex = 0; vertex < 100; ++vertex)
+        {
+            ASSERT_EQ(expected.count(vertex) > 0, queue.contains(vertex));
+        }
+
+        checkTopCollection(queue, expected, maximumOnTop);
+    }
+}
+
+TYPED_TEST(PriorityQueueTest, CheckEmptyQueue)
+{
+    typename TypeParam::template Queue<std::greater<std::size_t>> queue;
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ((std::size_t)0, queue.size());
+    ASSERT_FALSE(queue.contains(1));
+    ASSERT_FALSE(queue.erase(1));
+    ASSERT_FALSE(queue.eraseFromTopCollection(1));
+}
+
+TYPED_TEST(PriorityQueueTest, CheckSimpleOperations)
+{
+    typename TypeParam::template Queue<std::greater<std::size_t>> queue(5);
+
+    queue.push(1, 3);
+    queue.push(2, 1);
+    queue.push(3, 1);
+    queue.push(7, 2);
+
+    ASSERT_EQ((std::size_t)4, queue.size());
+    ASSERT_EQ((std::size_t)1, queue.topPriority());
+    ASSERT_EQ((std::size_t)2, queue.topCollection().size());
+    ASSERT_EQ((std::size_t)2, queue.priority(7));
+
+    ASSERT_FALSE(queue.eraseFromTopCollection(1));
+    ASSERT_TRUE(queue.eraseFromTopCollection(2));
+
+    queue.updatePriority(3, 4);
+
+    ASSERT_EQ((std::size_t)2, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)7, queue.top());
+
+    queue.updatePriority(1, 0);
+
+    ASSERT_EQ((std::size_t)0, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)1, queue.top());
+
+    queue.pop();
+
+    ASSERT_FALSE(queue.contains(1));
+    ASSERT_EQ((htd::vertex_t)7, queue.top());
+
+    ASSERT_TRUE(queue.erase(7));
+    ASSERT_FALSE(queue.erase(7));
+
+    ASSERT_EQ((htd::vertex_t)3, queue.top());
+    ASSERT_EQ((std::size_t)4, queue.topPriority());
+
+    queue.pop();
+
+    ASSERT_TRUE(queue.empty());
+}
+
+TYPED_TEST(PriorityQueueTest, CheckRandomOperationsMinimumOnTop)
+{
+    typename TypeParam::template Queue<std::greater<std::size_t>> queue(100);
+
+    checkRandomOperations(queue, false);
+}
+
+TYPED_TEST(PriorityQueueTest, CheckRandomOperationsMaximumOnTop)
+{
+    typename TypeParam::template Queue<std::less<std::size_t>> queue;
+
+    checkRandomOperations(queue, true);
+}
+
+TEST(IndexedPriorityQueueTest, CheckUnboundedPriorities)
+{
+    htd::IndexedPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> queue;
+
+    queue.push(1, 1000000000);
+    queue.push(2, 7);
+    queue.push(3, (std::size_t)-2);
+
+    ASSERT_EQ((std::size_t)7, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)2, queue.top());
+
+    queue.pop();
+
+    ASSERT_EQ((std::size_t)1000000000, queue.topPriority());
+
+    queue.updatePriority(3, 3);
+
+    ASSERT_EQ((htd::vertex_t)3, queue.top());
+    ASSERT_EQ((std::size_t)3, queue.topPriority());
+}
+
+TEST(BucketQueueTest, CheckBoundedPriorities)
+{
+    htd::BucketQueue<htd::vertex_t, std::greater<std::size_t>> queue(4, 3);
+
+    queue.push(0, 3);
+    queue.push(1, 0);
+    queue.push(2, 2);
+
+    ASSERT_EQ((std::size_t)0, queue.topPriority());
+
+    /* A priority beyond the expected maximum and an element beyond the capacity must be accepted as well. */
+    queue.push(9, 12);
+
+    ASSERT_EQ((std::size_t)4, queue.size());
+    ASSERT_EQ((std::size_t)12, queue.priority(9));
+
+    std::vector<htd::vertex_t> order;
+
+    while (!queue.empty())
+    {
+        order.push_back(queue.top());
+
+        queue.pop();
+    }
+
+    /* When the top bucket runs empty, the next non-empty bucket is located by a scan over the bounded key range. */
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 0, 9 }), order);
+
+    queue.push(3, 5);
+
+    ASSERT_EQ((std::size_t)5, queue.topPriority());
+    ASSERT_EQ((htd::vertex_t)3, queue.top());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,287 @@
+/*
+ * File:   SeparatorBasedTreeDecompositionAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class SeparatorBasedTreeDecompositionAlgorithmTest : public ::testing::Test
+{
+    public:
+        SeparatorBasedTreeDecompositionAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~SeparatorBasedTreeDecompositionAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Check whether the induced hyperedges of each bag of the given decomposition are exactly the hyperedges contained in the bag.
+ *
+ *  @param[in] graph            The decomposed graph.
+ *  @param[in] decomposition    The decomposition of the graph.
+ *
+ *  @return True if the induced hyperedges of each bag are exactly the hyperedges contained in the bag, false otherwise.
+ */
+static bool hasCorrectInducedHyperedges(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition)
+{
+    bool ret = true;
+
+    for (htd::vertex_t vertex : decomposition.vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+
+        std::size_t expectedInducedEdgeCount = 0;
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            if (std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
+            {
+                ++expectedInducedEdgeCount;
+            }
+        }
+
+        ret = ret && decomposition.inducedHyperedges(vertex).size() == expectedInducedEdgeCount;
+    }
+
+    return ret;
+}
+
+TEST(SeparatorBasedTreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::SeparatorBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    EXPECT_FALSE(algorithm.isRecursiveDecompositionEnabled());
+
+    for (bool recursiveDecompositionEnabled : { false, true })
+    {
+        algorithm.setRecursiveDecompositionEnabled(recursiveDecompositionEnabled);
+
+        EXPECT_EQ(recursiveDecompositionEnabled, algorithm.isRecursiveDecompositionEnabled());
+
+        algorithm.setThreadCount(4);
+
+        EXPECT_EQ((std::size_t)4, algorithm.threadCount());
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ((std::size_t)1, decomposition->vertexCount());
+
+        EXPECT_EQ((std::size_t)0, decomposition->maximumBagSize());
+
+        delete decomposition;
+    }
+
+    htd::SeparatorBasedTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    EXPECT_TRUE(clonedAlgorithm->isRecursiveDecompositionEnabled());
+
+    delete clonedAlgorithm;
+
+    delete libraryInstance;
+}
+
+TEST(SeparatorBasedTreeDecompositionAlgorithmTest, CheckResultGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t size = 6;
+
+    htd::MultiHypergraph graph(libraryInstance, size * size);
+
+    for (htd::index_t row = 0; row < size; ++row)
+    {
+        for (htd::index_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = (htd::vertex_t)(row * size + column + 1);
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, (htd::vertex_t)(vertex + size));
+            }
+        }
+    }
+
+    /* A thread count of zero selects the refinement of a trivial decomposition. */
+    for (std::size_t threadCount : { 0, 1, 2, 4 })
+    {
+        htd::SeparatorBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        if (threadCount > 0)
+        {
+            algorithm.setRecursiveDecompositionEnabled(true);
+
+            algorithm.setThreadCount(threadCount);
+        }
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+        EXPECT_LT(decomposition->maximumBagSize(), size * size);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_TRUE(hasCorrectInducedHyperedges(graph, *decomposition));
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(SeparatorBasedTreeDecompositionAlgorithmTest, CheckResultRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (htd::index_t iteration = 0; iteration < 20; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance);
+
+        std::size_t vertexCount = 5 + generator() % 40;
+
+        graph.addVertices(vertexCount);
+
+        std::size_t edgeCount = generator() % (3 * vertexCount);
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+            htd::vertex_t vertex2 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+            htd::vertex_t vertex3 = htd::Vertex::FIRST + static_cast<htd::vertex_t>(generator() % vertexCount);
+
+            if (index % 5 == 0)
+            {
+                graph.addEdge(std::vector<htd::vertex_t> { vertex1, vertex2, vertex3 });
+            }
+            else if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::SeparatorBasedTreeDecompositionAlgorithm widthReductionAlgorithm(libraryInstance);
+
+        htd::ITreeDecomposition * widthReducedDecomposition = widthReductionAlgorithm.computeDecomposition(graph);
+
+        ASSERT_NE(widthReducedDecomposition, nullptr);
+
+        htd::TreeDecompositionVerifier widthReductionVerifier;
+
+        ASSERT_TRUE(widthReductionVerifier.verify(graph, *widthReducedDecomposition));
+
+        delete widthReducedDecomposition;
+
+        std::vector<std::vector<htd::vertex_t>> referenceBags;
+
+        for (std::size_t threadCount : { 1, 2, 3, 5 })
+        {
+            htd::SeparatorBasedTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+            algorithm.setRecursiveDecompositionEnabled(true);
+
+            algorithm.setThreadCount(threadCount);
+
+            htd::setThreadLocalRandomSeed(iteration);
+
+            htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+            htd::resetThreadLocalRandomSeed();
+
+            ASSERT_NE(decomposition, nullptr);
+
+            EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+            htd::TreeDecompositionVerifier verifier;
+
+            ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+            EXPECT_TRUE(hasCorrectInducedHyperedges(graph, *decomposition));
+
+            std::vector<std::vector<htd::vertex_t>> bags;
+
+            for (htd::vertex_t vertex : decomposition->vertices())
+            {
+                bags.push_back(decomposition->bagContent(vertex));
+            }
+
+            /* The result must not depend on the number of threads. */
+            if (referenceBags.empty())
+            {
+                referenceBags = bags;
+            }
+            else
+            {
+                EXPECT_EQ(referenceBags, bags);
+            }
+
+            delete decomposition;
+        }
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <chrono>
+#include <cstdlib>
+#include <memory>
 #include <vector>
 
 class TreeDecompositionOptimizationTest : public ::testing::Test
@@ -80,6 +83,34 @@ class FitnessFunction : public htd::ITreeDecompositionFitnessFunction
         }
 };
 
+class WidthFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        WidthFitnessFunction(void)
+        {
+
+        }
+
+        ~WidthFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1,
+                                              -(double)(decomposition.maximumBagSize()));
+        }
+
+        WidthFitnessFunction * clone(void) const
+        {
+            return new WidthFitnessFunction();
+        }
+};
+
 htd::IMultiHypergraph * createInputGraph(const htd::LibraryInstance * const libraryInstance)
 {
     htd::MultiHypergraph * graph = new htd::MultiHypergraph(libraryInstance, 50);
@@ -991,6 +1022,226 @@ TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraph)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraphMultiThreaded)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    std::size_t iterationCount = 0;
+    std::size_t minimalHeight = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentHeight = currentDecomposition.height();
+
+        ASSERT_EQ(currentHeight, (std::size_t)(-fitness.at(0)));
+
+        if (currentHeight < minimalHeight)
+        {
+            minimalHeight = currentHeight;
+        }
+
+        ++iterationCount;
+    });
+
+    ASSERT_EQ((std::size_t)25, iterationCount);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(decomposition->vertexCount(), (std::size_t)1);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    ASSERT_LE(decomposition->minimumBagSize(), decomposition->maximumBagSize());
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalHeight, decomposition->height());
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    delete clonedAlgorithm;
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckResultIsIndependentOfThreadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    std::vector<std::vector<std::size_t>> results;
+
+    for (std::size_t threadCount : { 1, 2, 3, 8 })
+    {
+        htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+        algorithm.setIterationCount(40);
+
+        algorithm.setNonImprovementLimit(10);
+
+        algorithm.setThreadCount(threadCount);
+
+        std::vector<std::size_t> result;
+
+        std::srand(1234);
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(*graph,
+                                           [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation &){
+            result.push_back(currentDecomposition.height());
+            result.push_back(currentDecomposition.maximumBagSize());
+            result.push_back(currentDecomposition.vertexCount());
+        });
+
+        ASSERT_NE(decomposition, nullptr);
+
+        result.push_back(decomposition->height());
+
+        results.push_back(result);
+
+        delete decomposition;
+    }
+
+    ASSERT_EQ(results[0], results[1]);
+    ASSERT_EQ(results[0], results[2]);
+    ASSERT_EQ(results[0], results[3]);
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckWidthOnlyEvaluationResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new WidthFitnessFunction());
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_FALSE(algorithm.isWidthOnlyEvaluationEnabled());
+
+        algorithm.setWidthOnlyEvaluationEnabled(true);
+
+        ASSERT_TRUE(algorithm.isWidthOnlyEvaluationEnabled());
+
+        algorithm.setIterationCount(25);
+
+        algorithm.setThreadCount(threadCount);
+
+        std::size_t iterationCount = 0;
+        std::size_t minimalWidth = (std::size_t)-1;
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(*graph,
+                                           [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+            ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+            std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+            ASSERT_EQ(currentWidth, (std::size_t)(-fitness.at(0)));
+
+            /* Only decompositions improving the width are materialized. */
+            ASSERT_LT(currentWidth, minimalWidth);
+
+            minimalWidth = currentWidth;
+
+            ++iterationCount;
+        });
+
+        ASSERT_GE(iterationCount, (std::size_t)1);
+        ASSERT_LE(iterationCount, (std::size_t)25);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+        ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+        htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+        ASSERT_TRUE(clonedAlgorithm->isWidthOnlyEvaluationEnabled());
+
+        delete clonedAlgorithm;
+        delete decomposition;
+    }
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckMultiThreadedWidthOnlyEvaluationResultIsReproducible)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    std::vector<std::vector<std::size_t>> results;
+
+    for (std::size_t threadCount : { 1, 2, 3, 8 })
+    {
+        htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new WidthFitnessFunction());
+
+        algorithm.setIterationCount(40);
+
+        algorithm.setNonImprovementLimit(10);
+
+        algorithm.setThreadCount(threadCount);
+
+        algorithm.setWidthOnlyEvaluationEnabled(true);
+
+        std::vector<std::size_t> result;
+
+        std::srand(1234);
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(*graph,
+                                           [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation &){
+            result.push_back(currentDecomposition.maximumBagSize());
+            result.push_back(currentDecomposition.vertexCount());
+        });
+
+        ASSERT_NE(decomposition, nullptr);
+
+        result.push_back(decomposition->maximumBagSize());
+
+        results.push_back(result);
+
+        delete decomposition;
+    }
+
+    ASSERT_EQ(results[0], results[1]);
+    ASSERT_EQ(results[0], results[2]);
+    ASSERT_EQ(results[0], results[3]);
+
+    delete graph;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1115,6 +1366,84 @@ TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComp
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraphWithTimeLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(0);
+
+    algorithm.setTimeLimit(std::chrono::milliseconds(100));
+
+    ASSERT_EQ(std::chrono::milliseconds(100), algorithm.timeLimit());
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComplexGraphWithExpiredTimeLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+
+    baseAlgorithm->setIterationCount(0);
+
+    algorithm.addDecompositionAlgorithm(baseAlgorithm);
+
+    algorithm.addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(libraryInstance));
+
+    algorithm.setTimeLimit(std::chrono::milliseconds(1));
+
+    ASSERT_EQ(std::chrono::milliseconds(1), algorithm.timeLimit());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::shared_ptr<htd::CancellationToken> token = std::make_shared<htd::CancellationToken>();
+
+    token->cancel();
+
+    htd::ITreeDecomposition * decomposition = nullptr;
+
+    {
+        htd::CancellationScope scope(token);
+
+        decomposition = algorithm.computeDecomposition(*graph);
+    }
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(graph->vertexCount(), decomposition->maximumBagSize());
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 class BagSizeLabelingFunction : public htd::ILabelingFunction
 {
     public:
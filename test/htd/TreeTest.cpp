@@ -692,6 +692,94 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckCopyAfterVertexRemoval)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+    htd::vertex_t node5 = tree.addChild(node2);
+
+    tree.removeVertex(node2);
+
+    ASSERT_FALSE(tree.isVertex(node2));
+    ASSERT_EQ((std::size_t)4, tree.vertexCount());
+    ASSERT_EQ((std::size_t)3, tree.edgeCount());
+    ASSERT_EQ((std::size_t)3, tree.leafCount());
+
+    htd::Tree copy(tree);
+
+    ASSERT_EQ((std::size_t)4, copy.vertexCount());
+    ASSERT_EQ((std::size_t)3, copy.edgeCount());
+
+    ASSERT_FALSE(copy.isVertex(node2));
+    ASSERT_TRUE(copy.isParent(node3, node1));
+    ASSERT_TRUE(copy.isParent(node4, node1));
+    ASSERT_TRUE(copy.isParent(node5, node1));
+
+    htd::vertex_t node6 = copy.addChild(node5);
+
+    ASSERT_EQ(node6, tree.nextVertex());
+    ASSERT_EQ((std::size_t)5, copy.vertexCount());
+    ASSERT_EQ((std::size_t)4, tree.vertexCount());
+    ASSERT_FALSE(tree.isVertex(node6));
+
+    const htd::ConstCollection<htd::vertex_t> & leaves = copy.leaves();
+
+    ASSERT_EQ((std::size_t)3, leaves.size());
+    ASSERT_EQ(node3, leaves[0]);
+    ASSERT_EQ(node4, leaves[1]);
+    ASSERT_EQ(node6, leaves[2]);
+
+    tree = copy;
+
+    ASSERT_EQ((std::size_t)5, tree.vertexCount());
+    ASSERT_EQ((std::size_t)4, tree.edgeCount());
+    ASSERT_TRUE(tree.isParent(node6, node5));
+    ASSERT_FALSE(tree.isVertex(node2));
+
+    delete libraryInstance;
+}
+
+TEST(TreeTest, CheckSpanAccess)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+
+    ASSERT_EQ((std::size_t)4, tree.vertexSpan().size());
+
+    const htd::ConstSpan<htd::vertex_t> children = tree.childSpan(node1);
+
+    ASSERT_EQ((std::size_t)2, children.size());
+    ASSERT_EQ(node2, children[0]);
+    ASSERT_EQ(node3, children[1]);
+
+    ASSERT_TRUE(tree.childSpan(node4).empty());
+
+    std::vector<htd::vertex_t> buffer;
+
+    const htd::ConstSpan<htd::vertex_t> neighbors = tree.neighborSpan(node2, buffer);
+
+    ASSERT_EQ((std::size_t)2, neighbors.size());
+    ASSERT_EQ(node1, neighbors[0]);
+    ASSERT_EQ(node4, neighbors[1]);
+
+    ASSERT_EQ((std::size_t)1, tree.neighborSpan(node4, buffer).size());
+    ASSERT_EQ(node2, tree.neighborSpan(node4, buffer)[0]);
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
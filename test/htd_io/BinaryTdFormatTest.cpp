@@ -0,0 +1,204 @@
+/*
+ * File:   BinaryTdFormatTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+class BinaryTdFormatTest : public ::testing::Test
+{
+    public:
+        BinaryTdFormatTest(void)
+        {
+
+        }
+
+        virtual ~BinaryTdFormatTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+static void addTestEdges(htd::MultiHypergraph & graph)
+{
+    graph.addVertices(8);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 1);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 7);
+    graph.addEdge(7, 5);
+    graph.addEdge(std::vector<htd::vertex_t> { 2, 6, 8 });
+}
+
+static void checkRoundTrip(bool inducedEdgeExportEnabled)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addTestEdges(graph);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd_io::BinaryTdFormatExporter exporter;
+
+    exporter.setInducedEdgeExportEnabled(inducedEdgeExportEnabled);
+
+    std::stringstream stream;
+
+    exporter.write(*decomposition, graph, stream);
+
+    htd_io::BinaryTdFormatImporter importer;
+
+    std::unique_ptr<htd_io::BinaryTreeDecomposition> importedDecomposition(importer.import(stream));
+
+    ASSERT_NE(importedDecomposition, nullptr);
+
+    EXPECT_EQ(inducedEdgeExportEnabled, (importedDecomposition->header().flags & htd_io::BinaryTdFormatHeader::FLAG_INDUCED_EDGES) != 0);
+    EXPECT_EQ(inducedEdgeExportEnabled, importedDecomposition->hasInducedEdges());
+
+    ASSERT_EQ(decomposition->vertexCount(), importedDecomposition->nodeCount());
+
+    EXPECT_EQ(graph.vertexCount(), importedDecomposition->vertexCount());
+    EXPECT_EQ(decomposition->maximumBagSize(), importedDecomposition->maximumBagSize());
+
+    std::vector<htd::vertex_t> nodes;
+
+    std::vector<htd::vertex_t> parents;
+
+    htd::PostOrderTreeTraversal traversal;
+
+    traversal.traverse(*decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToRoot)
+    {
+        HTD_UNUSED(distanceToRoot)
+
+        nodes.push_back(vertex);
+
+        parents.push_back(parent);
+    });
+
+    ASSERT_EQ(decomposition->vertexCount(), nodes.size());
+
+    EXPECT_EQ(nodes.size() - 1, importedDecomposition->root());
+
+    for (std::uint32_t index = 0; index < nodes.size(); ++index)
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(nodes[index]);
+
+        std::vector<htd::vertex_t> importedBag(importedDecomposition->bagContent(index), importedDecomposition->bagContent(index) + importedDecomposition->bagSize(index));
+
+        EXPECT_EQ(bag, importedBag);
+
+        if (parents[index] == htd::Vertex::UNKNOWN)
+        {
+            EXPECT_EQ(htd_io::BinaryTdFormatHeader::NO_PARENT, importedDecomposition->parent(index));
+        }
+        else
+        {
+            ASSERT_LT(importedDecomposition->parent(index), nodes.size());
+
+            EXPECT_GT(importedDecomposition->parent(index), index);
+
+            EXPECT_EQ(parents[index], nodes[importedDecomposition->parent(index)]);
+        }
+
+        if (inducedEdgeExportEnabled)
+        {
+            std::vector<htd::id_t> inducedEdges;
+
+            for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(nodes[index]))
+            {
+                inducedEdges.push_back(hyperedge.id());
+            }
+
+            std::vector<htd::id_t> importedInducedEdges(importedDecomposition->inducedEdges(index), importedDecomposition->inducedEdges(index) + importedDecomposition->inducedEdgeCount(index));
+
+            EXPECT_EQ(inducedEdges, importedInducedEdges);
+        }
+    }
+
+    std::unique_ptr<htd::ITreeDecomposition> convertedDecomposition(importedDecomposition->toTreeDecomposition(libraryInstance));
+
+    ASSERT_NE(convertedDecomposition, nullptr);
+
+    EXPECT_EQ(decomposition->vertexCount(), convertedDecomposition->vertexCount());
+    EXPECT_EQ(decomposition->maximumBagSize(), convertedDecomposition->maximumBagSize());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *convertedDecomposition));
+
+    decomposition.reset();
+
+    convertedDecomposition.reset();
+
+    delete libraryInstance;
+}
+
+TEST(BinaryTdFormatTest, CheckRoundTrip)
+{
+    checkRoundTrip(false);
+}
+
+TEST(BinaryTdFormatTest, CheckRoundTripWithInducedEdges)
+{
+    checkRoundTrip(true);
+}
+
+TEST(BinaryTdFormatTest, CheckImportOfInvalidInput)
+{
+    htd_io::BinaryTdFormatImporter importer;
+
+    std::stringstream emptyStream;
+
+    EXPECT_EQ(nullptr, importer.import(emptyStream));
+
+    std::stringstream invalidStream("s td 1 1 1\nb 1 1\n");
+
+    EXPECT_EQ(nullptr, importer.import(invalidStream));
+}
@@ -0,0 +1,17 @@
+# Run PROGRAM with the ARGUMENTS (separated by '|') and compare its standard output to the content of EXPECTED_OUTPUT.
+
+string(REPLACE "|" ";" ARGUMENTS "${ARGUMENTS}")
+
+execute_process(COMMAND "${PROGRAM}" ${ARGUMENTS}
+                RESULT_VARIABLE EXIT_CODE
+                OUTPUT_VARIABLE ACTUAL_OUTPUT)
+
+if(NOT EXIT_CODE EQUAL 0)
+    message(FATAL_ERROR "${PROGRAM} exited with code ${EXIT_CODE}")
+endif()
+
+file(READ "${EXPECTED_OUTPUT}" EXPECTED)
+
+if(NOT ACTUAL_OUTPUT STREQUAL EXPECTED)
+    message(FATAL_ERROR "Output of ${PROGRAM} ${ARGUMENTS} differs from ${EXPECTED_OUTPUT}:\n${ACTUAL_OUTPUT}")
+endif()